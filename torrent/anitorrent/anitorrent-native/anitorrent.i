@@ -2,6 +2,7 @@
 %{
 #include "anitorrent.hpp"
 #include "events.hpp"
+#include "event_buffer.hpp"
 #include "peer_filter.hpp"
 #include "session_t.hpp"
 #include "torrent_add_info_t.hpp"
@@ -15,17 +16,47 @@
 
 %feature("director") event_listener_t;
 %feature("director") peer_filter_t;
+%feature("director") new_event_listener_t;
 
 %template(PeerInfoList) std::vector<anilt::peer_info_t>;
 %template(CharVector) std::vector<char>;
+%template(IntVector) std::vector<int32_t>;
 
 %include stdint.i
 %include "arrays_java.i"
 
+// event_buffer_t::read writes into a direct java.nio.ByteBuffer, not a copied byte[]
+%typemap(jni) char *buffer "jobject"
+%typemap(jtype) char *buffer "java.nio.ByteBuffer"
+%typemap(jstype) char *buffer "java.nio.ByteBuffer"
+%typemap(javain, pre="    assert $javainput.isDirect() : \"Buffer must be allocated direct.\";") char *buffer "$javainput"
+%typemap(in) char *buffer {
+  $1 = (char *) jenv->GetDirectBufferAddress($input);
+  if ($1 == NULL) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+    return $null;
+  }
+}
+%typemap(freearg) char *buffer ""
+
+// torrent_handle_t::get_piece_state_buffer returns native memory as a direct java.nio.ByteBuffer. The memory is kept
+// by the session until session_t::release_piece_state_buffer, not by the buffer, see its documentation.
+%typemap(jni) anilt::piece_state_buffer_t "jobject"
+%typemap(jtype) anilt::piece_state_buffer_t "java.nio.ByteBuffer"
+%typemap(jstype) anilt::piece_state_buffer_t "java.nio.ByteBuffer"
+%typemap(javaout) anilt::piece_state_buffer_t {
+    return $jnicall;
+  }
+%typemap(out) anilt::piece_state_buffer_t %{
+  $result = $1.data ? jenv->NewDirectByteBuffer($1.data, $1.size) : nullptr;
+%}
+%ignore anilt::piece_state_buffer_t;
+
 %include "include/torrent_info_t.hpp"
 %include "include/torrent_add_info_t.hpp"
-%include "include/torrent_handle_t.hpp"
 %include "include/events.hpp"
+%include "include/event_buffer.hpp"
+%include "include/torrent_handle_t.hpp"
 %include "include/peer_filter.hpp"
 %include "include/session_t.hpp"
 %include "include/anitorrent.hpp"
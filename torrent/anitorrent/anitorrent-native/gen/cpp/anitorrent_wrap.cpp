@@ -782,7 +782,7 @@ namespace Swig {
 namespace Swig {
   namespace {
     jclass jclass_anitorrentJNI = NULL;
-    jmethodID director_method_ids[13];
+    jmethodID director_method_ids[18];
   }
 }
 
@@ -836,6 +836,7 @@ template <typename T> T SwigValueInit() {
 
 #include "anitorrent.hpp"
 #include "events.hpp"
+#include "event_buffer.hpp"
 #include "peer_filter.hpp"
 #include "session_t.hpp"
 #include "torrent_add_info_t.hpp"
@@ -994,6 +995,69 @@ SWIGINTERN void std_vector_Sl_char_Sg__doRemoveRange(std::vector< char > *self,j
         }
       }
 
+SWIGINTERN std::vector< int32_t > *new_std_vector_Sl_int32_t_Sg___SWIG_2(jint count,int32_t const &value){
+        if (count < 0)
+          throw std::out_of_range("vector count must be positive");
+        return new std::vector< int32_t >(static_cast<std::vector< int32_t >::size_type>(count), value);
+      }
+SWIGINTERN jint std_vector_Sl_int32_t_Sg__doCapacity(std::vector< int32_t > *self){
+        return SWIG_VectorSize(self->capacity());
+      }
+SWIGINTERN void std_vector_Sl_int32_t_Sg__doReserve(std::vector< int32_t > *self,jint n){
+        if (n < 0)
+          throw std::out_of_range("vector reserve size must be positive");
+        self->reserve(n);
+      }
+SWIGINTERN jint std_vector_Sl_int32_t_Sg__doSize(std::vector< int32_t > const *self){
+        return SWIG_VectorSize(self->size());
+      }
+SWIGINTERN void std_vector_Sl_int32_t_Sg__doAdd__SWIG_0(std::vector< int32_t > *self,std::vector< int32_t >::value_type const &x){
+        self->push_back(x);
+      }
+SWIGINTERN void std_vector_Sl_int32_t_Sg__doAdd__SWIG_1(std::vector< int32_t > *self,jint index,std::vector< int32_t >::value_type const &x){
+        jint size = static_cast<jint>(self->size());
+        if (0 <= index && index <= size) {
+          self->insert(self->begin() + index, x);
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+SWIGINTERN std::vector< int32_t >::value_type std_vector_Sl_int32_t_Sg__doRemove(std::vector< int32_t > *self,jint index){
+        jint size = static_cast<jint>(self->size());
+        if (0 <= index && index < size) {
+          int32_t const old_value = (*self)[index];
+          self->erase(self->begin() + index);
+          return old_value;
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+SWIGINTERN std::vector< int32_t >::value_type const &std_vector_Sl_int32_t_Sg__doGet(std::vector< int32_t > *self,jint index){
+        jint size = static_cast<jint>(self->size());
+        if (index >= 0 && index < size)
+          return (*self)[index];
+        else
+          throw std::out_of_range("vector index out of range");
+      }
+SWIGINTERN std::vector< int32_t >::value_type std_vector_Sl_int32_t_Sg__doSet(std::vector< int32_t > *self,jint index,std::vector< int32_t >::value_type const &val){
+        jint size = static_cast<jint>(self->size());
+        if (index >= 0 && index < size) {
+          int32_t const old_value = (*self)[index];
+          (*self)[index] = val;
+          return old_value;
+        }
+        else
+          throw std::out_of_range("vector index out of range");
+      }
+SWIGINTERN void std_vector_Sl_int32_t_Sg__doRemoveRange(std::vector< int32_t > *self,jint fromIndex,jint toIndex){
+        jint size = static_cast<jint>(self->size());
+        if (0 <= fromIndex && fromIndex <= toIndex && toIndex <= size) {
+          self->erase(self->begin() + fromIndex, self->begin() + toIndex);
+        } else {
+          throw std::out_of_range("vector index out of range");
+        }
+      }
+
 #include <stdint.h>		// Use the C99 official header
 
 
@@ -1818,6 +1882,33 @@ void SwigDirector_event_listener_t::on_piece_finished(anilt::handle_id_t handle_
   if (swigjobj) jenv->DeleteLocalRef(swigjobj);
 }
 
+void SwigDirector_event_listener_t::on_piece_progress(anilt::handle_id_t handle_id,anilt::piece_progress_t &progress) {
+  JNIEnvWrapper swigjnienv(this) ;
+  JNIEnv * jenv = swigjnienv.getJNIEnv() ;
+  jobject swigjobj = (jobject) NULL ;
+  jlong jhandle_id  ;
+  jlong jprogress = 0 ;
+  
+  if (!swig_override[7]) {
+    anilt::event_listener_t::on_piece_progress(handle_id,progress);
+    return;
+  }
+  swigjobj = swig_get_self(jenv);
+  if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
+    jhandle_id = (jlong) handle_id;
+    *(anilt::piece_progress_t **)&jprogress = (anilt::piece_progress_t *) &progress; 
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[7], swigjobj, jhandle_id, jprogress);
+    jthrowable swigerror = jenv->ExceptionOccurred();
+    if (swigerror) {
+      Swig::DirectorException::raise(jenv, swigerror);
+    }
+    
+  } else {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null upcall object in anilt::event_listener_t::on_piece_progress ");
+  }
+  if (swigjobj) jenv->DeleteLocalRef(swigjobj);
+}
+
 void SwigDirector_event_listener_t::on_status_update(anilt::handle_id_t handle_id,anilt::torrent_stats_t &stats) {
   JNIEnvWrapper swigjnienv(this) ;
   JNIEnv * jenv = swigjnienv.getJNIEnv() ;
@@ -1825,7 +1916,7 @@ void SwigDirector_event_listener_t::on_status_update(anilt::handle_id_t handle_i
   jlong jhandle_id  ;
   jlong jstats = 0 ;
   
-  if (!swig_override[7]) {
+  if (!swig_override[8]) {
     anilt::event_listener_t::on_status_update(handle_id,stats);
     return;
   }
@@ -1833,7 +1924,7 @@ void SwigDirector_event_listener_t::on_status_update(anilt::handle_id_t handle_i
   if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
     jhandle_id = (jlong) handle_id;
     *(anilt::torrent_stats_t **)&jstats = (anilt::torrent_stats_t *) &stats; 
-    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[7], swigjobj, jhandle_id, jstats);
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[8], swigjobj, jhandle_id, jstats);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -1852,7 +1943,7 @@ void SwigDirector_event_listener_t::on_file_completed(anilt::handle_id_t handle_
   jlong jhandle_id  ;
   jint jfile_index  ;
   
-  if (!swig_override[8]) {
+  if (!swig_override[9]) {
     anilt::event_listener_t::on_file_completed(handle_id,file_index);
     return;
   }
@@ -1860,7 +1951,7 @@ void SwigDirector_event_listener_t::on_file_completed(anilt::handle_id_t handle_
   if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
     jhandle_id = (jlong) handle_id;
     jfile_index = (jint) file_index;
-    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[8], swigjobj, jhandle_id, jfile_index);
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[9], swigjobj, jhandle_id, jfile_index);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -1879,7 +1970,7 @@ void SwigDirector_event_listener_t::on_torrent_removed(anilt::handle_id_t handle
   jlong jhandle_id  ;
   jstring jtorrent_name = 0 ;
   
-  if (!swig_override[9]) {
+  if (!swig_override[10]) {
     anilt::event_listener_t::on_torrent_removed(handle_id,torrent_name);
     return;
   }
@@ -1892,7 +1983,7 @@ void SwigDirector_event_listener_t::on_torrent_removed(anilt::handle_id_t handle
       if (!jtorrent_name) return ;
     }
     Swig::LocalRefGuard torrent_name_refguard(jenv, jtorrent_name);
-    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[9], swigjobj, jhandle_id, jtorrent_name);
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[10], swigjobj, jhandle_id, jtorrent_name);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -1911,7 +2002,7 @@ void SwigDirector_event_listener_t::on_session_stats(anilt::handle_id_t handle_i
   jlong jhandle_id  ;
   jlong jstats = 0 ;
   
-  if (!swig_override[10]) {
+  if (!swig_override[11]) {
     anilt::event_listener_t::on_session_stats(handle_id,stats);
     return;
   }
@@ -1919,7 +2010,7 @@ void SwigDirector_event_listener_t::on_session_stats(anilt::handle_id_t handle_i
   if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
     jhandle_id = (jlong) handle_id;
     *(anilt::session_stats_t **)&jstats = (anilt::session_stats_t *) &stats; 
-    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[10], swigjobj, jhandle_id, jstats);
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[11], swigjobj, jhandle_id, jstats);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -1931,6 +2022,116 @@ void SwigDirector_event_listener_t::on_session_stats(anilt::handle_id_t handle_i
   if (swigjobj) jenv->DeleteLocalRef(swigjobj);
 }
 
+void SwigDirector_event_listener_t::on_resume_data_saved(anilt::handle_id_t handle_id,bool success) {
+  JNIEnvWrapper swigjnienv(this) ;
+  JNIEnv * jenv = swigjnienv.getJNIEnv() ;
+  jobject swigjobj = (jobject) NULL ;
+  jlong jhandle_id  ;
+  jboolean jsuccess  ;
+  
+  if (!swig_override[12]) {
+    anilt::event_listener_t::on_resume_data_saved(handle_id,success);
+    return;
+  }
+  swigjobj = swig_get_self(jenv);
+  if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
+    jhandle_id = (jlong) handle_id;
+    jsuccess = (jboolean) success;
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[12], swigjobj, jhandle_id, jsuccess);
+    jthrowable swigerror = jenv->ExceptionOccurred();
+    if (swigerror) {
+      Swig::DirectorException::raise(jenv, swigerror);
+    }
+    
+  } else {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null upcall object in anilt::event_listener_t::on_resume_data_saved ");
+  }
+  if (swigjobj) jenv->DeleteLocalRef(swigjobj);
+}
+
+void SwigDirector_event_listener_t::on_alerts_dropped(anilt::handle_id_t handle_id,uint32_t dropped_events,uint32_t dropped_categories) {
+  JNIEnvWrapper swigjnienv(this) ;
+  JNIEnv * jenv = swigjnienv.getJNIEnv() ;
+  jobject swigjobj = (jobject) NULL ;
+  jlong jhandle_id  ;
+  jlong jdropped_events  ;
+  jlong jdropped_categories  ;
+  
+  if (!swig_override[13]) {
+    anilt::event_listener_t::on_alerts_dropped(handle_id,dropped_events,dropped_categories);
+    return;
+  }
+  swigjobj = swig_get_self(jenv);
+  if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
+    jhandle_id = (jlong) handle_id;
+    jdropped_events = (jlong) dropped_events;
+    jdropped_categories = (jlong) dropped_categories;
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[13], swigjobj, jhandle_id, jdropped_events, jdropped_categories);
+    jthrowable swigerror = jenv->ExceptionOccurred();
+    if (swigerror) {
+      Swig::DirectorException::raise(jenv, swigerror);
+    }
+    
+  } else {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null upcall object in anilt::event_listener_t::on_alerts_dropped ");
+  }
+  if (swigjobj) jenv->DeleteLocalRef(swigjobj);
+}
+
+void SwigDirector_event_listener_t::on_deadline_missed(anilt::handle_id_t handle_id,anilt::deadline_miss_t &miss) {
+  JNIEnvWrapper swigjnienv(this) ;
+  JNIEnv * jenv = swigjnienv.getJNIEnv() ;
+  jobject swigjobj = (jobject) NULL ;
+  jlong jhandle_id  ;
+  jlong jmiss = 0 ;
+  
+  if (!swig_override[14]) {
+    anilt::event_listener_t::on_deadline_missed(handle_id,miss);
+    return;
+  }
+  swigjobj = swig_get_self(jenv);
+  if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
+    jhandle_id = (jlong) handle_id;
+    *(anilt::deadline_miss_t **)&jmiss = (anilt::deadline_miss_t *) &miss; 
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[14], swigjobj, jhandle_id, jmiss);
+    jthrowable swigerror = jenv->ExceptionOccurred();
+    if (swigerror) {
+      Swig::DirectorException::raise(jenv, swigerror);
+    }
+    
+  } else {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null upcall object in anilt::event_listener_t::on_deadline_missed ");
+  }
+  if (swigjobj) jenv->DeleteLocalRef(swigjobj);
+}
+
+void SwigDirector_event_listener_t::on_recheck_progress(anilt::handle_id_t handle_id,anilt::recheck_progress_t &progress) {
+  JNIEnvWrapper swigjnienv(this) ;
+  JNIEnv * jenv = swigjnienv.getJNIEnv() ;
+  jobject swigjobj = (jobject) NULL ;
+  jlong jhandle_id  ;
+  jlong jprogress = 0 ;
+  
+  if (!swig_override[15]) {
+    anilt::event_listener_t::on_recheck_progress(handle_id,progress);
+    return;
+  }
+  swigjobj = swig_get_self(jenv);
+  if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
+    jhandle_id = (jlong) handle_id;
+    *(anilt::recheck_progress_t **)&jprogress = (anilt::recheck_progress_t *) &progress; 
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[15], swigjobj, jhandle_id, jprogress);
+    jthrowable swigerror = jenv->ExceptionOccurred();
+    if (swigerror) {
+      Swig::DirectorException::raise(jenv, swigerror);
+    }
+    
+  } else {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null upcall object in anilt::event_listener_t::on_recheck_progress ");
+  }
+  if (swigjobj) jenv->DeleteLocalRef(swigjobj);
+}
+
 void SwigDirector_event_listener_t::swig_connect_director(JNIEnv *jenv, jobject jself, jclass jcls, bool swig_mem_own, bool weak_global) {
   static jclass baseclass = swig_new_global_ref(jenv, "me/him188/ani/app/torrent/anitorrent/binding/event_listener_t");
   if (!baseclass) return;
@@ -1942,15 +2143,20 @@ void SwigDirector_event_listener_t::swig_connect_director(JNIEnv *jenv, jobject
     SwigDirectorMethod(jenv, baseclass, "on_torrent_state_changed", "(JLme/him188/ani/app/torrent/anitorrent/binding/torrent_state_t;)V"),
     SwigDirectorMethod(jenv, baseclass, "on_block_downloading", "(JII)V"),
     SwigDirectorMethod(jenv, baseclass, "on_piece_finished", "(JI)V"),
+    SwigDirectorMethod(jenv, baseclass, "on_piece_progress", "(JLme/him188/ani/app/torrent/anitorrent/binding/piece_progress_t;)V"),
     SwigDirectorMethod(jenv, baseclass, "on_status_update", "(JLme/him188/ani/app/torrent/anitorrent/binding/torrent_stats_t;)V"),
     SwigDirectorMethod(jenv, baseclass, "on_file_completed", "(JI)V"),
     SwigDirectorMethod(jenv, baseclass, "on_torrent_removed", "(JLjava/lang/String;)V"),
-    SwigDirectorMethod(jenv, baseclass, "on_session_stats", "(JLme/him188/ani/app/torrent/anitorrent/binding/session_stats_t;)V")
+    SwigDirectorMethod(jenv, baseclass, "on_session_stats", "(JLme/him188/ani/app/torrent/anitorrent/binding/session_stats_t;)V"),
+    SwigDirectorMethod(jenv, baseclass, "on_resume_data_saved", "(JZ)V"),
+    SwigDirectorMethod(jenv, baseclass, "on_alerts_dropped", "(JJJ)V"),
+    SwigDirectorMethod(jenv, baseclass, "on_deadline_missed", "(JLme/him188/ani/app/torrent/anitorrent/binding/deadline_miss_t;)V"),
+    SwigDirectorMethod(jenv, baseclass, "on_recheck_progress", "(JLme/him188/ani/app/torrent/anitorrent/binding/recheck_progress_t;)V")
   };
   
   if (swig_set_self(jenv, jself, swig_mem_own, weak_global)) {
     bool derived = (jenv->IsSameObject(baseclass, jcls) ? false : true);
-    for (int i = 0; i < 11; ++i) {
+    for (int i = 0; i < 16; ++i) {
       swig_override[i] = false;
       if (derived) {
         jmethodID methid = jenv->GetMethodID(jcls, methods[i].name, methods[i].desc);
@@ -1985,7 +2191,7 @@ bool SwigDirector_peer_filter_t::on_filter(anilt::peer_info_t const &arg0) {
   swigjobj = swig_get_self(jenv);
   if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
     *(anilt::peer_info_t **)&jarg0 = (anilt::peer_info_t *) &arg0; 
-    jresult = (jboolean) jenv->CallStaticBooleanMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[11], swigjobj, jarg0);
+    jresult = (jboolean) jenv->CallStaticBooleanMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[16], swigjobj, jarg0);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -2039,7 +2245,7 @@ void SwigDirector_new_event_listener_t::on_new_events() {
   }
   swigjobj = swig_get_self(jenv);
   if (swigjobj && jenv->IsSameObject(swigjobj, NULL) == JNI_FALSE) {
-    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[12], swigjobj);
+    jenv->CallStaticVoidMethod(Swig::jclass_anitorrentJNI, Swig::director_method_ids[17], swigjobj);
     jthrowable swigerror = jenv->ExceptionOccurred();
     if (swigerror) {
       Swig::DirectorException::raise(jenv, swigerror);
@@ -2645,124 +2851,402 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1index_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  unsigned int arg2 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1IntVector_1_1SWIG_10(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  std::vector< int32_t > *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  if (arg1) (arg1)->index = arg2;
+  result = (std::vector< int32_t > *)new std::vector< int32_t >();
+  *(std::vector< int32_t > **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1index_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1IntVector_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  unsigned int result;
+  std::vector< int32_t > *arg1 = 0 ;
+  std::vector< int32_t > *result = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  result = (unsigned int) ((arg1)->index);
-  jresult = (jlong)result; 
+  arg1 = *(std::vector< int32_t > **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "std::vector< int32_t > const & is null");
+    return 0;
+  } 
+  result = (std::vector< int32_t > *)new std::vector< int32_t >((std::vector< int32_t > const &)*arg1);
+  *(std::vector< int32_t > **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1name_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1isEmpty(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->name = *arg2;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  result = (bool)((std::vector< int32_t > const *)arg1)->empty();
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1name_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1clear(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->name);
-  jresult = jenv->NewStringUTF(result->c_str()); 
-  return jresult;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  (arg1)->clear();
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1path_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1IntVector_1_1SWIG_12(JNIEnv *jenv, jclass jcls, jint jarg1, jint jarg2) {
+  jlong jresult = 0 ;
+  jint arg1 ;
+  int32_t *arg2 = 0 ;
+  int32_t temp2 ;
+  std::vector< int32_t > *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
+  arg1 = jarg1; 
+  temp2 = (int32_t)jarg2; 
+  arg2 = &temp2; 
+  try {
+    result = (std::vector< int32_t > *)new_std_vector_Sl_int32_t_Sg___SWIG_2(SWIG_STD_MOVE(arg1),(int32_t const &)*arg2);
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
   }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->path = *arg2;
+  *(std::vector< int32_t > **)&jresult = result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1path_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doCapacity(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->path);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  try {
+    result = std_vector_Sl_int32_t_Sg__doCapacity(arg1);
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
+  }
+  jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1offset_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  size_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doReserve(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::torrent_file_t **)&jarg1; 
-  arg2 = (size_t)jarg2; 
-  if (arg1) (arg1)->offset = arg2;
-}
-
-
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1offset_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
-  size_t result;
-  
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  try {
+    std_vector_Sl_int32_t_Sg__doReserve(arg1,SWIG_STD_MOVE(arg2));
+  } catch(std::length_error &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return ;
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return ;
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doSize(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  try {
+    result = std_vector_Sl_int32_t_Sg__doSize((std::vector< int32_t > const *)arg1);
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
+  }
+  jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doAdd_1_1SWIG_10(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  std::vector< int32_t >::value_type *arg2 = 0 ;
+  std::vector< int32_t >::value_type temp2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  temp2 = (std::vector< int32_t >::value_type)jarg2; 
+  arg2 = &temp2; 
+  std_vector_Sl_int32_t_Sg__doAdd__SWIG_0(arg1,(int32_t const &)*arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doAdd_1_1SWIG_11(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
+  std::vector< int32_t >::value_type *arg3 = 0 ;
+  std::vector< int32_t >::value_type temp3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  temp3 = (std::vector< int32_t >::value_type)jarg3; 
+  arg3 = &temp3; 
+  try {
+    std_vector_Sl_int32_t_Sg__doAdd__SWIG_1(arg1,SWIG_STD_MOVE(arg2),(int32_t const &)*arg3);
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return ;
+  }
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doRemove(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
+  std::vector< int32_t >::value_type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  try {
+    result = (std::vector< int32_t >::value_type)std_vector_Sl_int32_t_Sg__doRemove(arg1,SWIG_STD_MOVE(arg2));
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doGet(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jint jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
+  std::vector< int32_t >::value_type *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  try {
+    result = (std::vector< int32_t >::value_type *) &std_vector_Sl_int32_t_Sg__doGet(arg1,SWIG_STD_MOVE(arg2));
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
+  }
+  jresult = (jint)*result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doSet(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  jint jresult = 0 ;
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
+  std::vector< int32_t >::value_type *arg3 = 0 ;
+  std::vector< int32_t >::value_type temp3 ;
+  std::vector< int32_t >::value_type result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  temp3 = (std::vector< int32_t >::value_type)jarg3; 
+  arg3 = &temp3; 
+  try {
+    result = (std::vector< int32_t >::value_type)std_vector_Sl_int32_t_Sg__doSet(arg1,SWIG_STD_MOVE(arg2),(int32_t const &)*arg3);
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return 0;
+  }
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_IntVector_1doRemoveRange(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  jint arg2 ;
+  jint arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  arg2 = jarg2; 
+  arg3 = jarg3; 
+  try {
+    std_vector_Sl_int32_t_Sg__doRemoveRange(arg1,SWIG_STD_MOVE(arg2),SWIG_STD_MOVE(arg3));
+  } catch(std::out_of_range &_e) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIndexOutOfBoundsException, (&_e)->what());
+    return ;
+  }
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1IntVector(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  std::vector< int32_t > *arg1 = (std::vector< int32_t > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(std::vector< int32_t > **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1index_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  unsigned int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  if (arg1) (arg1)->index = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1index_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  result = (unsigned int) ((arg1)->index);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1name_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->name = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1name_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->name);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1path_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->path = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1path_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->path);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1offset_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  size_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_file_t **)&jarg1; 
+  arg2 = (size_t)jarg2; 
+  if (arg1) (arg1)->offset = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1file_1t_1offset_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_file_t *arg1 = (anilt::torrent_file_t *) 0 ;
+  size_t result;
+  
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
@@ -3247,305 +3731,123 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  unsigned int arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsTotal_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = (unsigned int)jarg2; 
-  if (arg1) (arg1)->id = arg2;
+  result = (anilt::torrent_stats_field_t)anilt::kStatsTotal;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  unsigned int result;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsTotalDone_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (unsigned int) ((arg1)->id);
-  jresult = (jlong)result; 
+  result = (anilt::torrent_stats_field_t)anilt::kStatsTotalDone;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1info_1view(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  anilt::torrent_info_t *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsTotalUpload_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (anilt::torrent_info_t *)((anilt::torrent_handle_t const *)arg1)->get_info_view();
-  *(anilt::torrent_info_t **)&jresult = result; 
+  result = (anilt::torrent_stats_field_t)anilt::kStatsTotalUpload;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReloadFileSuccess_1get(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsAllTimeUpload_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::torrent_handle_t::reload_file_result_t result;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::torrent_handle_t::reload_file_result_t)anilt::torrent_handle_t::kReloadFileSuccess;
+  result = (anilt::torrent_stats_field_t)anilt::kStatsAllTimeUpload;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1reload_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsAllTimeDownload_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  anilt::torrent_handle_t::reload_file_result_t result;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (anilt::torrent_handle_t::reload_file_result_t)(arg1)->reload_file();
+  result = (anilt::torrent_stats_field_t)anilt::kStatsAllTimeDownload;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1is_1valid(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jboolean jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  bool result;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsDownloadPayloadRate_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (bool)((anilt::torrent_handle_t const *)arg1)->is_valid();
-  jresult = (jboolean)result; 
+  result = (anilt::torrent_stats_field_t)anilt::kStatsDownloadPayloadRate;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1state(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsUploadPayloadRate_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  int result;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (int)((anilt::torrent_handle_t const *)arg1)->get_state();
+  result = (anilt::torrent_stats_field_t)anilt::kStatsUploadPayloadRate;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1status_1updates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->post_status_updates();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1save_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->post_save_resume();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1file_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->post_file_progress();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1piece_1deadline(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  int arg2 ;
-  int arg3 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  arg3 = (int)jarg3; 
-  ((anilt::torrent_handle_t const *)arg1)->set_piece_deadline(arg2,arg3);
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1reset_1piece_1deadline(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  int32_t arg2 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = (int32_t)jarg2; 
-  ((anilt::torrent_handle_t const *)arg1)->reset_piece_deadline(arg2);
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1clear_1piece_1deadlines(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->clear_piece_deadlines();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1peer_1endgame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  bool arg2 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = jarg2 ? true : false; 
-  ((anilt::torrent_handle_t const *)arg1)->set_peer_endgame(arg2);
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1add_1tracker(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jshort jarg3, jshort jarg4) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  std::string *arg2 = 0 ;
-  std::uint8_t arg3 = (std::uint8_t) 0 ;
-  std::uint8_t arg4 = (std::uint8_t) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  arg3 = (std::uint8_t)jarg3; 
-  arg4 = (std::uint8_t)jarg4; 
-  ((anilt::torrent_handle_t const *)arg1)->add_tracker((std::string const &)*arg2,arg3,arg4);
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->resume();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1ignore_1all_1files(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  ((anilt::torrent_handle_t const *)arg1)->ignore_all_files();
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1file_1priority(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jshort jarg3) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  int arg2 ;
-  uint8_t arg3 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  arg3 = (uint8_t)jarg3; 
-  ((anilt::torrent_handle_t const *)arg1)->set_file_priority(arg2,arg3);
-}
-
-
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1peers(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  std::vector< anilt::peer_info_t > *arg2 = 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  arg2 = *(std::vector< anilt::peer_info_t > **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "std::vector< anilt::peer_info_t > & is null");
-    return ;
-  } 
-  ((anilt::torrent_handle_t const *)arg1)->get_peers(*arg2);
-}
-
-
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1make_1magnet_1uri(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
-  std::string result;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsTotalPayloadDownload_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  result = (arg1)->make_magnet_uri();
-  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  result = (anilt::torrent_stats_field_t)anilt::kStatsTotalPayloadDownload;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1torrent_1handle_1t(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  anilt::torrent_handle_t *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsTotalPayloadUpload_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::torrent_handle_t *)new anilt::torrent_handle_t();
-  *(anilt::torrent_handle_t **)&jresult = result; 
+  result = (anilt::torrent_stats_field_t)anilt::kStatsTotalPayloadUpload;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1torrent_1handle_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStatsProgress_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_stats_field_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
-  delete arg1;
+  result = (anilt::torrent_stats_field_t)anilt::kStatsProgress;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
@@ -3829,6 +4131,34 @@ SWIGEXPORT jfloat JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anit
 }
 
 
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1stats_1t_1changed_1fields_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_stats_t *arg1 = (anilt::torrent_stats_t *) 0 ;
+  uint32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_stats_t **)&jarg1; 
+  arg2 = (uint32_t)jarg2; 
+  if (arg1) (arg1)->changed_fields = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1stats_1t_1changed_1fields_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_stats_t *arg1 = (anilt::torrent_stats_t *) 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_stats_t **)&jarg1; 
+  result = (uint32_t) ((arg1)->changed_fields);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
 SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1torrent_1stats_1t(JNIEnv *jenv, jclass jcls) {
   jlong jresult = 0 ;
   anilt::torrent_stats_t *result = 0 ;
@@ -3851,1352 +4181,5599 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1payload_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventTorrentAdded_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->download_payload_rate = arg2;
+  result = (anilt::event_kind_t)anilt::kEventTorrentAdded;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1payload_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventChecked_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int result;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  result = (int) ((arg1)->download_payload_rate);
+  result = (anilt::event_kind_t)anilt::kEventChecked;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1uploaded_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventMetadataReceived_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->total_uploaded_bytes = arg2;
+  result = (anilt::event_kind_t)anilt::kEventMetadataReceived;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1uploaded_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventSaveResumeData_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int result;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  result = (int) ((arg1)->total_uploaded_bytes);
+  result = (anilt::event_kind_t)anilt::kEventSaveResumeData;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1payload_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventTorrentStateChanged_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->upload_payload_rate = arg2;
+  result = (anilt::event_kind_t)anilt::kEventTorrentStateChanged;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1payload_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventBlockDownloading_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int result;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  result = (int) ((arg1)->upload_payload_rate);
+  result = (anilt::event_kind_t)anilt::kEventBlockDownloading;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1downloaded_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventPieceFinished_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->total_downloaded_bytes = arg2;
+  result = (anilt::event_kind_t)anilt::kEventPieceFinished;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1downloaded_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventStatusUpdate_1get(JNIEnv *jenv, jclass jcls) {
   jint jresult = 0 ;
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
-  int result;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  result = (int) ((arg1)->total_downloaded_bytes);
+  result = (anilt::event_kind_t)anilt::kEventStatusUpdate;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1stats_1t(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  anilt::session_stats_t *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventFileCompleted_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::session_stats_t *)new anilt::session_stats_t();
-  *(anilt::session_stats_t **)&jresult = result; 
+  result = (anilt::event_kind_t)anilt::kEventFileCompleted;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1stats_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventTorrentRemoved_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::session_stats_t **)&jarg1; 
-  delete arg1;
+  result = (anilt::event_kind_t)anilt::kEventTorrentRemoved;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1resume_1data_1t_1save_1to_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::torrent_resume_data_t *arg1 = (anilt::torrent_resume_data_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventSessionStats_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::torrent_resume_data_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  ((anilt::torrent_resume_data_t const *)arg1)->save_to_file((std::string const &)*arg2);
+  result = (anilt::event_kind_t)anilt::kEventSessionStats;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_call_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  lt::alert *arg1 = (lt::alert *) 0 ;
-  libtorrent::session *arg2 = 0 ;
-  anilt::event_listener_t *arg3 = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventPieceProgress_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg3_;
-  arg1 = *(lt::alert **)&jarg1; 
-  arg2 = *(libtorrent::session **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "libtorrent::session & is null");
-    return ;
-  } 
-  arg3 = *(anilt::event_listener_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::event_listener_t & is null");
-    return ;
-  } 
-  using namespace anilt;
-  call_listener(arg1,*arg2,*arg3);
+  result = (anilt::event_kind_t)anilt::kEventPieceProgress;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1torrent_1resume_1data_1t(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  anilt::torrent_resume_data_t *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventResumeDataSaved_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::torrent_resume_data_t *)new anilt::torrent_resume_data_t();
-  *(anilt::torrent_resume_data_t **)&jresult = result; 
+  result = (anilt::event_kind_t)anilt::kEventResumeDataSaved;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1torrent_1resume_1data_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::torrent_resume_data_t *arg1 = (anilt::torrent_resume_data_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventAlertsDropped_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::torrent_resume_data_t **)&jarg1; 
-  delete arg1;
+  result = (anilt::event_kind_t)anilt::kEventAlertsDropped;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventDeadlineMissed_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  delete arg1;
+  result = (anilt::event_kind_t)anilt::kEventDeadlineMissed;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1checked(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kEventRecheckProgress_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::event_kind_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->on_checked(arg2);
+  result = (anilt::event_kind_t)anilt::kEventRecheckProgress;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1checkedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1payload_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->anilt::event_listener_t::on_checked(arg2);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->download_payload_rate = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1metadata_1received(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1payload_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->on_metadata_received(arg2);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->download_payload_rate);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1metadata_1receivedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1payload_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->anilt::event_listener_t::on_metadata_received(arg2);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->upload_payload_rate = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1added(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1payload_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->on_torrent_added(arg2);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->upload_payload_rate);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1addedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  (arg1)->anilt::event_listener_t::on_torrent_added(arg2);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->download_rate = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1save_1resume_1data(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_resume_data_t *arg3 = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1download_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
-    return ;
-  } 
-  (arg1)->on_save_resume_data(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->download_rate);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1save_1resume_1dataSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_resume_data_t *arg3 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1rate_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
-    return ;
-  } 
-  (arg1)->anilt::event_listener_t::on_save_resume_data(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->upload_rate = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1state_1changed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_state_t arg3 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1upload_1rate_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (anilt::torrent_state_t)jarg3; 
-  (arg1)->on_torrent_state_changed(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->upload_rate);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1state_1changedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_state_t arg3 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1downloaded_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (anilt::torrent_state_t)jarg3; 
-  (arg1)->anilt::event_listener_t::on_torrent_state_changed(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_downloaded_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1block_1downloading(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3, jint jarg4) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int32_t arg3 ;
-  int arg4 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1downloaded_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
-  arg4 = (int)jarg4; 
-  (arg1)->on_block_downloading(arg2,arg3,arg4);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_downloaded_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1block_1downloadingSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3, jint jarg4) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int32_t arg3 ;
-  int arg4 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1uploaded_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
-  arg4 = (int)jarg4; 
-  (arg1)->anilt::event_listener_t::on_block_downloading(arg2,arg3,arg4);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_uploaded_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1finished(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int32_t arg3 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1uploaded_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
-  (arg1)->on_piece_finished(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_uploaded_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1finishedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int32_t arg3 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1download_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int32_t)jarg3; 
-  (arg1)->anilt::event_listener_t::on_piece_finished(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_download_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1status_1update(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_stats_t *arg3 = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1download_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::torrent_stats_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_stats_t & is null");
-    return ;
-  } 
-  (arg1)->on_status_update(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_download_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1status_1updateSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::torrent_stats_t *arg3 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1upload_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::torrent_stats_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_stats_t & is null");
-    return ;
-  } 
-  (arg1)->anilt::event_listener_t::on_status_update(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_upload_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1file_1completed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int arg3 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1upload_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int)jarg3; 
-  (arg1)->on_file_completed(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_upload_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1file_1completedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  int arg3 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1wasted_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = (int)jarg3; 
-  (arg1)->anilt::event_listener_t::on_file_completed(arg2,arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->wasted_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1removed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jstring jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  char *arg3 = (char *) 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1wasted_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return ;
-  }
-  (arg1)->on_torrent_removed(arg2,(char const *)arg3);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->wasted_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1removedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jstring jarg3) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  char *arg3 = (char *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1wasted_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = 0;
-  if (jarg3) {
-    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
-    if (!arg3) return ;
-  }
-  (arg1)->anilt::event_listener_t::on_torrent_removed(arg2,(char const *)arg3);
-  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_wasted_bytes = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1session_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::session_stats_t *arg3 = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1total_1wasted_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::session_stats_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_stats_t & is null");
-    return ;
-  } 
-  (arg1)->on_session_stats(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_wasted_bytes);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1session_1statsSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
-  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
-  anilt::handle_id_t arg2 ;
-  anilt::session_stats_t *arg3 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1blocks_1read_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg3_;
-  arg1 = *(anilt::event_listener_t **)&jarg1; 
-  arg2 = (anilt::handle_id_t)jarg2; 
-  arg3 = *(anilt::session_stats_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_stats_t & is null");
-    return ;
-  } 
-  (arg1)->anilt::event_listener_t::on_session_stats(arg2,*arg3);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->blocks_read = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1blocks_1read_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::event_listener_t *result = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::event_listener_t *)new SwigDirector_event_listener_t(jenv);
-  *(anilt::event_listener_t **)&jresult = result; 
+  (void)jarg1_;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->blocks_read);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
-  anilt::event_listener_t *obj = *((anilt::event_listener_t **)&objarg);
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1blocks_1cache_1hits_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
   (void)jcls;
-  SwigDirector_event_listener_t *director = static_cast<SwigDirector_event_listener_t *>(obj);
-  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+  (void)jarg1_;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->blocks_cache_hits = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
-  anilt::event_listener_t *obj = *((anilt::event_listener_t **)&objarg);
-  SwigDirector_event_listener_t *director = dynamic_cast<SwigDirector_event_listener_t *>(obj);
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1blocks_1cache_1hits_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
   (void)jcls;
-  if (director) {
-    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
-  }
+  (void)jarg1_;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->blocks_cache_hits);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1torrent_1handle_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  uint32_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1disk_1queue_1depth_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  arg2 = (uint32_t)jarg2; 
-  if (arg1) (arg1)->torrent_handle_id = arg2;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->disk_queue_depth = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1torrent_1handle_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1disk_1queue_1depth_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  uint32_t result;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (uint32_t) ((arg1)->torrent_handle_id);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->disk_queue_depth);
   jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1peer_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::vector< char > *arg2 = (std::vector< char > *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1disk_1queued_1write_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  arg2 = *(std::vector< char > **)&jarg2; 
-  if (arg1) (arg1)->peer_id = *arg2;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->disk_queued_write_bytes = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1peer_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1disk_1queued_1write_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::vector< char > *result = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (std::vector< char > *)& ((arg1)->peer_id);
-  *(std::vector< char > **)&jresult = result; 
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->disk_queued_write_bytes);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1client_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1num_1peers_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->client = *arg2;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->num_peers = arg2;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1client_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1num_1peers_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->client);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->num_peers);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1addr_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1dht_1nodes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->ip_addr = *arg2;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->dht_nodes = arg2;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1addr_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1dht_1nodes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->ip_addr);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->dht_nodes);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1port_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  unsigned short arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1interval_1ms_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  arg2 = (unsigned short)jarg2; 
-  if (arg1) (arg1)->ip_port = arg2;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->interval_ms = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1port_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  unsigned short result;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1stats_1t_1interval_1ms_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (unsigned short) ((arg1)->ip_port);
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->interval_ms);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1stats_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::session_stats_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::session_stats_t *)new anilt::session_stats_t();
+  *(anilt::session_stats_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1stats_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::session_stats_t *arg1 = (anilt::session_stats_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::session_stats_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kLatencyNotified_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::latency_stage_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::latency_stage_t)anilt::kLatencyNotified;
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1progress_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jfloat jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  float arg2 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kLatencyPopped_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::latency_stage_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  arg2 = (float)jarg2; 
-  if (arg1) (arg1)->progress = arg2;
+  result = (anilt::latency_stage_t)anilt::kLatencyPopped;
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jfloat JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1progress_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jfloat jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  float result;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kLatencyDelivered_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::latency_stage_t result;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (float) ((arg1)->progress);
-  jresult = (jfloat)result; 
+  result = (anilt::latency_stage_t)anilt::kLatencyDelivered;
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1download_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kLatencyStageCount_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::latency_stage_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::latency_stage_t)anilt::kLatencyStageCount;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1count_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
   int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
   arg2 = (int64_t)jarg2; 
-  if (arg1) (arg1)->total_download = arg2;
+  if (arg1) (arg1)->count = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1download_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1count_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
   int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (int64_t) ((arg1)->total_download);
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->count);
   jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1upload_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1mean_1us_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
   int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
   arg2 = (int64_t)jarg2; 
-  if (arg1) (arg1)->total_upload = arg2;
+  if (arg1) (arg1)->mean_us = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1upload_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1mean_1us_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
   int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (int64_t) ((arg1)->total_upload);
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->mean_us);
   jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1flags_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  uint32_t arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p50_1us_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  arg2 = (uint32_t)jarg2; 
-  if (arg1) (arg1)->flags = arg2;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->p50_us = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1flags_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p50_1us_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
-  uint32_t result;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  result = (uint32_t) ((arg1)->flags);
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->p50_us);
   jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1peer_1info_1t(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p90_1us_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->p90_us = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p90_1us_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  anilt::peer_info_t *result = 0 ;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::peer_info_t *)new anilt::peer_info_t();
-  *(anilt::peer_info_t **)&jresult = result; 
+  (void)jarg1_;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->p90_us);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1peer_1info_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p99_1us_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::peer_info_t **)&jarg1; 
-  delete arg1;
+  (void)jarg1_;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->p99_us = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1peer_1filter_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::peer_filter_t *arg1 = (anilt::peer_filter_t *) 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1p99_1us_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::peer_filter_t **)&jarg1; 
-  delete arg1;
+  (void)jarg1_;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->p99_us);
+  jresult = (jlong)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1on_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  jboolean jresult = 0 ;
-  anilt::peer_filter_t *arg1 = (anilt::peer_filter_t *) 0 ;
-  anilt::peer_info_t *arg2 = 0 ;
-  bool result;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1max_1us_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  arg1 = *(anilt::peer_filter_t **)&jarg1; 
-  arg2 = *(anilt::peer_info_t **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::peer_info_t const & is null");
-    return 0;
-  } 
-  result = (bool)(arg1)->on_filter((anilt::peer_info_t const &)*arg2);
-  jresult = (jboolean)result; 
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->max_us = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_latency_1summary_1t_1max_1us_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  result = (int64_t) ((arg1)->max_us);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1peer_1filter_1t(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1latency_1summary_1t(JNIEnv *jenv, jclass jcls) {
   jlong jresult = 0 ;
-  anilt::peer_filter_t *result = 0 ;
+  anilt::latency_summary_t *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::peer_filter_t *)new SwigDirector_peer_filter_t(jenv);
-  *(anilt::peer_filter_t **)&jresult = result; 
+  result = (anilt::latency_summary_t *)new anilt::latency_summary_t();
+  *(anilt::latency_summary_t **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
-  anilt::peer_filter_t *obj = *((anilt::peer_filter_t **)&objarg);
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1latency_1summary_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::latency_summary_t *arg1 = (anilt::latency_summary_t *) 0 ;
+  
+  (void)jenv;
   (void)jcls;
-  SwigDirector_peer_filter_t *director = static_cast<SwigDirector_peer_filter_t *>(obj);
-  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+  arg1 = *(anilt::latency_summary_t **)&jarg1; 
+  delete arg1;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
-  anilt::peer_filter_t *obj = *((anilt::peer_filter_t **)&objarg);
-  SwigDirector_peer_filter_t *director = dynamic_cast<SwigDirector_peer_filter_t *>(obj);
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1capacity_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
   (void)jcls;
-  if (director) {
-    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
-  }
+  (void)jarg1_;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->capacity_bytes = arg2;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_parse_1peer_1info(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1capacity_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jlong jresult = 0 ;
-  lt::torrent_handle *arg1 = 0 ;
-  lt::peer_info *arg2 = 0 ;
-  anilt::peer_info_t result;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(lt::torrent_handle **)&jarg1;
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::torrent_handle const & is null");
-    return 0;
-  } 
-  arg2 = *(lt::peer_info **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::peer_info const & is null");
-    return 0;
-  } 
-  result = anilt::parse_peer_info((lt::torrent_handle const &)*arg1,(lt::peer_info const &)*arg2);
-  *(anilt::peer_info_t **)&jresult = new anilt::peer_info_t(result); 
-  return jresult;
-}
-
-
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_create_1peer_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2) {
-  jlong jresult = 0 ;
-  lt::torrent_handle *arg1 = 0 ;
-  std::function< bool (anilt::peer_info_t &) > *arg2 = 0 ;
-  std::shared_ptr< lt::torrent_plugin > result;
-  
-  (void)jenv;
-  (void)jcls;
-  arg1 = *(lt::torrent_handle **)&jarg1;
-  if (!arg1) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::torrent_handle const & is null");
-    return 0;
-  } 
-  arg2 = *(std::function< bool (anilt::peer_info_t &) > **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "std::function< bool (anilt::peer_info_t &) > const & is null");
-    return 0;
-  } 
-  result = anilt::create_peer_filter((lt::torrent_handle const &)*arg1,(std::function< bool (anilt::peer_info_t &) > const &)*arg2);
-  *(std::shared_ptr< lt::torrent_plugin > **)&jresult = new std::shared_ptr< lt::torrent_plugin >(result); 
+  (void)jarg1_;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->capacity_bytes);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1download_1rate_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1size_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->download_rate_limit = arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->size_bytes = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1download_1rate_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1size_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->download_rate_limit);
-  jresult = (jint)result; 
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->size_bytes);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1upload_1rate_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1num_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->upload_rate_limit = arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->num_pieces = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1upload_1rate_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1num_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->upload_rate_limit);
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->num_pieces);
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1seeds_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1hits_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->active_seeds = arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->hits = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1seeds_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1hits_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->active_seeds);
-  jresult = (jint)result; 
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->hits);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1downloads_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1misses_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->active_downloads = arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->misses = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1downloads_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1misses_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->active_downloads);
-  jresult = (jint)result; 
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->misses);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1user_1agent_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1evictions_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->user_agent = *arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->evictions = arg2;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1user_1agent_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1cache_1stats_1t_1evictions_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
+  int64_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->user_agent);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->evictions);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1peer_1fingerprint_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *arg2 = 0 ;
-  
-  (void)jenv;
-  (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->peer_fingerprint = *arg2;
-}
-
-
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1peer_1fingerprint_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1piece_1cache_1stats_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::piece_cache_stats_t *result = 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->peer_fingerprint);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  result = (anilt::piece_cache_stats_t *)new anilt::piece_cache_stats_t();
+  *(anilt::piece_cache_stats_t **)&jresult = result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::set< std::string > *arg2 = (std::set< std::string > *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1piece_1cache_1stats_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::piece_cache_stats_t *arg1 = (anilt::piece_cache_stats_t *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = *(std::set< std::string > **)&jarg2; 
-  if (arg1) (arg1)->dht_bootstrap_nodes_extra = *arg2;
+  arg1 = *(anilt::piece_cache_stats_t **)&jarg1; 
+  delete arg1;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jlong jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::set< std::string > *result = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1piece_1index_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (std::set< std::string > *)& ((arg1)->dht_bootstrap_nodes_extra);
-  *(std::set< std::string > **)&jresult = result; 
-  return jresult;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->piece_index = arg2;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1add(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1piece_1index_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  (arg1)->dht_bootstrap_nodes_extra_add((std::string const &)*arg2);
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  result = (int32_t) ((arg1)->piece_index);
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1trackers_1extra_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1lateness_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  if(!jarg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->trackers_extra = *arg2;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->lateness_millis = arg2;
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1trackers_1extra_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1lateness_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->trackers_extra);
-  jresult = jenv->NewStringUTF(result->c_str()); 
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  result = (int32_t) ((arg1)->lateness_millis);
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1connections_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1wait_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->connections_limit = arg2;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->wait_millis = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1connections_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1wait_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->connections_limit);
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  result = (int32_t) ((arg1)->wait_millis);
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1max_1peerlist_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1buffer_1health_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->max_peerlist_size = arg2;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->buffer_health_millis = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1max_1peerlist_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1buffer_1health_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (int) ((arg1)->max_peerlist_size);
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  result = (int32_t) ((arg1)->buffer_health_millis);
   jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1share_1ratio_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int arg2 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1on_1time_1percent_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  arg2 = (int)jarg2; 
-  if (arg1) (arg1)->share_ratio_limit = arg2;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->on_time_percent = arg2;
 }
 
 
-SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1share_1ratio_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1miss_1t_1on_1time_1percent_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   jint jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  int result;
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  result = (int32_t) ((arg1)->on_time_percent);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1deadline_1miss_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::deadline_miss_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::deadline_miss_t *)new anilt::deadline_miss_t();
+  *(anilt::deadline_miss_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1deadline_1miss_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::deadline_miss_t *arg1 = (anilt::deadline_miss_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::deadline_miss_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1finished_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->finished_pieces = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1finished_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->finished_pieces);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1missed_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->missed_pieces = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1missed_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->missed_pieces);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1miss_1ratio_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jfloat jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  float arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (float)jarg2; 
+  if (arg1) (arg1)->miss_ratio = arg2;
+}
+
+
+SWIGEXPORT jfloat JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1miss_1ratio_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jfloat jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  float result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (float) ((arg1)->miss_ratio);
+  jresult = (jfloat)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1p50_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->lateness_p50_millis = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1p50_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->lateness_p50_millis);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1p99_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->lateness_p99_millis = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1p99_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->lateness_p99_millis);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1max_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->lateness_max_millis = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1lateness_1max_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->lateness_max_millis);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1pending_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->pending_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1pending_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->pending_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1overdue_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->overdue_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1overdue_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->overdue_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1buffer_1health_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->buffer_health_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1buffer_1health_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->buffer_health_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1on_1time_1percent_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->on_time_percent = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_deadline_1stats_1t_1on_1time_1percent_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->on_time_percent);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1deadline_1stats_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::deadline_stats_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::deadline_stats_t *)new anilt::deadline_stats_t();
+  *(anilt::deadline_stats_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1deadline_1stats_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::deadline_stats_t *arg1 = (anilt::deadline_stats_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::deadline_stats_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1file_1index_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->file_index = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1file_1index_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (int32_t) ((arg1)->file_index);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1checked_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->checked_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1checked_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (int32_t) ((arg1)->checked_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1total_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->total_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1total_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (int32_t) ((arg1)->total_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1failed_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->failed_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1failed_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (int32_t) ((arg1)->failed_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1new_1failed_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  std::vector< int32_t > *arg2 = (std::vector< int32_t > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = *(std::vector< int32_t > **)&jarg2; 
+  if (arg1) (arg1)->new_failed_pieces = *arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1new_1failed_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  std::vector< int32_t > *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (std::vector< int32_t > *)& ((arg1)->new_failed_pieces);
+  *(std::vector< int32_t > **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1done_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  if (arg1) (arg1)->done = arg2;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1done_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (bool) ((arg1)->done);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1full_1recheck_1started_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  if (arg1) (arg1)->full_recheck_started = arg2;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_recheck_1progress_1t_1full_1recheck_1started_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  result = (bool) ((arg1)->full_recheck_started);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1recheck_1progress_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::recheck_progress_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::recheck_progress_t *)new anilt::recheck_progress_t();
+  *(anilt::recheck_progress_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1recheck_1progress_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::recheck_progress_t *arg1 = (anilt::recheck_progress_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::recheck_progress_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1downloading_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  std::vector< int32_t > *arg2 = (std::vector< int32_t > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  arg2 = *(std::vector< int32_t > **)&jarg2; 
+  if (arg1) (arg1)->downloading_pieces = *arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1downloading_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  std::vector< int32_t > *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  result = (std::vector< int32_t > *)& ((arg1)->downloading_pieces);
+  *(std::vector< int32_t > **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1finished_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  std::vector< int32_t > *arg2 = (std::vector< int32_t > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  arg2 = *(std::vector< int32_t > **)&jarg2; 
+  if (arg1) (arg1)->finished_pieces = *arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1finished_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  std::vector< int32_t > *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  result = (std::vector< int32_t > *)& ((arg1)->finished_pieces);
+  *(std::vector< int32_t > **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1blocks_1downloading_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->blocks_downloading = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_piece_1progress_1t_1blocks_1downloading_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  result = (int) ((arg1)->blocks_downloading);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1piece_1progress_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::piece_progress_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::piece_progress_t *)new anilt::piece_progress_t();
+  *(anilt::piece_progress_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1piece_1progress_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::piece_progress_t *arg1 = (anilt::piece_progress_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::piece_progress_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1resume_1data_1t_1save_1to_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::torrent_resume_data_t *arg1 = (anilt::torrent_resume_data_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_resume_data_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  ((anilt::torrent_resume_data_t const *)arg1)->save_to_file((std::string const &)*arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1torrent_1resume_1data_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::torrent_resume_data_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_resume_data_t *)new anilt::torrent_resume_data_t();
+  *(anilt::torrent_resume_data_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1torrent_1resume_1data_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::torrent_resume_data_t *arg1 = (anilt::torrent_resume_data_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::torrent_resume_data_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1kAllEvents_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (uint32_t)anilt::event_listener_t::kAllEvents;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1kUnknownBlockIndex_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (int)anilt::event_listener_t::kUnknownBlockIndex;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1subscribed_1events_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  uint32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (uint32_t)jarg2; 
+  if (arg1) (arg1)->subscribed_events = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1subscribed_1events_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  result = (uint32_t) ((arg1)->subscribed_events);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1checked(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_checked(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1checkedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->anilt::event_listener_t::on_checked(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1metadata_1received(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_metadata_received(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1metadata_1receivedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->anilt::event_listener_t::on_metadata_received(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1added(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_torrent_added(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1addedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->anilt::event_listener_t::on_torrent_added(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1save_1resume_1data(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_resume_data_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
+    return ;
+  } 
+  (arg1)->on_save_resume_data(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1save_1resume_1dataSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_resume_data_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_save_resume_data(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1state_1changed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_state_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (anilt::torrent_state_t)jarg3; 
+  (arg1)->on_torrent_state_changed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1state_1changedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_state_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (anilt::torrent_state_t)jarg3; 
+  (arg1)->anilt::event_listener_t::on_torrent_state_changed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1block_1downloading(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3, jint jarg4) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  int arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int)jarg4; 
+  (arg1)->on_block_downloading(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1block_1downloadingSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3, jint jarg4) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  int arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int)jarg4; 
+  (arg1)->anilt::event_listener_t::on_block_downloading(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1finished(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  (arg1)->on_piece_finished(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1finishedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  (arg1)->anilt::event_listener_t::on_piece_finished(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::piece_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::piece_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::piece_progress_t & is null");
+    return ;
+  } 
+  (arg1)->on_piece_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1piece_1progressSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::piece_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::piece_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::piece_progress_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_piece_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1status_1update(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_stats_t & is null");
+    return ;
+  } 
+  (arg1)->on_status_update(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1status_1updateSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_stats_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_status_update(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1file_1completed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int)jarg3; 
+  (arg1)->on_file_completed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1file_1completedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int)jarg3; 
+  (arg1)->anilt::event_listener_t::on_file_completed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1removed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jstring jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return ;
+  }
+  (arg1)->on_torrent_removed(arg2,(char const *)arg3);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1torrent_1removedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jstring jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return ;
+  }
+  (arg1)->anilt::event_listener_t::on_torrent_removed(arg2,(char const *)arg3);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1session_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::session_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::session_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_stats_t & is null");
+    return ;
+  } 
+  (arg1)->on_session_stats(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1session_1statsSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::session_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::session_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_stats_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_session_stats(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1resume_1data_1saved(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jboolean jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  bool arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  (arg1)->on_resume_data_saved(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1resume_1data_1savedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jboolean jarg3) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  bool arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  (arg1)->anilt::event_listener_t::on_resume_data_saved(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1alerts_1dropped(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jlong jarg4) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  uint32_t arg3 ;
+  uint32_t arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (uint32_t)jarg3; 
+  arg4 = (uint32_t)jarg4; 
+  (arg1)->on_alerts_dropped(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1alerts_1droppedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jlong jarg4) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  uint32_t arg3 ;
+  uint32_t arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (uint32_t)jarg3; 
+  arg4 = (uint32_t)jarg4; 
+  (arg1)->anilt::event_listener_t::on_alerts_dropped(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1deadline_1missed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::deadline_miss_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::deadline_miss_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::deadline_miss_t & is null");
+    return ;
+  } 
+  (arg1)->on_deadline_missed(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1deadline_1missedSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::deadline_miss_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::deadline_miss_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::deadline_miss_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_deadline_missed(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1recheck_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::recheck_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::recheck_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::recheck_progress_t & is null");
+    return ;
+  } 
+  (arg1)->on_recheck_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1on_1recheck_1progressSwigExplicitevent_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_listener_t *arg1 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::recheck_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_listener_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::recheck_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::recheck_progress_t & is null");
+    return ;
+  } 
+  (arg1)->anilt::event_listener_t::on_recheck_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::event_listener_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::event_listener_t *)new SwigDirector_event_listener_t(jenv);
+  *(anilt::event_listener_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
+  anilt::event_listener_t *obj = *((anilt::event_listener_t **)&objarg);
+  (void)jcls;
+  SwigDirector_event_listener_t *director = static_cast<SwigDirector_event_listener_t *>(obj);
+  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1listener_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
+  anilt::event_listener_t *obj = *((anilt::event_listener_t **)&objarg);
+  SwigDirector_event_listener_t *director = dynamic_cast<SwigDirector_event_listener_t *>(obj);
+  (void)jcls;
+  if (director) {
+    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1kMagic_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (uint32_t)anilt::event_buffer_t::kMagic;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1kVersion_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  uint16_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (uint16_t)anilt::event_buffer_t::kVersion;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1kBatchHeaderSize_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = anilt::event_buffer_t::kBatchHeaderSize;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1kRecordHeaderSize_1get(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = anilt::event_buffer_t::kRecordHeaderSize;
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1buffer_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::event_buffer_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::event_buffer_t *)new anilt::event_buffer_t();
+  *(anilt::event_buffer_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1read(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jlong jarg3) {
+  jlong jresult = 0 ;
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  char *arg2 = (char *) 0 ;
+  size_t arg3 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  {
+    arg2 = (char *) jenv->GetDirectBufferAddress(jarg2);
+    if (arg2 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return 0;
+    }
+  }
+  arg3 = (size_t)jarg3; 
+  result = (arg1)->read(arg2,arg3);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1next_1read_1size(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  result = ((anilt::event_buffer_t const *)arg1)->next_read_size();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1remaining(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  result = ((anilt::event_buffer_t const *)arg1)->remaining();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1clear(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  (arg1)->clear();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1checked(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_checked(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1metadata_1received(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_metadata_received(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1torrent_1added(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  (arg1)->on_torrent_added(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1save_1resume_1data(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_resume_data_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
+    return ;
+  } 
+  (arg1)->on_save_resume_data(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1torrent_1state_1changed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_state_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (anilt::torrent_state_t)jarg3; 
+  (arg1)->on_torrent_state_changed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1block_1downloading(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3, jint jarg4) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  int arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  arg4 = (int)jarg4; 
+  (arg1)->on_block_downloading(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1piece_1finished(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int32_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int32_t)jarg3; 
+  (arg1)->on_piece_finished(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1piece_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::piece_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::piece_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::piece_progress_t & is null");
+    return ;
+  } 
+  (arg1)->on_piece_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1status_1update(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_stats_t & is null");
+    return ;
+  } 
+  (arg1)->on_status_update(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1file_1completed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jint jarg3) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  int arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (int)jarg3; 
+  (arg1)->on_file_completed(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1torrent_1removed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jstring jarg3) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  char *arg3 = (char *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = 0;
+  if (jarg3) {
+    arg3 = (char *)jenv->GetStringUTFChars(jarg3, 0);
+    if (!arg3) return ;
+  }
+  (arg1)->on_torrent_removed(arg2,(char const *)arg3);
+  if (arg3) jenv->ReleaseStringUTFChars(jarg3, (const char *)arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1session_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::session_stats_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::session_stats_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_stats_t & is null");
+    return ;
+  } 
+  (arg1)->on_session_stats(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1resume_1data_1saved(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jboolean jarg3) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  bool arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  (arg1)->on_resume_data_saved(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1alerts_1dropped(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jlong jarg4) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  uint32_t arg3 ;
+  uint32_t arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = (uint32_t)jarg3; 
+  arg4 = (uint32_t)jarg4; 
+  (arg1)->on_alerts_dropped(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1deadline_1missed(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::deadline_miss_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::deadline_miss_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::deadline_miss_t & is null");
+    return ;
+  } 
+  (arg1)->on_deadline_missed(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1on_1recheck_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::recheck_progress_t *arg3 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::recheck_progress_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::recheck_progress_t & is null");
+    return ;
+  } 
+  (arg1)->on_recheck_progress(arg2,*arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1event_1buffer_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::event_buffer_t *arg1 = (anilt::event_buffer_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::event_buffer_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1file_1index_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->file_index = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1file_1index_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->file_index);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1window_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->window_size = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1window_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->window_size);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1header_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->header_size = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1header_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int64_t) ((arg1)->header_size);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1footer_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->footer_size = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1footer_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int64_t) ((arg1)->footer_size);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1possible_1footer_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->possible_footer_size = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1possible_1footer_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int64_t) ((arg1)->possible_footer_size);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1first_1deadline_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->first_deadline_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1first_1deadline_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->first_deadline_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1deadline_1base_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->deadline_base_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1deadline_1base_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->deadline_base_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1deadline_1step_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->deadline_step_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1deadline_1step_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->deadline_step_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1safety_1margin_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->safety_margin_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1config_1t_1safety_1margin_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  result = (int) ((arg1)->safety_margin_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1streaming_1config_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::streaming_config_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::streaming_config_t *)new anilt::streaming_config_t();
+  *(anilt::streaming_config_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1streaming_1config_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::streaming_config_t *arg1 = (anilt::streaming_config_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::streaming_config_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStreamingQualityOff_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::streaming_quality_mode_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::streaming_quality_mode_t)anilt::kStreamingQualityOff;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStreamingQualityPreferFast_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::streaming_quality_mode_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::streaming_quality_mode_t)anilt::kStreamingQualityPreferFast;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kStreamingQualityAggressive_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::streaming_quality_mode_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::streaming_quality_mode_t)anilt::kStreamingQualityAggressive;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1median_1rtt_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->median_rtt_millis = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1median_1rtt_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->median_rtt_millis);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1slow_1peers_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->slow_peers = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1slow_1peers_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  result = (int32_t) ((arg1)->slow_peers);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1reassigned_1requests_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->reassigned_requests = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1reassigned_1requests_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->reassigned_requests);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1disconnected_1peers_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->disconnected_peers = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_streaming_1quality_1stats_1t_1disconnected_1peers_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  result = (int64_t) ((arg1)->disconnected_peers);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1streaming_1quality_1stats_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::streaming_quality_stats_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::streaming_quality_stats_t *)new anilt::streaming_quality_stats_t();
+  *(anilt::streaming_quality_stats_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1streaming_1quality_1stats_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::streaming_quality_stats_t *arg1 = (anilt::streaming_quality_stats_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::streaming_quality_stats_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1eta_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->eta_millis = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1eta_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (int64_t) ((arg1)->eta_millis);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1remaining_1bytes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->remaining_bytes = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1remaining_1bytes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (int64_t) ((arg1)->remaining_bytes);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1missing_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->missing_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1missing_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (int32_t) ((arg1)->missing_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1in_1flight_1pieces_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->in_flight_pieces = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1in_1flight_1pieces_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (int32_t) ((arg1)->in_flight_pieces);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1rate_1bytes_1per_1second_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->rate_bytes_per_second = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1rate_1bytes_1per_1second_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (int64_t) ((arg1)->rate_bytes_per_second);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1confidence_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jfloat jarg2) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  float arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  arg2 = (float)jarg2; 
+  if (arg1) (arg1)->confidence = arg2;
+}
+
+
+SWIGEXPORT jfloat JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_range_1eta_1t_1confidence_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jfloat jresult = 0 ;
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  float result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  result = (float) ((arg1)->confidence);
+  jresult = (jfloat)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1range_1eta_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::range_eta_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::range_eta_t *)new anilt::range_eta_t();
+  *(anilt::range_eta_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1range_1eta_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::range_eta_t *arg1 = (anilt::range_eta_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::range_eta_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kMediaContainerUnknown_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::media_container_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::media_container_t)anilt::kMediaContainerUnknown;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kMediaContainerMp4_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::media_container_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::media_container_t)anilt::kMediaContainerMp4;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_kMediaContainerMkv_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::media_container_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::media_container_t)anilt::kMediaContainerMkv;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1container_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->container = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1container_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  result = (int) ((arg1)->container);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1duration_1millis_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->duration_millis = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1duration_1millis_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  result = (int64_t) ((arg1)->duration_millis);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1num_1keyframes_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  if (arg1) (arg1)->num_keyframes = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1num_1keyframes_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  result = (int32_t) ((arg1)->num_keyframes);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1index_1offset_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->index_offset = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1index_1offset_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  result = (int64_t) ((arg1)->index_offset);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1index_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->index_size = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_media_1index_1info_1t_1index_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  result = (int64_t) ((arg1)->index_size);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1media_1index_1info_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::media_index_info_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::media_index_info_t *)new anilt::media_index_info_t();
+  *(anilt::media_index_info_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1media_1index_1info_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::media_index_info_t *arg1 = (anilt::media_index_info_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::media_index_info_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  unsigned int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (unsigned int)jarg2; 
+  if (arg1) (arg1)->id = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  unsigned int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (unsigned int) ((arg1)->id);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1info_1view(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::torrent_info_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (anilt::torrent_info_t *)((anilt::torrent_handle_t const *)arg1)->get_info_view();
+  *(anilt::torrent_info_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReloadFileSuccess_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::reload_file_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::reload_file_result_t)anilt::torrent_handle_t::kReloadFileSuccess;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1reload_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::torrent_handle_t::reload_file_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (anilt::torrent_handle_t::reload_file_result_t)(arg1)->reload_file();
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1is_1valid(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jboolean jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (bool)((anilt::torrent_handle_t const *)arg1)->is_valid();
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1state(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->get_state();
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1status_1updates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->post_status_updates();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1save_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->post_save_resume();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1post_1file_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->post_file_progress();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1piece_1deadline(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int)jarg3; 
+  ((anilt::torrent_handle_t const *)arg1)->set_piece_deadline(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1reset_1piece_1deadline(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->reset_piece_deadline(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1clear_1piece_1deadlines(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->clear_piece_deadlines();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1piece_1deadlines(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3, jint jarg4, jint jarg5, jboolean jarg6) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int32_t arg2 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  bool arg6 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int32_t)jarg2; 
+  arg3 = (int)jarg3; 
+  arg4 = (int)jarg4; 
+  arg5 = (int)jarg5; 
+  arg6 = jarg6 ? true : false; 
+  ((anilt::torrent_handle_t const *)arg1)->set_piece_deadlines(arg2,arg3,arg4,arg5,arg6);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1prioritize_1pieces(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jint jarg3) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  {
+    arg2 = (char *) jenv->GetDirectBufferAddress(jarg2);
+    if (arg2 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return ;
+    }
+  }
+  arg3 = (int)jarg3; 
+  ((anilt::torrent_handle_t const *)arg1)->prioritize_pieces(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1prioritize_1pieces_1bitmap(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jint jarg3, jshort jarg4, jshort jarg5) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  uint8_t arg4 ;
+  uint8_t arg5 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  {
+    arg2 = (char *) jenv->GetDirectBufferAddress(jarg2);
+    if (arg2 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return ;
+    }
+  }
+  arg3 = (int)jarg3; 
+  arg4 = (uint8_t)jarg4; 
+  arg5 = (uint8_t)jarg5; 
+  ((anilt::torrent_handle_t const *)arg1)->prioritize_pieces_bitmap(arg2,arg3,arg4,arg5);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1peer_1endgame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  bool arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  ((anilt::torrent_handle_t const *)arg1)->set_peer_endgame(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1configure_1peer_1endgame(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3, jint jarg4) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  int arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int)jarg3; 
+  arg4 = (int)jarg4; 
+  ((anilt::torrent_handle_t const *)arg1)->configure_peer_endgame(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1asap_1deadline_1grace(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->set_asap_deadline_grace(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1endgame_1duplicated_1requests(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (int64_t)((anilt::torrent_handle_t const *)arg1)->get_endgame_duplicated_requests();
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1streaming_1quality_1mode(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->set_streaming_quality_mode(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1streaming_1quality_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::streaming_quality_stats_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = ((anilt::torrent_handle_t const *)arg1)->get_streaming_quality_stats();
+  *(anilt::streaming_quality_stats_t **)&jresult = new anilt::streaming_quality_stats_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1deadline_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::deadline_stats_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = ((anilt::torrent_handle_t const *)arg1)->get_deadline_stats();
+  *(anilt::deadline_stats_t **)&jresult = new anilt::deadline_stats_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1reset_1deadline_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->reset_deadline_stats();
+}
+
+
+SWIGEXPORT jobject JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1piece_1state_1buffer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jobject jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::piece_state_buffer_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = ((anilt::torrent_handle_t const *)arg1)->get_piece_state_buffer();
+
+  jresult = result.data ? jenv->NewDirectByteBuffer(result.data, result.size) : nullptr;
+
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1piece_1availability(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jint jarg3) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  {
+    arg2 = (char *) jenv->GetDirectBufferAddress(jarg2);
+    if (arg2 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return 0;
+    }
+  }
+  arg3 = (int)jarg3; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->get_piece_availability(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1piece_1availability_1changes(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jobject jarg2, jint jarg3) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  {
+    arg2 = (char *) jenv->GetDirectBufferAddress(jarg2);
+    if (arg2 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return 0;
+    }
+  }
+  arg3 = (int)jarg3; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->get_piece_availability_changes(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1add_1tracker(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2, jshort jarg3, jshort jarg4) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  std::string *arg2 = 0 ;
+  std::uint8_t arg3 = (std::uint8_t) 0 ;
+  std::uint8_t arg4 = (std::uint8_t) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  arg3 = (std::uint8_t)jarg3; 
+  arg4 = (std::uint8_t)jarg4; 
+  ((anilt::torrent_handle_t const *)arg1)->add_tracker((std::string const &)*arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->resume();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1ignore_1all_1files(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->ignore_all_files();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1file_1priority(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jshort jarg3) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  uint8_t arg3 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (uint8_t)jarg3; 
+  ((anilt::torrent_handle_t const *)arg1)->set_file_priority(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1peers(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  std::vector< anilt::peer_info_t > *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = *(std::vector< anilt::peer_info_t > **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "std::vector< anilt::peer_info_t > & is null");
+    return ;
+  } 
+  ((anilt::torrent_handle_t const *)arg1)->get_peers(*arg2);
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1make_1magnet_1uri(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  std::string result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (arg1)->make_magnet_uri();
+  jresult = jenv->NewStringUTF((&result)->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReadRangeInvalidHandle_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::read_range_error_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::read_range_error_t)anilt::torrent_handle_t::kReadRangeInvalidHandle;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReadRangeInvalidArgument_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::read_range_error_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::read_range_error_t)anilt::torrent_handle_t::kReadRangeInvalidArgument;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReadRangeTimeout_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::read_range_error_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::read_range_error_t)anilt::torrent_handle_t::kReadRangeTimeout;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kReadRangeFailed_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::read_range_error_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::read_range_error_t)anilt::torrent_handle_t::kReadRangeFailed;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1read_1range(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3, jobject jarg4, jint jarg5, jint jarg6) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int64_t arg3 ;
+  char *arg4 = (char *) 0 ;
+  int arg5 ;
+  int arg6 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  {
+    arg4 = (char *) jenv->GetDirectBufferAddress(jarg4);
+    if (arg4 == NULL) {
+      SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.ByteBuffer direct byte buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+      return 0;
+    }
+  }
+  arg5 = (int)jarg5; 
+  arg6 = (int)jarg6; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->read_range(arg2,arg3,arg4,arg5,arg6);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1start_1streaming(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jboolean jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::streaming_config_t *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = *(anilt::streaming_config_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::streaming_config_t const & is null");
+    return 0;
+  } 
+  result = (bool)((anilt::torrent_handle_t const *)arg1)->start_streaming((anilt::streaming_config_t const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1seek_1streaming(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->seek_streaming(arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1stop_1streaming(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->stop_streaming();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1update_1streaming_1playback(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jfloat jarg4) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int64_t arg2 ;
+  int64_t arg3 ;
+  float arg4 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  arg4 = (float)jarg4; 
+  ((anilt::torrent_handle_t const *)arg1)->update_streaming_playback(arg2,arg3,arg4);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1estimate_1range_1ready(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3, jlong jarg4) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int64_t arg3 ;
+  int64_t arg4 ;
+  anilt::range_eta_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  arg4 = (int64_t)jarg4; 
+  result = ((anilt::torrent_handle_t const *)arg1)->estimate_range_ready(arg2,arg3,arg4);
+  *(anilt::range_eta_t **)&jresult = new anilt::range_eta_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1next_1file_1prefetch(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->set_next_file_prefetch(arg2);
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1prefetch_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->get_prefetch_file();
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1is_1streaming_1piece(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  result = (bool)((anilt::torrent_handle_t const *)arg1)->is_streaming_piece(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1set_1piece_1cache_1size(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  ((anilt::torrent_handle_t const *)arg1)->set_piece_cache_size(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1piece_1cache_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  anilt::piece_cache_stats_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  result = ((anilt::torrent_handle_t const *)arg1)->get_piece_cache_stats();
+  *(anilt::piece_cache_stats_t **)&jresult = new anilt::piece_cache_stats_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexReady_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexReady;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexInvalidHandle_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexInvalidHandle;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexInvalidArgument_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexInvalidArgument;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexTimeout_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexTimeout;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexFailed_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexFailed;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kMediaIndexUnsupported_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::media_index_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::media_index_result_t)anilt::torrent_handle_t::kMediaIndexUnsupported;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckStarted_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckStarted;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckNothingToCheck_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckNothingToCheck;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckInvalidHandle_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckInvalidHandle;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckInvalidArgument_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckInvalidArgument;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckBusy_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckBusy;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1kRecheckUnsupported_1get(JNIEnv *jenv, jclass jcls) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t::recheck_result_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t::recheck_result_t)anilt::torrent_handle_t::kRecheckUnsupported;
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1recheck_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jboolean jarg3) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  bool arg3 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = jarg3 ? true : false; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->recheck_file(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1cancel_1recheck_1file(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  ((anilt::torrent_handle_t const *)arg1)->cancel_recheck_file();
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1load_1media_1index(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int arg3 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int)jarg3; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->load_media_index(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1get_1media_1index_1info(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  anilt::media_index_info_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  result = ((anilt::torrent_handle_t const *)arg1)->get_media_index_info(arg2);
+  *(anilt::media_index_info_t **)&jresult = new anilt::media_index_info_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1media_1offset_1for_1time(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int64_t arg3 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  result = (int64_t)((anilt::torrent_handle_t const *)arg1)->media_offset_for_time(arg2,arg3);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_torrent_1handle_1t_1media_1piece_1for_1time(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jlong jarg3) {
+  jint jresult = 0 ;
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  int arg2 ;
+  int64_t arg3 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  arg3 = (int64_t)jarg3; 
+  result = (int)((anilt::torrent_handle_t const *)arg1)->media_piece_for_time(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1torrent_1handle_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::torrent_handle_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::torrent_handle_t *)new anilt::torrent_handle_t();
+  *(anilt::torrent_handle_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1torrent_1handle_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::torrent_handle_t *arg1 = (anilt::torrent_handle_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::torrent_handle_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1torrent_1handle_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  uint32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (uint32_t)jarg2; 
+  if (arg1) (arg1)->torrent_handle_id = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1torrent_1handle_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (uint32_t) ((arg1)->torrent_handle_id);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1peer_1id_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::vector< char > *arg2 = (std::vector< char > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = *(std::vector< char > **)&jarg2; 
+  if (arg1) (arg1)->peer_id = *arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1peer_1id_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::vector< char > *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (std::vector< char > *)& ((arg1)->peer_id);
+  *(std::vector< char > **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1client_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->client = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1client_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->client);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1addr_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->ip_addr = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1addr_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->ip_addr);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1port_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  unsigned short arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (unsigned short)jarg2; 
+  if (arg1) (arg1)->ip_port = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1ip_1port_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  unsigned short result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (unsigned short) ((arg1)->ip_port);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1progress_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jfloat jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  float arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (float)jarg2; 
+  if (arg1) (arg1)->progress = arg2;
+}
+
+
+SWIGEXPORT jfloat JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1progress_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jfloat jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  float result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (float) ((arg1)->progress);
+  jresult = (jfloat)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1download_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_download = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1download_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_download);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1upload_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->total_upload = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1total_1upload_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (int64_t) ((arg1)->total_upload);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1flags_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  uint32_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  arg2 = (uint32_t)jarg2; 
+  if (arg1) (arg1)->flags = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1info_1t_1flags_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  uint32_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  result = (uint32_t) ((arg1)->flags);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1peer_1info_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::peer_info_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::peer_info_t *)new anilt::peer_info_t();
+  *(anilt::peer_info_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1peer_1info_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::peer_info_t *arg1 = (anilt::peer_info_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::peer_info_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1peer_1filter_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::peer_filter_t *arg1 = (anilt::peer_filter_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::peer_filter_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1on_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jboolean jresult = 0 ;
+  anilt::peer_filter_t *arg1 = (anilt::peer_filter_t *) 0 ;
+  anilt::peer_info_t *arg2 = 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::peer_filter_t **)&jarg1; 
+  arg2 = *(anilt::peer_info_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::peer_info_t const & is null");
+    return 0;
+  } 
+  result = (bool)(arg1)->on_filter((anilt::peer_info_t const &)*arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1peer_1filter_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::peer_filter_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::peer_filter_t *)new SwigDirector_peer_filter_t(jenv);
+  *(anilt::peer_filter_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
+  anilt::peer_filter_t *obj = *((anilt::peer_filter_t **)&objarg);
+  (void)jcls;
+  SwigDirector_peer_filter_t *director = static_cast<SwigDirector_peer_filter_t *>(obj);
+  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_peer_1filter_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
+  anilt::peer_filter_t *obj = *((anilt::peer_filter_t **)&objarg);
+  SwigDirector_peer_filter_t *director = dynamic_cast<SwigDirector_peer_filter_t *>(obj);
+  (void)jcls;
+  if (director) {
+    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_parse_1peer_1info(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2) {
+  jlong jresult = 0 ;
+  lt::torrent_handle *arg1 = 0 ;
+  lt::peer_info *arg2 = 0 ;
+  anilt::peer_info_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(lt::torrent_handle **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::torrent_handle const & is null");
+    return 0;
+  } 
+  arg2 = *(lt::peer_info **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::peer_info const & is null");
+    return 0;
+  } 
+  result = anilt::parse_peer_info((lt::torrent_handle const &)*arg1,(lt::peer_info const &)*arg2);
+  *(anilt::peer_info_t **)&jresult = new anilt::peer_info_t(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_create_1peer_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jlong jarg2) {
+  jlong jresult = 0 ;
+  lt::torrent_handle *arg1 = 0 ;
+  std::function< bool (anilt::peer_info_t &) > *arg2 = 0 ;
+  std::shared_ptr< lt::torrent_plugin > result;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(lt::torrent_handle **)&jarg1;
+  if (!arg1) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "lt::torrent_handle const & is null");
+    return 0;
+  } 
+  arg2 = *(std::function< bool (anilt::peer_info_t &) > **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "std::function< bool (anilt::peer_info_t &) > const & is null");
+    return 0;
+  } 
+  result = anilt::create_peer_filter((lt::torrent_handle const &)*arg1,(std::function< bool (anilt::peer_info_t &) > const &)*arg2);
+  *(std::shared_ptr< lt::torrent_plugin > **)&jresult = new std::shared_ptr< lt::torrent_plugin >(result); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1download_1rate_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->download_rate_limit = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1download_1rate_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->download_rate_limit);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1upload_1rate_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->upload_rate_limit = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1upload_1rate_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->upload_rate_limit);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1seeds_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->active_seeds = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1seeds_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->active_seeds);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1downloads_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->active_downloads = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1active_1downloads_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->active_downloads);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1user_1agent_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->user_agent = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1user_1agent_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->user_agent);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1peer_1fingerprint_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->peer_fingerprint = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1peer_1fingerprint_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->peer_fingerprint);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::set< std::string > *arg2 = (std::set< std::string > *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = *(std::set< std::string > **)&jarg2; 
+  if (arg1) (arg1)->dht_bootstrap_nodes_extra = *arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::set< std::string > *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (std::set< std::string > *)& ((arg1)->dht_bootstrap_nodes_extra);
+  *(std::set< std::string > **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1dht_1bootstrap_1nodes_1extra_1add(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  (arg1)->dht_bootstrap_nodes_extra_add((std::string const &)*arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1trackers_1extra_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->trackers_extra = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1trackers_1extra_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->trackers_extra);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1connections_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->connections_limit = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1connections_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->connections_limit);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1max_1peerlist_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->max_peerlist_size = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1max_1peerlist_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->max_peerlist_size);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1share_1ratio_1limit_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->share_ratio_limit = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1share_1ratio_1limit_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
@@ -5208,329 +9785,745 @@ SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1handshake_1client_1version_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *arg2 = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1handshake_1client_1version_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jstring jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  if(!jarg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return ;
+  }
+  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
+  if (!arg2_pstr) return ;
+  std::string arg2_str(arg2_pstr);
+  arg2 = &arg2_str;
+  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
+  if (arg1) (arg1)->handshake_client_version = *arg2;
+}
+
+
+SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1handshake_1client_1version_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jstring jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  std::string *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (std::string *) & ((arg1)->handshake_client_version);
+  jresult = jenv->NewStringUTF(result->c_str()); 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1alert_1queue_1size_1min_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->alert_queue_size_min = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1alert_1queue_1size_1min_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->alert_queue_size_min);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1alert_1queue_1size_1max_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  if (arg1) (arg1)->alert_queue_size_max = arg2;
+}
+
+
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1alert_1queue_1size_1max_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int) ((arg1)->alert_queue_size_max);
+  jresult = (jint)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1piece_1cache_1size_1set(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int64_t arg2 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  arg2 = (int64_t)jarg2; 
+  if (arg1) (arg1)->piece_cache_size = arg2;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1piece_1cache_1size_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jlong jresult = 0 ;
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  int64_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  result = (int64_t) ((arg1)->piece_cache_size);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1settings_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::session_settings_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::session_settings_t *)new anilt::session_settings_t();
+  *(anilt::session_settings_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1settings_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::session_settings_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1new_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1on_1new_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
+  (arg1)->on_new_events();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1on_1new_1eventsSwigExplicitnew_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
+  (arg1)->anilt::new_event_listener_t::on_new_events();
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1new_1event_1listener_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::new_event_listener_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::new_event_listener_t *)new SwigDirector_new_event_listener_t(jenv);
+  *(anilt::new_event_listener_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
+  anilt::new_event_listener_t *obj = *((anilt::new_event_listener_t **)&objarg);
+  (void)jcls;
+  SwigDirector_new_event_listener_t *director = static_cast<SwigDirector_new_event_listener_t *>(obj);
+  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
+  anilt::new_event_listener_t *obj = *((anilt::new_event_listener_t **)&objarg);
+  SwigDirector_new_event_listener_t *director = dynamic_cast<SwigDirector_new_event_listener_t *>(obj);
+  (void)jcls;
+  if (director) {
+    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
+  }
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1t(JNIEnv *jenv, jclass jcls) {
+  jlong jresult = 0 ;
+  anilt::session_t *result = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  result = (anilt::session_t *)new anilt::session_t();
+  *(anilt::session_t **)&jresult = result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  delete arg1;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::session_settings_t *arg2 = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  if(!jarg2) {
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::session_settings_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_settings_t const & is null");
+    return ;
+  } 
+  (arg1)->start((anilt::session_settings_t const &)*arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1apply_1settings(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::session_settings_t *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::session_settings_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_settings_t const & is null");
+    return ;
+  } 
+  (arg1)->apply_settings((anilt::session_settings_t const &)*arg2);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  ((anilt::session_t const *)arg1)->resume();
+}
+
+
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start_1download(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jstring jarg4) {
+  jboolean jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::torrent_handle_t *arg2 = 0 ;
+  anilt::torrent_add_info_t *arg3 = 0 ;
+  std::string arg4 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  (void)jarg3_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::torrent_handle_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_handle_t & is null");
+    return 0;
+  } 
+  arg3 = *(anilt::torrent_add_info_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_add_info_t const & is null");
+    return 0;
+  } 
+  if(!jarg4) {
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  } 
+  const char *arg4_pstr = (const char *)jenv->GetStringUTFChars(jarg4, 0); 
+  if (!arg4_pstr) return 0;
+  (&arg4)->assign(arg4_pstr);
+  jenv->ReleaseStringUTFChars(jarg4, arg4_pstr); 
+  result = (bool)((anilt::session_t const *)arg1)->start_download(*arg2,(anilt::torrent_add_info_t const &)*arg3,arg4);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1release_1handle(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::torrent_handle_t *arg2 = 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::torrent_handle_t **)&jarg2;
+  if (!arg2) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_handle_t const & is null");
     return ;
-  }
-  const char *arg2_pstr = (const char *)jenv->GetStringUTFChars(jarg2, 0); 
-  if (!arg2_pstr) return ;
-  std::string arg2_str(arg2_pstr);
-  arg2 = &arg2_str;
-  jenv->ReleaseStringUTFChars(jarg2, arg2_pstr); 
-  if (arg1) (arg1)->handshake_client_version = *arg2;
+  } 
+  ((anilt::session_t const *)arg1)->release_handle((anilt::torrent_handle_t const &)*arg2);
 }
 
 
-SWIGEXPORT jstring JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1settings_1t_1handshake_1client_1version_1get(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  jstring jresult = 0 ;
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
-  std::string *result = 0 ;
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1new_1event_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jboolean jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::new_event_listener_t *arg2 = (anilt::new_event_listener_t *) 0 ;
+  bool result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::new_event_listener_t **)&jarg2; 
+  result = (bool)((anilt::session_t const *)arg1)->set_new_event_listener(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1process_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::event_listener_t *arg2 = (anilt::event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::event_listener_t **)&jarg2; 
+  ((anilt::session_t const *)arg1)->process_events(arg2);
+}
+
+
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1process_1events_1batched(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jlong jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::event_buffer_t *arg2 = (anilt::event_buffer_t *) 0 ;
+  size_t result;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::event_buffer_t **)&jarg2; 
+  result = ((anilt::session_t const *)arg1)->process_events_batched(arg2);
+  jresult = (jlong)result; 
+  return jresult;
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1remove_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  ((anilt::session_t const *)arg1)->remove_listener();
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1torrent_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::event_listener_t *arg3 = (anilt::event_listener_t *) 0 ;
+  
+  (void)jenv;
+  (void)jcls;
+  (void)jarg1_;
+  (void)jarg3_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::event_listener_t **)&jarg3; 
+  ((anilt::session_t const *)arg1)->set_torrent_listener(arg2,arg3);
+}
+
+
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1drop_1unrouted_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  result = (std::string *) & ((arg1)->handshake_client_version);
-  jresult = jenv->NewStringUTF(result->c_str()); 
-  return jresult;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  ((anilt::session_t const *)arg1)->set_drop_unrouted_events(arg2);
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1settings_1t(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  anilt::session_settings_t *result = 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1subscribe(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::event_listener_t *arg2 = (anilt::event_listener_t *) 0 ;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::session_settings_t *)new anilt::session_settings_t();
-  *(anilt::session_settings_t **)&jresult = result; 
-  return jresult;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::event_listener_t **)&jarg2; 
+  (arg1)->subscribe((anilt::event_listener_t const *)arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1settings_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::session_settings_t *arg1 = (anilt::session_settings_t *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1coalesce_1piece_1progress(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::session_settings_t **)&jarg1; 
-  delete arg1;
+  (void)jarg1_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = jarg2 ? true : false; 
+  (arg1)->set_coalesce_piece_progress(arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1new_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
-  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start_1alert_1pump(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jint jarg3) {
+  jboolean jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::new_event_listener_t *arg2 = (anilt::new_event_listener_t *) 0 ;
+  int arg3 = (int) 4096 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
-  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
-  delete arg1;
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::new_event_listener_t **)&jarg2; 
+  arg3 = (int)jarg3; 
+  result = (bool)(arg1)->start_alert_pump(arg2,arg3);
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1on_1new_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1stop_1alert_1pump(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
-  (arg1)->on_new_events();
+  arg1 = *(anilt::session_t **)&jarg1; 
+  (arg1)->stop_alert_pump();
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1on_1new_1eventsSwigExplicitnew_1event_1listener_1t(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
-  anilt::new_event_listener_t *arg1 = (anilt::new_event_listener_t *) 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1drain_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  jint jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::event_listener_t *arg2 = (anilt::event_listener_t *) 0 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  arg1 = *(anilt::new_event_listener_t **)&jarg1; 
-  (arg1)->anilt::new_event_listener_t::on_new_events();
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::event_listener_t **)&jarg2; 
+  result = (int)((anilt::session_t const *)arg1)->drain_events(arg2);
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1new_1event_1listener_1t(JNIEnv *jenv, jclass jcls) {
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1drain_1events_1batched(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
   jlong jresult = 0 ;
-  anilt::new_event_listener_t *result = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::event_buffer_t *arg2 = (anilt::event_buffer_t *) 0 ;
+  size_t result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::new_event_listener_t *)new SwigDirector_new_event_listener_t(jenv);
-  *(anilt::new_event_listener_t **)&jresult = result; 
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::event_buffer_t **)&jarg2; 
+  result = ((anilt::session_t const *)arg1)->drain_events_batched(arg2);
+  jresult = (jlong)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1director_1connect(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jswig_mem_own, jboolean jweak_global) {
-  anilt::new_event_listener_t *obj = *((anilt::new_event_listener_t **)&objarg);
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1peer_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::peer_filter_t *arg2 = (anilt::peer_filter_t *) 0 ;
+  
+  (void)jenv;
   (void)jcls;
-  SwigDirector_new_event_listener_t *director = static_cast<SwigDirector_new_event_listener_t *>(obj);
-  director->swig_connect_director(jenv, jself, jenv->GetObjectClass(jself), (jswig_mem_own == JNI_TRUE), (jweak_global == JNI_TRUE));
+  (void)jarg1_;
+  (void)jarg2_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = *(anilt::peer_filter_t **)&jarg2; 
+  (arg1)->set_peer_filter(arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1event_1listener_1t_1change_1ownership(JNIEnv *jenv, jclass jcls, jobject jself, jlong objarg, jboolean jtake_or_release) {
-  anilt::new_event_listener_t *obj = *((anilt::new_event_listener_t **)&objarg);
-  SwigDirector_new_event_listener_t *director = dynamic_cast<SwigDirector_new_event_listener_t *>(obj);
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1wait_1for_1alert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  int arg2 ;
+  
+  (void)jenv;
   (void)jcls;
-  if (director) {
-    director->swig_java_change_ownership(jenv, jself, jtake_or_release ? true : false);
-  }
+  (void)jarg1_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  arg2 = (int)jarg2; 
+  ((anilt::session_t const *)arg1)->wait_for_alert(arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1post_1torrent_1updates(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::session_settings_t *arg2 = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::session_settings_t **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_settings_t const & is null");
-    return ;
-  } 
-  (arg1)->start((anilt::session_settings_t const &)*arg2);
+  ((anilt::session_t const *)arg1)->post_torrent_updates();
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1apply_1settings(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1post_1session_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::session_settings_t *arg2 = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::session_settings_t **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::session_settings_t const & is null");
-    return ;
-  } 
-  (arg1)->apply_settings((anilt::session_settings_t const &)*arg2);
+  ((anilt::session_t const *)arg1)->post_session_stats();
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1resume(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1latency_1tracking(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  ((anilt::session_t const *)arg1)->resume();
+  arg2 = jarg2 ? true : false; 
+  ((anilt::session_t const *)arg1)->set_latency_tracking(arg2);
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start_1download(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_, jlong jarg3, jobject jarg3_, jstring jarg4) {
-  jboolean jresult = 0 ;
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1latency_1summary(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  jlong jresult = 0 ;
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::torrent_handle_t *arg2 = 0 ;
-  anilt::torrent_add_info_t *arg3 = 0 ;
-  std::string arg4 ;
-  bool result;
+  int arg2 ;
+  int arg3 = (int) -1 ;
+  anilt::latency_summary_t result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
-  (void)jarg3_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::torrent_handle_t **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_handle_t & is null");
-    return 0;
-  } 
-  arg3 = *(anilt::torrent_add_info_t **)&jarg3;
-  if (!arg3) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_add_info_t const & is null");
-    return 0;
-  } 
-  if(!jarg4) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
-    return 0;
-  } 
-  const char *arg4_pstr = (const char *)jenv->GetStringUTFChars(jarg4, 0); 
-  if (!arg4_pstr) return 0;
-  (&arg4)->assign(arg4_pstr);
-  jenv->ReleaseStringUTFChars(jarg4, arg4_pstr); 
-  result = (bool)((anilt::session_t const *)arg1)->start_download(*arg2,(anilt::torrent_add_info_t const &)*arg3,arg4);
-  jresult = (jboolean)result; 
+  arg2 = (int)jarg2; 
+  arg3 = (int)jarg3; 
+  result = ((anilt::session_t const *)arg1)->latency_summary(arg2,arg3);
+  *(anilt::latency_summary_t **)&jresult = new anilt::latency_summary_t(result); 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1release_1handle(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1reset_1latency_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::torrent_handle_t *arg2 = 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::torrent_handle_t **)&jarg2;
-  if (!arg2) {
-    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_handle_t const & is null");
-    return ;
-  } 
-  ((anilt::session_t const *)arg1)->release_handle((anilt::torrent_handle_t const &)*arg2);
+  ((anilt::session_t const *)arg1)->reset_latency_stats();
 }
 
 
-SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1new_1event_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
-  jboolean jresult = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1alert_1queue_1size(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::new_event_listener_t *arg2 = (anilt::new_event_listener_t *) 0 ;
-  bool result;
+  int result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::new_event_listener_t **)&jarg2; 
-  result = (bool)((anilt::session_t const *)arg1)->set_new_event_listener(arg2);
-  jresult = (jboolean)result; 
+  result = (int)((anilt::session_t const *)arg1)->alert_queue_size();
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1process_1events(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1save_1resume_1data(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jlong jarg3, jobject jarg3_, jstring jarg4) {
+  jboolean jresult = 0 ;
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::event_listener_t *arg2 = (anilt::event_listener_t *) 0 ;
+  anilt::handle_id_t arg2 ;
+  anilt::torrent_resume_data_t *arg3 = 0 ;
+  std::string *arg4 = 0 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
+  (void)jarg3_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::event_listener_t **)&jarg2; 
-  ((anilt::session_t const *)arg1)->process_events(arg2);
+  arg2 = (anilt::handle_id_t)jarg2; 
+  arg3 = *(anilt::torrent_resume_data_t **)&jarg3;
+  if (!arg3) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "anilt::torrent_resume_data_t & is null");
+    return 0;
+  } 
+  if(!jarg4) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+    return 0;
+  }
+  const char *arg4_pstr = (const char *)jenv->GetStringUTFChars(jarg4, 0); 
+  if (!arg4_pstr) return 0;
+  std::string arg4_str(arg4_pstr);
+  arg4 = &arg4_str;
+  jenv->ReleaseStringUTFChars(jarg4, arg4_pstr); 
+  result = (bool)((anilt::session_t const *)arg1)->save_resume_data(arg2,*arg3,(std::string const &)*arg4);
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1remove_1listener(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT jboolean JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1flush_1resume_1data(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+  jboolean jresult = 0 ;
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  int arg2 ;
+  bool result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  ((anilt::session_t const *)arg1)->remove_listener();
+  arg2 = (int)jarg2; 
+  result = (bool)((anilt::session_t const *)arg1)->flush_resume_data(arg2);
+  jresult = (jboolean)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1peer_1filter(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2, jobject jarg2_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1set_1resume_1data_1fsync(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jboolean jarg2) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  anilt::peer_filter_t *arg2 = (anilt::peer_filter_t *) 0 ;
+  bool arg2 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
-  (void)jarg2_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  arg2 = *(anilt::peer_filter_t **)&jarg2; 
-  (arg1)->set_peer_filter(arg2);
+  arg2 = jarg2 ? true : false; 
+  ((anilt::session_t const *)arg1)->set_resume_data_fsync(arg2);
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1wait_1for_1alert(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2) {
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1start_1http_1server(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jint jarg2, jint jarg3) {
+  jint jresult = 0 ;
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
-  int arg2 ;
+  int arg2 = (int) 0 ;
+  int arg3 = (int) 60000 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(anilt::session_t **)&jarg1; 
   arg2 = (int)jarg2; 
-  ((anilt::session_t const *)arg1)->wait_for_alert(arg2);
+  arg3 = (int)jarg3; 
+  result = (int)(arg1)->start_http_server(arg2,arg3);
+  jresult = (jint)result; 
+  return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1post_1session_1stats(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1stop_1http_1server(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
   
   (void)jenv;
   (void)jcls;
   (void)jarg1_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  ((anilt::session_t const *)arg1)->post_session_stats();
+  (arg1)->stop_http_server();
 }
 
 
-SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_new_1session_1t(JNIEnv *jenv, jclass jcls) {
-  jlong jresult = 0 ;
-  anilt::session_t *result = 0 ;
+SWIGEXPORT jint JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1http_1server_1port(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_) {
+  jint jresult = 0 ;
+  anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  int result;
   
   (void)jenv;
   (void)jcls;
-  result = (anilt::session_t *)new anilt::session_t();
-  *(anilt::session_t **)&jresult = result; 
+  (void)jarg1_;
+  arg1 = *(anilt::session_t **)&jarg1; 
+  result = (int)((anilt::session_t const *)arg1)->http_server_port();
+  jresult = (jint)result; 
   return jresult;
 }
 
 
-SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_delete_1session_1t(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_session_1t_1release_1piece_1state_1buffer(JNIEnv *jenv, jclass jcls, jlong jarg1, jobject jarg1_, jlong jarg2) {
   anilt::session_t *arg1 = (anilt::session_t *) 0 ;
+  anilt::handle_id_t arg2 ;
   
   (void)jenv;
   (void)jcls;
+  (void)jarg1_;
   arg1 = *(anilt::session_t **)&jarg1; 
-  delete arg1;
+  arg2 = (anilt::handle_id_t)jarg2; 
+  ((anilt::session_t const *)arg1)->release_piece_state_buffer(arg2);
 }
 
 
@@ -5553,13 +10546,21 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
 }
 
 
+SWIGEXPORT jlong JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_event_1buffer_1t_1SWIGUpcast(JNIEnv *jenv, jclass jcls, jlong jarg1) {
+    jlong baseptr = 0;
+    (void)jenv;
+    (void)jcls;
+    *(anilt::event_listener_t **)&baseptr = *(anilt::event_buffer_t **)&jarg1;
+    return baseptr;
+}
+
 SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitorrentJNI_swig_1module_1init(JNIEnv *jenv, jclass jcls) {
   int i;
   
   static struct {
     const char *method;
     const char *signature;
-  } methods[13] = {
+  } methods[18] = {
     {
       "SwigDirector_event_listener_t_on_checked", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;J)V" 
     },
@@ -5581,6 +10582,9 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
     {
       "SwigDirector_event_listener_t_on_piece_finished", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JI)V" 
     },
+    {
+      "SwigDirector_event_listener_t_on_piece_progress", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJ)V" 
+    },
     {
       "SwigDirector_event_listener_t_on_status_update", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJ)V" 
     },
@@ -5593,6 +10597,18 @@ SWIGEXPORT void JNICALL Java_me_him188_ani_app_torrent_anitorrent_binding_anitor
     {
       "SwigDirector_event_listener_t_on_session_stats", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJ)V" 
     },
+    {
+      "SwigDirector_event_listener_t_on_resume_data_saved", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JZ)V" 
+    },
+    {
+      "SwigDirector_event_listener_t_on_alerts_dropped", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJJ)V" 
+    },
+    {
+      "SwigDirector_event_listener_t_on_deadline_missed", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJ)V" 
+    },
+    {
+      "SwigDirector_event_listener_t_on_recheck_progress", "(Lme/him188/ani/app/torrent/anitorrent/binding/event_listener_t;JJ)V" 
+    },
     {
       "SwigDirector_peer_filter_t_on_filter", "(Lme/him188/ani/app/torrent/anitorrent/binding/peer_filter_t;J)Z" 
     },
@@ -23,16 +23,21 @@ public:
     virtual void on_torrent_state_changed(anilt::handle_id_t handle_id,anilt::torrent_state_t state);
     virtual void on_block_downloading(anilt::handle_id_t handle_id,int32_t piece_index,int block_index);
     virtual void on_piece_finished(anilt::handle_id_t handle_id,int32_t piece_index);
+    virtual void on_piece_progress(anilt::handle_id_t handle_id,anilt::piece_progress_t &progress);
     virtual void on_status_update(anilt::handle_id_t handle_id,anilt::torrent_stats_t &stats);
     virtual void on_file_completed(anilt::handle_id_t handle_id,int file_index);
     virtual void on_torrent_removed(anilt::handle_id_t handle_id,char const *torrent_name);
     virtual void on_session_stats(anilt::handle_id_t handle_id,anilt::session_stats_t &stats);
+    virtual void on_resume_data_saved(anilt::handle_id_t handle_id,bool success);
+    virtual void on_alerts_dropped(anilt::handle_id_t handle_id,uint32_t dropped_events,uint32_t dropped_categories);
+    virtual void on_deadline_missed(anilt::handle_id_t handle_id,anilt::deadline_miss_t &miss);
+    virtual void on_recheck_progress(anilt::handle_id_t handle_id,anilt::recheck_progress_t &progress);
 public:
     bool swig_overrides(int n) {
-      return (n < 11 ? swig_override[n] : false);
+      return (n < 16 ? swig_override[n] : false);
     }
 protected:
-    Swig::BoolArray<11> swig_override;
+    Swig::BoolArray<16> swig_override;
 };
 
 class SwigDirector_peer_filter_t : public anilt::peer_filter_t, public Swig::Director {
@@ -10,10 +10,6 @@
 package me.him188.ani.app.torrent.anitorrent.binding;
 
 public class anitorrent {
-  public static void call_listener(SWIGTYPE_p_lt__alert alert, SWIGTYPE_p_libtorrent__session session, event_listener_t listener) {
-    anitorrentJNI.call_listener(SWIGTYPE_p_lt__alert.getCPtr(alert), SWIGTYPE_p_libtorrent__session.getCPtr(session), event_listener_t.getCPtr(listener), listener);
-  }
-
   public static peer_info_t parse_peer_info(SWIGTYPE_p_lt__torrent_handle th, SWIGTYPE_p_lt__peer_info info) {
     return new peer_info_t(anitorrentJNI.parse_peer_info(SWIGTYPE_p_lt__torrent_handle.getCPtr(th), SWIGTYPE_p_lt__peer_info.getCPtr(info)), true);
   }
@@ -40,6 +40,21 @@ public class anitorrentJNI {
   public final static native char CharVector_doSet(long jarg1, CharVector jarg1_, int jarg2, char jarg3);
   public final static native void CharVector_doRemoveRange(long jarg1, CharVector jarg1_, int jarg2, int jarg3);
   public final static native void delete_CharVector(long jarg1);
+  public final static native long new_IntVector__SWIG_0();
+  public final static native long new_IntVector__SWIG_1(long jarg1, IntVector jarg1_);
+  public final static native boolean IntVector_isEmpty(long jarg1, IntVector jarg1_);
+  public final static native void IntVector_clear(long jarg1, IntVector jarg1_);
+  public final static native long new_IntVector__SWIG_2(int jarg1, int jarg2);
+  public final static native int IntVector_doCapacity(long jarg1, IntVector jarg1_);
+  public final static native void IntVector_doReserve(long jarg1, IntVector jarg1_, int jarg2);
+  public final static native int IntVector_doSize(long jarg1, IntVector jarg1_);
+  public final static native void IntVector_doAdd__SWIG_0(long jarg1, IntVector jarg1_, int jarg2);
+  public final static native void IntVector_doAdd__SWIG_1(long jarg1, IntVector jarg1_, int jarg2, int jarg3);
+  public final static native int IntVector_doRemove(long jarg1, IntVector jarg1_, int jarg2);
+  public final static native int IntVector_doGet(long jarg1, IntVector jarg1_, int jarg2);
+  public final static native int IntVector_doSet(long jarg1, IntVector jarg1_, int jarg2, int jarg3);
+  public final static native void IntVector_doRemoveRange(long jarg1, IntVector jarg1_, int jarg2, int jarg3);
+  public final static native void delete_IntVector(long jarg1);
   public final static native void torrent_file_t_index_set(long jarg1, torrent_file_t jarg1_, long jarg2);
   public final static native long torrent_file_t_index_get(long jarg1, torrent_file_t jarg1_);
   public final static native void torrent_file_t_name_set(long jarg1, torrent_file_t jarg1_, String jarg2);
@@ -81,28 +96,16 @@ public class anitorrentJNI {
   public final static native int torrent_add_info_t_kKindTorrentFile_get();
   public final static native long new_torrent_add_info_t();
   public final static native void delete_torrent_add_info_t(long jarg1);
-  public final static native void torrent_handle_t_id_set(long jarg1, torrent_handle_t jarg1_, long jarg2);
-  public final static native long torrent_handle_t_id_get(long jarg1, torrent_handle_t jarg1_);
-  public final static native long torrent_handle_t_get_info_view(long jarg1, torrent_handle_t jarg1_);
-  public final static native int torrent_handle_t_kReloadFileSuccess_get();
-  public final static native int torrent_handle_t_reload_file(long jarg1, torrent_handle_t jarg1_);
-  public final static native boolean torrent_handle_t_is_valid(long jarg1, torrent_handle_t jarg1_);
-  public final static native int torrent_handle_t_get_state(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_post_status_updates(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_post_save_resume(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_post_file_progress(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_set_piece_deadline(long jarg1, torrent_handle_t jarg1_, int jarg2, int jarg3);
-  public final static native void torrent_handle_t_reset_piece_deadline(long jarg1, torrent_handle_t jarg1_, int jarg2);
-  public final static native void torrent_handle_t_clear_piece_deadlines(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_set_peer_endgame(long jarg1, torrent_handle_t jarg1_, boolean jarg2);
-  public final static native void torrent_handle_t_add_tracker(long jarg1, torrent_handle_t jarg1_, String jarg2, short jarg3, short jarg4);
-  public final static native void torrent_handle_t_resume(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_ignore_all_files(long jarg1, torrent_handle_t jarg1_);
-  public final static native void torrent_handle_t_set_file_priority(long jarg1, torrent_handle_t jarg1_, int jarg2, short jarg3);
-  public final static native void torrent_handle_t_get_peers(long jarg1, torrent_handle_t jarg1_, long jarg2, PeerInfoList jarg2_);
-  public final static native String torrent_handle_t_make_magnet_uri(long jarg1, torrent_handle_t jarg1_);
-  public final static native long new_torrent_handle_t();
-  public final static native void delete_torrent_handle_t(long jarg1);
+  public final static native int kStatsTotal_get();
+  public final static native int kStatsTotalDone_get();
+  public final static native int kStatsTotalUpload_get();
+  public final static native int kStatsAllTimeUpload_get();
+  public final static native int kStatsAllTimeDownload_get();
+  public final static native int kStatsDownloadPayloadRate_get();
+  public final static native int kStatsUploadPayloadRate_get();
+  public final static native int kStatsTotalPayloadDownload_get();
+  public final static native int kStatsTotalPayloadUpload_get();
+  public final static native int kStatsProgress_get();
   public final static native void torrent_stats_t_total_set(long jarg1, torrent_stats_t jarg1_, long jarg2);
   public final static native long torrent_stats_t_total_get(long jarg1, torrent_stats_t jarg1_);
   public final static native void torrent_stats_t_total_done_set(long jarg1, torrent_stats_t jarg1_, long jarg2);
@@ -123,23 +126,160 @@ public class anitorrentJNI {
   public final static native long torrent_stats_t_total_payload_upload_get(long jarg1, torrent_stats_t jarg1_);
   public final static native void torrent_stats_t_progress_set(long jarg1, torrent_stats_t jarg1_, float jarg2);
   public final static native float torrent_stats_t_progress_get(long jarg1, torrent_stats_t jarg1_);
+  public final static native void torrent_stats_t_changed_fields_set(long jarg1, torrent_stats_t jarg1_, long jarg2);
+  public final static native long torrent_stats_t_changed_fields_get(long jarg1, torrent_stats_t jarg1_);
   public final static native long new_torrent_stats_t();
   public final static native void delete_torrent_stats_t(long jarg1);
-  public final static native void session_stats_t_download_payload_rate_set(long jarg1, session_stats_t jarg1_, int jarg2);
-  public final static native int session_stats_t_download_payload_rate_get(long jarg1, session_stats_t jarg1_);
-  public final static native void session_stats_t_total_uploaded_bytes_set(long jarg1, session_stats_t jarg1_, int jarg2);
-  public final static native int session_stats_t_total_uploaded_bytes_get(long jarg1, session_stats_t jarg1_);
-  public final static native void session_stats_t_upload_payload_rate_set(long jarg1, session_stats_t jarg1_, int jarg2);
-  public final static native int session_stats_t_upload_payload_rate_get(long jarg1, session_stats_t jarg1_);
-  public final static native void session_stats_t_total_downloaded_bytes_set(long jarg1, session_stats_t jarg1_, int jarg2);
-  public final static native int session_stats_t_total_downloaded_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native int kEventTorrentAdded_get();
+  public final static native int kEventChecked_get();
+  public final static native int kEventMetadataReceived_get();
+  public final static native int kEventSaveResumeData_get();
+  public final static native int kEventTorrentStateChanged_get();
+  public final static native int kEventBlockDownloading_get();
+  public final static native int kEventPieceFinished_get();
+  public final static native int kEventStatusUpdate_get();
+  public final static native int kEventFileCompleted_get();
+  public final static native int kEventTorrentRemoved_get();
+  public final static native int kEventSessionStats_get();
+  public final static native int kEventPieceProgress_get();
+  public final static native int kEventResumeDataSaved_get();
+  public final static native int kEventAlertsDropped_get();
+  public final static native int kEventDeadlineMissed_get();
+  public final static native int kEventRecheckProgress_get();
+  public final static native void session_stats_t_download_payload_rate_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_download_payload_rate_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_upload_payload_rate_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_upload_payload_rate_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_download_rate_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_download_rate_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_upload_rate_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_upload_rate_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_total_downloaded_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_total_downloaded_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_total_uploaded_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_total_uploaded_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_total_download_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_total_download_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_total_upload_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_total_upload_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_wasted_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_wasted_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_total_wasted_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_total_wasted_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_blocks_read_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_blocks_read_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_blocks_cache_hits_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_blocks_cache_hits_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_disk_queue_depth_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_disk_queue_depth_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_disk_queued_write_bytes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_disk_queued_write_bytes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_num_peers_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_num_peers_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_dht_nodes_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_dht_nodes_get(long jarg1, session_stats_t jarg1_);
+  public final static native void session_stats_t_interval_ms_set(long jarg1, session_stats_t jarg1_, long jarg2);
+  public final static native long session_stats_t_interval_ms_get(long jarg1, session_stats_t jarg1_);
   public final static native long new_session_stats_t();
   public final static native void delete_session_stats_t(long jarg1);
+  public final static native int kLatencyNotified_get();
+  public final static native int kLatencyPopped_get();
+  public final static native int kLatencyDelivered_get();
+  public final static native int kLatencyStageCount_get();
+  public final static native void latency_summary_t_count_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_count_get(long jarg1, latency_summary_t jarg1_);
+  public final static native void latency_summary_t_mean_us_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_mean_us_get(long jarg1, latency_summary_t jarg1_);
+  public final static native void latency_summary_t_p50_us_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_p50_us_get(long jarg1, latency_summary_t jarg1_);
+  public final static native void latency_summary_t_p90_us_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_p90_us_get(long jarg1, latency_summary_t jarg1_);
+  public final static native void latency_summary_t_p99_us_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_p99_us_get(long jarg1, latency_summary_t jarg1_);
+  public final static native void latency_summary_t_max_us_set(long jarg1, latency_summary_t jarg1_, long jarg2);
+  public final static native long latency_summary_t_max_us_get(long jarg1, latency_summary_t jarg1_);
+  public final static native long new_latency_summary_t();
+  public final static native void delete_latency_summary_t(long jarg1);
+  public final static native void piece_cache_stats_t_capacity_bytes_set(long jarg1, piece_cache_stats_t jarg1_, long jarg2);
+  public final static native long piece_cache_stats_t_capacity_bytes_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native void piece_cache_stats_t_size_bytes_set(long jarg1, piece_cache_stats_t jarg1_, long jarg2);
+  public final static native long piece_cache_stats_t_size_bytes_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native void piece_cache_stats_t_num_pieces_set(long jarg1, piece_cache_stats_t jarg1_, int jarg2);
+  public final static native int piece_cache_stats_t_num_pieces_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native void piece_cache_stats_t_hits_set(long jarg1, piece_cache_stats_t jarg1_, long jarg2);
+  public final static native long piece_cache_stats_t_hits_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native void piece_cache_stats_t_misses_set(long jarg1, piece_cache_stats_t jarg1_, long jarg2);
+  public final static native long piece_cache_stats_t_misses_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native void piece_cache_stats_t_evictions_set(long jarg1, piece_cache_stats_t jarg1_, long jarg2);
+  public final static native long piece_cache_stats_t_evictions_get(long jarg1, piece_cache_stats_t jarg1_);
+  public final static native long new_piece_cache_stats_t();
+  public final static native void delete_piece_cache_stats_t(long jarg1);
+  public final static native void deadline_miss_t_piece_index_set(long jarg1, deadline_miss_t jarg1_, int jarg2);
+  public final static native int deadline_miss_t_piece_index_get(long jarg1, deadline_miss_t jarg1_);
+  public final static native void deadline_miss_t_lateness_millis_set(long jarg1, deadline_miss_t jarg1_, int jarg2);
+  public final static native int deadline_miss_t_lateness_millis_get(long jarg1, deadline_miss_t jarg1_);
+  public final static native void deadline_miss_t_wait_millis_set(long jarg1, deadline_miss_t jarg1_, int jarg2);
+  public final static native int deadline_miss_t_wait_millis_get(long jarg1, deadline_miss_t jarg1_);
+  public final static native void deadline_miss_t_buffer_health_millis_set(long jarg1, deadline_miss_t jarg1_, int jarg2);
+  public final static native int deadline_miss_t_buffer_health_millis_get(long jarg1, deadline_miss_t jarg1_);
+  public final static native void deadline_miss_t_on_time_percent_set(long jarg1, deadline_miss_t jarg1_, int jarg2);
+  public final static native int deadline_miss_t_on_time_percent_get(long jarg1, deadline_miss_t jarg1_);
+  public final static native long new_deadline_miss_t();
+  public final static native void delete_deadline_miss_t(long jarg1);
+  public final static native void deadline_stats_t_finished_pieces_set(long jarg1, deadline_stats_t jarg1_, long jarg2);
+  public final static native long deadline_stats_t_finished_pieces_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_missed_pieces_set(long jarg1, deadline_stats_t jarg1_, long jarg2);
+  public final static native long deadline_stats_t_missed_pieces_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_miss_ratio_set(long jarg1, deadline_stats_t jarg1_, float jarg2);
+  public final static native float deadline_stats_t_miss_ratio_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_lateness_p50_millis_set(long jarg1, deadline_stats_t jarg1_, long jarg2);
+  public final static native long deadline_stats_t_lateness_p50_millis_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_lateness_p99_millis_set(long jarg1, deadline_stats_t jarg1_, long jarg2);
+  public final static native long deadline_stats_t_lateness_p99_millis_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_lateness_max_millis_set(long jarg1, deadline_stats_t jarg1_, long jarg2);
+  public final static native long deadline_stats_t_lateness_max_millis_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_pending_pieces_set(long jarg1, deadline_stats_t jarg1_, int jarg2);
+  public final static native int deadline_stats_t_pending_pieces_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_overdue_pieces_set(long jarg1, deadline_stats_t jarg1_, int jarg2);
+  public final static native int deadline_stats_t_overdue_pieces_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_buffer_health_millis_set(long jarg1, deadline_stats_t jarg1_, int jarg2);
+  public final static native int deadline_stats_t_buffer_health_millis_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native void deadline_stats_t_on_time_percent_set(long jarg1, deadline_stats_t jarg1_, int jarg2);
+  public final static native int deadline_stats_t_on_time_percent_get(long jarg1, deadline_stats_t jarg1_);
+  public final static native long new_deadline_stats_t();
+  public final static native void delete_deadline_stats_t(long jarg1);
+  public final static native void recheck_progress_t_file_index_set(long jarg1, recheck_progress_t jarg1_, int jarg2);
+  public final static native int recheck_progress_t_file_index_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_checked_pieces_set(long jarg1, recheck_progress_t jarg1_, int jarg2);
+  public final static native int recheck_progress_t_checked_pieces_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_total_pieces_set(long jarg1, recheck_progress_t jarg1_, int jarg2);
+  public final static native int recheck_progress_t_total_pieces_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_failed_pieces_set(long jarg1, recheck_progress_t jarg1_, int jarg2);
+  public final static native int recheck_progress_t_failed_pieces_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_new_failed_pieces_set(long jarg1, recheck_progress_t jarg1_, long jarg2, IntVector jarg2_);
+  public final static native long recheck_progress_t_new_failed_pieces_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_done_set(long jarg1, recheck_progress_t jarg1_, boolean jarg2);
+  public final static native boolean recheck_progress_t_done_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native void recheck_progress_t_full_recheck_started_set(long jarg1, recheck_progress_t jarg1_, boolean jarg2);
+  public final static native boolean recheck_progress_t_full_recheck_started_get(long jarg1, recheck_progress_t jarg1_);
+  public final static native long new_recheck_progress_t();
+  public final static native void delete_recheck_progress_t(long jarg1);
+  public final static native void piece_progress_t_downloading_pieces_set(long jarg1, piece_progress_t jarg1_, long jarg2, IntVector jarg2_);
+  public final static native long piece_progress_t_downloading_pieces_get(long jarg1, piece_progress_t jarg1_);
+  public final static native void piece_progress_t_finished_pieces_set(long jarg1, piece_progress_t jarg1_, long jarg2, IntVector jarg2_);
+  public final static native long piece_progress_t_finished_pieces_get(long jarg1, piece_progress_t jarg1_);
+  public final static native void piece_progress_t_blocks_downloading_set(long jarg1, piece_progress_t jarg1_, int jarg2);
+  public final static native int piece_progress_t_blocks_downloading_get(long jarg1, piece_progress_t jarg1_);
+  public final static native long new_piece_progress_t();
+  public final static native void delete_piece_progress_t(long jarg1);
   public final static native void torrent_resume_data_t_save_to_file(long jarg1, torrent_resume_data_t jarg1_, String jarg2);
-  public final static native void call_listener(long jarg1, long jarg2, long jarg3, event_listener_t jarg3_);
   public final static native long new_torrent_resume_data_t();
   public final static native void delete_torrent_resume_data_t(long jarg1);
+  public final static native long event_listener_t_kAllEvents_get();
+  public final static native int event_listener_t_kUnknownBlockIndex_get();
   public final static native void delete_event_listener_t(long jarg1);
+  public final static native void event_listener_t_subscribed_events_set(long jarg1, event_listener_t jarg1_, long jarg2);
+  public final static native long event_listener_t_subscribed_events_get(long jarg1, event_listener_t jarg1_);
   public final static native void event_listener_t_on_checked(long jarg1, event_listener_t jarg1_, long jarg2);
   public final static native void event_listener_t_on_checkedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2);
   public final static native void event_listener_t_on_metadata_received(long jarg1, event_listener_t jarg1_, long jarg2);
@@ -154,6 +294,8 @@ public class anitorrentJNI {
   public final static native void event_listener_t_on_block_downloadingSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, int jarg3, int jarg4);
   public final static native void event_listener_t_on_piece_finished(long jarg1, event_listener_t jarg1_, long jarg2, int jarg3);
   public final static native void event_listener_t_on_piece_finishedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, int jarg3);
+  public final static native void event_listener_t_on_piece_progress(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, piece_progress_t jarg3_);
+  public final static native void event_listener_t_on_piece_progressSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, piece_progress_t jarg3_);
   public final static native void event_listener_t_on_status_update(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, torrent_stats_t jarg3_);
   public final static native void event_listener_t_on_status_updateSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, torrent_stats_t jarg3_);
   public final static native void event_listener_t_on_file_completed(long jarg1, event_listener_t jarg1_, long jarg2, int jarg3);
@@ -162,9 +304,173 @@ public class anitorrentJNI {
   public final static native void event_listener_t_on_torrent_removedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, String jarg3);
   public final static native void event_listener_t_on_session_stats(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, session_stats_t jarg3_);
   public final static native void event_listener_t_on_session_statsSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, session_stats_t jarg3_);
+  public final static native void event_listener_t_on_resume_data_saved(long jarg1, event_listener_t jarg1_, long jarg2, boolean jarg3);
+  public final static native void event_listener_t_on_resume_data_savedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, boolean jarg3);
+  public final static native void event_listener_t_on_alerts_dropped(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, long jarg4);
+  public final static native void event_listener_t_on_alerts_droppedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, long jarg4);
+  public final static native void event_listener_t_on_deadline_missed(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, deadline_miss_t jarg3_);
+  public final static native void event_listener_t_on_deadline_missedSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, deadline_miss_t jarg3_);
+  public final static native void event_listener_t_on_recheck_progress(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, recheck_progress_t jarg3_);
+  public final static native void event_listener_t_on_recheck_progressSwigExplicitevent_listener_t(long jarg1, event_listener_t jarg1_, long jarg2, long jarg3, recheck_progress_t jarg3_);
   public final static native long new_event_listener_t();
   public final static native void event_listener_t_director_connect(event_listener_t obj, long cptr, boolean mem_own, boolean weak_global);
   public final static native void event_listener_t_change_ownership(event_listener_t obj, long cptr, boolean take_or_release);
+  public final static native long event_buffer_t_kMagic_get();
+  public final static native int event_buffer_t_kVersion_get();
+  public final static native long event_buffer_t_kBatchHeaderSize_get();
+  public final static native long event_buffer_t_kRecordHeaderSize_get();
+  public final static native long new_event_buffer_t();
+  public final static native long event_buffer_t_read(long jarg1, event_buffer_t jarg1_, java.nio.ByteBuffer jarg2, long jarg3);
+  public final static native long event_buffer_t_next_read_size(long jarg1, event_buffer_t jarg1_);
+  public final static native long event_buffer_t_remaining(long jarg1, event_buffer_t jarg1_);
+  public final static native void event_buffer_t_clear(long jarg1, event_buffer_t jarg1_);
+  public final static native void event_buffer_t_on_checked(long jarg1, event_buffer_t jarg1_, long jarg2);
+  public final static native void event_buffer_t_on_metadata_received(long jarg1, event_buffer_t jarg1_, long jarg2);
+  public final static native void event_buffer_t_on_torrent_added(long jarg1, event_buffer_t jarg1_, long jarg2);
+  public final static native void event_buffer_t_on_save_resume_data(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, torrent_resume_data_t jarg3_);
+  public final static native void event_buffer_t_on_torrent_state_changed(long jarg1, event_buffer_t jarg1_, long jarg2, int jarg3);
+  public final static native void event_buffer_t_on_block_downloading(long jarg1, event_buffer_t jarg1_, long jarg2, int jarg3, int jarg4);
+  public final static native void event_buffer_t_on_piece_finished(long jarg1, event_buffer_t jarg1_, long jarg2, int jarg3);
+  public final static native void event_buffer_t_on_piece_progress(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, piece_progress_t jarg3_);
+  public final static native void event_buffer_t_on_status_update(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, torrent_stats_t jarg3_);
+  public final static native void event_buffer_t_on_file_completed(long jarg1, event_buffer_t jarg1_, long jarg2, int jarg3);
+  public final static native void event_buffer_t_on_torrent_removed(long jarg1, event_buffer_t jarg1_, long jarg2, String jarg3);
+  public final static native void event_buffer_t_on_session_stats(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, session_stats_t jarg3_);
+  public final static native void event_buffer_t_on_resume_data_saved(long jarg1, event_buffer_t jarg1_, long jarg2, boolean jarg3);
+  public final static native void event_buffer_t_on_alerts_dropped(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, long jarg4);
+  public final static native void event_buffer_t_on_deadline_missed(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, deadline_miss_t jarg3_);
+  public final static native void event_buffer_t_on_recheck_progress(long jarg1, event_buffer_t jarg1_, long jarg2, long jarg3, recheck_progress_t jarg3_);
+  public final static native void delete_event_buffer_t(long jarg1);
+  public final static native void streaming_config_t_file_index_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_file_index_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_window_size_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_window_size_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_header_size_set(long jarg1, streaming_config_t jarg1_, long jarg2);
+  public final static native long streaming_config_t_header_size_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_footer_size_set(long jarg1, streaming_config_t jarg1_, long jarg2);
+  public final static native long streaming_config_t_footer_size_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_possible_footer_size_set(long jarg1, streaming_config_t jarg1_, long jarg2);
+  public final static native long streaming_config_t_possible_footer_size_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_first_deadline_millis_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_first_deadline_millis_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_deadline_base_millis_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_deadline_base_millis_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_deadline_step_millis_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_deadline_step_millis_get(long jarg1, streaming_config_t jarg1_);
+  public final static native void streaming_config_t_safety_margin_millis_set(long jarg1, streaming_config_t jarg1_, int jarg2);
+  public final static native int streaming_config_t_safety_margin_millis_get(long jarg1, streaming_config_t jarg1_);
+  public final static native long new_streaming_config_t();
+  public final static native void delete_streaming_config_t(long jarg1);
+  public final static native int kStreamingQualityOff_get();
+  public final static native int kStreamingQualityPreferFast_get();
+  public final static native int kStreamingQualityAggressive_get();
+  public final static native void streaming_quality_stats_t_median_rtt_millis_set(long jarg1, streaming_quality_stats_t jarg1_, int jarg2);
+  public final static native int streaming_quality_stats_t_median_rtt_millis_get(long jarg1, streaming_quality_stats_t jarg1_);
+  public final static native void streaming_quality_stats_t_slow_peers_set(long jarg1, streaming_quality_stats_t jarg1_, int jarg2);
+  public final static native int streaming_quality_stats_t_slow_peers_get(long jarg1, streaming_quality_stats_t jarg1_);
+  public final static native void streaming_quality_stats_t_reassigned_requests_set(long jarg1, streaming_quality_stats_t jarg1_, long jarg2);
+  public final static native long streaming_quality_stats_t_reassigned_requests_get(long jarg1, streaming_quality_stats_t jarg1_);
+  public final static native void streaming_quality_stats_t_disconnected_peers_set(long jarg1, streaming_quality_stats_t jarg1_, long jarg2);
+  public final static native long streaming_quality_stats_t_disconnected_peers_get(long jarg1, streaming_quality_stats_t jarg1_);
+  public final static native long new_streaming_quality_stats_t();
+  public final static native void delete_streaming_quality_stats_t(long jarg1);
+  public final static native void range_eta_t_eta_millis_set(long jarg1, range_eta_t jarg1_, long jarg2);
+  public final static native long range_eta_t_eta_millis_get(long jarg1, range_eta_t jarg1_);
+  public final static native void range_eta_t_remaining_bytes_set(long jarg1, range_eta_t jarg1_, long jarg2);
+  public final static native long range_eta_t_remaining_bytes_get(long jarg1, range_eta_t jarg1_);
+  public final static native void range_eta_t_missing_pieces_set(long jarg1, range_eta_t jarg1_, int jarg2);
+  public final static native int range_eta_t_missing_pieces_get(long jarg1, range_eta_t jarg1_);
+  public final static native void range_eta_t_in_flight_pieces_set(long jarg1, range_eta_t jarg1_, int jarg2);
+  public final static native int range_eta_t_in_flight_pieces_get(long jarg1, range_eta_t jarg1_);
+  public final static native void range_eta_t_rate_bytes_per_second_set(long jarg1, range_eta_t jarg1_, long jarg2);
+  public final static native long range_eta_t_rate_bytes_per_second_get(long jarg1, range_eta_t jarg1_);
+  public final static native void range_eta_t_confidence_set(long jarg1, range_eta_t jarg1_, float jarg2);
+  public final static native float range_eta_t_confidence_get(long jarg1, range_eta_t jarg1_);
+  public final static native long new_range_eta_t();
+  public final static native void delete_range_eta_t(long jarg1);
+  public final static native int kMediaContainerUnknown_get();
+  public final static native int kMediaContainerMp4_get();
+  public final static native int kMediaContainerMkv_get();
+  public final static native void media_index_info_t_container_set(long jarg1, media_index_info_t jarg1_, int jarg2);
+  public final static native int media_index_info_t_container_get(long jarg1, media_index_info_t jarg1_);
+  public final static native void media_index_info_t_duration_millis_set(long jarg1, media_index_info_t jarg1_, long jarg2);
+  public final static native long media_index_info_t_duration_millis_get(long jarg1, media_index_info_t jarg1_);
+  public final static native void media_index_info_t_num_keyframes_set(long jarg1, media_index_info_t jarg1_, int jarg2);
+  public final static native int media_index_info_t_num_keyframes_get(long jarg1, media_index_info_t jarg1_);
+  public final static native void media_index_info_t_index_offset_set(long jarg1, media_index_info_t jarg1_, long jarg2);
+  public final static native long media_index_info_t_index_offset_get(long jarg1, media_index_info_t jarg1_);
+  public final static native void media_index_info_t_index_size_set(long jarg1, media_index_info_t jarg1_, long jarg2);
+  public final static native long media_index_info_t_index_size_get(long jarg1, media_index_info_t jarg1_);
+  public final static native long new_media_index_info_t();
+  public final static native void delete_media_index_info_t(long jarg1);
+  public final static native void torrent_handle_t_id_set(long jarg1, torrent_handle_t jarg1_, long jarg2);
+  public final static native long torrent_handle_t_id_get(long jarg1, torrent_handle_t jarg1_);
+  public final static native long torrent_handle_t_get_info_view(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_kReloadFileSuccess_get();
+  public final static native int torrent_handle_t_reload_file(long jarg1, torrent_handle_t jarg1_);
+  public final static native boolean torrent_handle_t_is_valid(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_get_state(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_post_status_updates(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_post_save_resume(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_post_file_progress(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_set_piece_deadline(long jarg1, torrent_handle_t jarg1_, int jarg2, int jarg3);
+  public final static native void torrent_handle_t_reset_piece_deadline(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native void torrent_handle_t_clear_piece_deadlines(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_set_piece_deadlines(long jarg1, torrent_handle_t jarg1_, int jarg2, int jarg3, int jarg4, int jarg5, boolean jarg6);
+  public final static native void torrent_handle_t_prioritize_pieces(long jarg1, torrent_handle_t jarg1_, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void torrent_handle_t_prioritize_pieces_bitmap(long jarg1, torrent_handle_t jarg1_, java.nio.ByteBuffer jarg2, int jarg3, short jarg4, short jarg5);
+  public final static native void torrent_handle_t_set_peer_endgame(long jarg1, torrent_handle_t jarg1_, boolean jarg2);
+  public final static native void torrent_handle_t_configure_peer_endgame(long jarg1, torrent_handle_t jarg1_, int jarg2, int jarg3, int jarg4);
+  public final static native void torrent_handle_t_set_asap_deadline_grace(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native long torrent_handle_t_get_endgame_duplicated_requests(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_set_streaming_quality_mode(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native long torrent_handle_t_get_streaming_quality_stats(long jarg1, torrent_handle_t jarg1_);
+  public final static native long torrent_handle_t_get_deadline_stats(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_reset_deadline_stats(long jarg1, torrent_handle_t jarg1_);
+  public final static native java.nio.ByteBuffer torrent_handle_t_get_piece_state_buffer(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_get_piece_availability(long jarg1, torrent_handle_t jarg1_, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native int torrent_handle_t_get_piece_availability_changes(long jarg1, torrent_handle_t jarg1_, java.nio.ByteBuffer jarg2, int jarg3);
+  public final static native void torrent_handle_t_add_tracker(long jarg1, torrent_handle_t jarg1_, String jarg2, short jarg3, short jarg4);
+  public final static native void torrent_handle_t_resume(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_ignore_all_files(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_set_file_priority(long jarg1, torrent_handle_t jarg1_, int jarg2, short jarg3);
+  public final static native void torrent_handle_t_get_peers(long jarg1, torrent_handle_t jarg1_, long jarg2, PeerInfoList jarg2_);
+  public final static native String torrent_handle_t_make_magnet_uri(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_kReadRangeInvalidHandle_get();
+  public final static native int torrent_handle_t_kReadRangeInvalidArgument_get();
+  public final static native int torrent_handle_t_kReadRangeTimeout_get();
+  public final static native int torrent_handle_t_kReadRangeFailed_get();
+  public final static native int torrent_handle_t_read_range(long jarg1, torrent_handle_t jarg1_, int jarg2, long jarg3, java.nio.ByteBuffer jarg4, int jarg5, int jarg6);
+  public final static native boolean torrent_handle_t_start_streaming(long jarg1, torrent_handle_t jarg1_, long jarg2, streaming_config_t jarg2_);
+  public final static native void torrent_handle_t_seek_streaming(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native void torrent_handle_t_stop_streaming(long jarg1, torrent_handle_t jarg1_);
+  public final static native void torrent_handle_t_update_streaming_playback(long jarg1, torrent_handle_t jarg1_, long jarg2, long jarg3, float jarg4);
+  public final static native long torrent_handle_t_estimate_range_ready(long jarg1, torrent_handle_t jarg1_, int jarg2, long jarg3, long jarg4);
+  public final static native void torrent_handle_t_set_next_file_prefetch(long jarg1, torrent_handle_t jarg1_, long jarg2);
+  public final static native int torrent_handle_t_get_prefetch_file(long jarg1, torrent_handle_t jarg1_);
+  public final static native boolean torrent_handle_t_is_streaming_piece(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native void torrent_handle_t_set_piece_cache_size(long jarg1, torrent_handle_t jarg1_, long jarg2);
+  public final static native long torrent_handle_t_get_piece_cache_stats(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_kMediaIndexReady_get();
+  public final static native int torrent_handle_t_kMediaIndexInvalidHandle_get();
+  public final static native int torrent_handle_t_kMediaIndexInvalidArgument_get();
+  public final static native int torrent_handle_t_kMediaIndexTimeout_get();
+  public final static native int torrent_handle_t_kMediaIndexFailed_get();
+  public final static native int torrent_handle_t_kMediaIndexUnsupported_get();
+  public final static native int torrent_handle_t_kRecheckStarted_get();
+  public final static native int torrent_handle_t_kRecheckNothingToCheck_get();
+  public final static native int torrent_handle_t_kRecheckInvalidHandle_get();
+  public final static native int torrent_handle_t_kRecheckInvalidArgument_get();
+  public final static native int torrent_handle_t_kRecheckBusy_get();
+  public final static native int torrent_handle_t_kRecheckUnsupported_get();
+  public final static native int torrent_handle_t_recheck_file(long jarg1, torrent_handle_t jarg1_, int jarg2, boolean jarg3);
+  public final static native void torrent_handle_t_cancel_recheck_file(long jarg1, torrent_handle_t jarg1_);
+  public final static native int torrent_handle_t_load_media_index(long jarg1, torrent_handle_t jarg1_, int jarg2, int jarg3);
+  public final static native long torrent_handle_t_get_media_index_info(long jarg1, torrent_handle_t jarg1_, int jarg2);
+  public final static native long torrent_handle_t_media_offset_for_time(long jarg1, torrent_handle_t jarg1_, int jarg2, long jarg3);
+  public final static native int torrent_handle_t_media_piece_for_time(long jarg1, torrent_handle_t jarg1_, int jarg2, long jarg3);
+  public final static native long new_torrent_handle_t();
+  public final static native void delete_torrent_handle_t(long jarg1);
   public final static native void peer_info_t_torrent_handle_id_set(long jarg1, peer_info_t jarg1_, long jarg2);
   public final static native long peer_info_t_torrent_handle_id_get(long jarg1, peer_info_t jarg1_);
   public final static native void peer_info_t_peer_id_set(long jarg1, peer_info_t jarg1_, long jarg2, CharVector jarg2_);
@@ -217,6 +523,12 @@ public class anitorrentJNI {
   public final static native int session_settings_t_share_ratio_limit_get(long jarg1, session_settings_t jarg1_);
   public final static native void session_settings_t_handshake_client_version_set(long jarg1, session_settings_t jarg1_, String jarg2);
   public final static native String session_settings_t_handshake_client_version_get(long jarg1, session_settings_t jarg1_);
+  public final static native void session_settings_t_alert_queue_size_min_set(long jarg1, session_settings_t jarg1_, int jarg2);
+  public final static native int session_settings_t_alert_queue_size_min_get(long jarg1, session_settings_t jarg1_);
+  public final static native void session_settings_t_alert_queue_size_max_set(long jarg1, session_settings_t jarg1_, int jarg2);
+  public final static native int session_settings_t_alert_queue_size_max_get(long jarg1, session_settings_t jarg1_);
+  public final static native void session_settings_t_piece_cache_size_set(long jarg1, session_settings_t jarg1_, long jarg2);
+  public final static native long session_settings_t_piece_cache_size_get(long jarg1, session_settings_t jarg1_);
   public final static native long new_session_settings_t();
   public final static native void delete_session_settings_t(long jarg1);
   public final static native void delete_new_event_listener_t(long jarg1);
@@ -225,6 +537,8 @@ public class anitorrentJNI {
   public final static native long new_new_event_listener_t();
   public final static native void new_event_listener_t_director_connect(new_event_listener_t obj, long cptr, boolean mem_own, boolean weak_global);
   public final static native void new_event_listener_t_change_ownership(new_event_listener_t obj, long cptr, boolean take_or_release);
+  public final static native long new_session_t();
+  public final static native void delete_session_t(long jarg1);
   public final static native void session_t_start(long jarg1, session_t jarg1_, long jarg2, session_settings_t jarg2_);
   public final static native void session_t_apply_settings(long jarg1, session_t jarg1_, long jarg2, session_settings_t jarg2_);
   public final static native void session_t_resume(long jarg1, session_t jarg1_);
@@ -232,14 +546,34 @@ public class anitorrentJNI {
   public final static native void session_t_release_handle(long jarg1, session_t jarg1_, long jarg2, torrent_handle_t jarg2_);
   public final static native boolean session_t_set_new_event_listener(long jarg1, session_t jarg1_, long jarg2, new_event_listener_t jarg2_);
   public final static native void session_t_process_events(long jarg1, session_t jarg1_, long jarg2, event_listener_t jarg2_);
+  public final static native long session_t_process_events_batched(long jarg1, session_t jarg1_, long jarg2, event_buffer_t jarg2_);
   public final static native void session_t_remove_listener(long jarg1, session_t jarg1_);
+  public final static native void session_t_set_torrent_listener(long jarg1, session_t jarg1_, long jarg2, long jarg3, event_listener_t jarg3_);
+  public final static native void session_t_set_drop_unrouted_events(long jarg1, session_t jarg1_, boolean jarg2);
+  public final static native void session_t_subscribe(long jarg1, session_t jarg1_, long jarg2, event_listener_t jarg2_);
+  public final static native void session_t_set_coalesce_piece_progress(long jarg1, session_t jarg1_, boolean jarg2);
+  public final static native boolean session_t_start_alert_pump(long jarg1, session_t jarg1_, long jarg2, new_event_listener_t jarg2_, int jarg3);
+  public final static native void session_t_stop_alert_pump(long jarg1, session_t jarg1_);
+  public final static native int session_t_drain_events(long jarg1, session_t jarg1_, long jarg2, event_listener_t jarg2_);
+  public final static native long session_t_drain_events_batched(long jarg1, session_t jarg1_, long jarg2, event_buffer_t jarg2_);
   public final static native void session_t_set_peer_filter(long jarg1, session_t jarg1_, long jarg2, peer_filter_t jarg2_);
   public final static native void session_t_wait_for_alert(long jarg1, session_t jarg1_, int jarg2);
+  public final static native void session_t_post_torrent_updates(long jarg1, session_t jarg1_);
   public final static native void session_t_post_session_stats(long jarg1, session_t jarg1_);
-  public final static native long new_session_t();
-  public final static native void delete_session_t(long jarg1);
+  public final static native void session_t_set_latency_tracking(long jarg1, session_t jarg1_, boolean jarg2);
+  public final static native long session_t_latency_summary(long jarg1, session_t jarg1_, int jarg2, int jarg3);
+  public final static native void session_t_reset_latency_stats(long jarg1, session_t jarg1_);
+  public final static native int session_t_alert_queue_size(long jarg1, session_t jarg1_);
+  public final static native boolean session_t_save_resume_data(long jarg1, session_t jarg1_, long jarg2, long jarg3, torrent_resume_data_t jarg3_, String jarg4);
+  public final static native boolean session_t_flush_resume_data(long jarg1, session_t jarg1_, int jarg2);
+  public final static native void session_t_set_resume_data_fsync(long jarg1, session_t jarg1_, boolean jarg2);
+  public final static native int session_t_start_http_server(long jarg1, session_t jarg1_, int jarg2, int jarg3);
+  public final static native void session_t_stop_http_server(long jarg1, session_t jarg1_);
+  public final static native int session_t_http_server_port(long jarg1, session_t jarg1_);
+  public final static native void session_t_release_piece_state_buffer(long jarg1, session_t jarg1_, long jarg2);
   public final static native String lt_version();
   public final static native void install_signal_handlers();
+  public final static native long event_buffer_t_SWIGUpcast(long jarg1);
 
   public static void SwigDirector_event_listener_t_on_checked(event_listener_t jself, long handle_id) {
     jself.on_checked(handle_id);
@@ -262,6 +596,9 @@ public class anitorrentJNI {
   public static void SwigDirector_event_listener_t_on_piece_finished(event_listener_t jself, long handle_id, int piece_index) {
     jself.on_piece_finished(handle_id, piece_index);
   }
+  public static void SwigDirector_event_listener_t_on_piece_progress(event_listener_t jself, long handle_id, long progress) {
+    jself.on_piece_progress(handle_id, new piece_progress_t(progress, false));
+  }
   public static void SwigDirector_event_listener_t_on_status_update(event_listener_t jself, long handle_id, long stats) {
     jself.on_status_update(handle_id, new torrent_stats_t(stats, false));
   }
@@ -274,6 +611,18 @@ public class anitorrentJNI {
   public static void SwigDirector_event_listener_t_on_session_stats(event_listener_t jself, long handle_id, long stats) {
     jself.on_session_stats(handle_id, new session_stats_t(stats, false));
   }
+  public static void SwigDirector_event_listener_t_on_resume_data_saved(event_listener_t jself, long handle_id, boolean success) {
+    jself.on_resume_data_saved(handle_id, success);
+  }
+  public static void SwigDirector_event_listener_t_on_alerts_dropped(event_listener_t jself, long handle_id, long dropped_events, long dropped_categories) {
+    jself.on_alerts_dropped(handle_id, dropped_events, dropped_categories);
+  }
+  public static void SwigDirector_event_listener_t_on_deadline_missed(event_listener_t jself, long handle_id, long miss) {
+    jself.on_deadline_missed(handle_id, new deadline_miss_t(miss, false));
+  }
+  public static void SwigDirector_event_listener_t_on_recheck_progress(event_listener_t jself, long handle_id, long progress) {
+    jself.on_recheck_progress(handle_id, new recheck_progress_t(progress, false));
+  }
   public static boolean SwigDirector_peer_filter_t_on_filter(peer_filter_t jself, long arg0) {
     return jself.on_filter(new peer_info_t(arg0, false));
   }
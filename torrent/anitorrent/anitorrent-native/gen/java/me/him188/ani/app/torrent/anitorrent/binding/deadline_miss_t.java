@@ -0,0 +1,98 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class deadline_miss_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected deadline_miss_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(deadline_miss_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(deadline_miss_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_deadline_miss_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setPiece_index(int value) {
+    anitorrentJNI.deadline_miss_t_piece_index_set(swigCPtr, this, value);
+  }
+
+  public int getPiece_index() {
+    return anitorrentJNI.deadline_miss_t_piece_index_get(swigCPtr, this);
+  }
+
+  public void setLateness_millis(int value) {
+    anitorrentJNI.deadline_miss_t_lateness_millis_set(swigCPtr, this, value);
+  }
+
+  public int getLateness_millis() {
+    return anitorrentJNI.deadline_miss_t_lateness_millis_get(swigCPtr, this);
+  }
+
+  public void setWait_millis(int value) {
+    anitorrentJNI.deadline_miss_t_wait_millis_set(swigCPtr, this, value);
+  }
+
+  public int getWait_millis() {
+    return anitorrentJNI.deadline_miss_t_wait_millis_get(swigCPtr, this);
+  }
+
+  public void setBuffer_health_millis(int value) {
+    anitorrentJNI.deadline_miss_t_buffer_health_millis_set(swigCPtr, this, value);
+  }
+
+  public int getBuffer_health_millis() {
+    return anitorrentJNI.deadline_miss_t_buffer_health_millis_get(swigCPtr, this);
+  }
+
+  public void setOn_time_percent(int value) {
+    anitorrentJNI.deadline_miss_t_on_time_percent_set(swigCPtr, this, value);
+  }
+
+  public int getOn_time_percent() {
+    return anitorrentJNI.deadline_miss_t_on_time_percent_get(swigCPtr, this);
+  }
+
+  public deadline_miss_t() {
+    this(anitorrentJNI.new_deadline_miss_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
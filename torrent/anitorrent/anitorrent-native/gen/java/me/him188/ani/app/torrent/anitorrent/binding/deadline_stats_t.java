@@ -0,0 +1,138 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class deadline_stats_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected deadline_stats_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(deadline_stats_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(deadline_stats_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_deadline_stats_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setFinished_pieces(long value) {
+    anitorrentJNI.deadline_stats_t_finished_pieces_set(swigCPtr, this, value);
+  }
+
+  public long getFinished_pieces() {
+    return anitorrentJNI.deadline_stats_t_finished_pieces_get(swigCPtr, this);
+  }
+
+  public void setMissed_pieces(long value) {
+    anitorrentJNI.deadline_stats_t_missed_pieces_set(swigCPtr, this, value);
+  }
+
+  public long getMissed_pieces() {
+    return anitorrentJNI.deadline_stats_t_missed_pieces_get(swigCPtr, this);
+  }
+
+  public void setMiss_ratio(float value) {
+    anitorrentJNI.deadline_stats_t_miss_ratio_set(swigCPtr, this, value);
+  }
+
+  public float getMiss_ratio() {
+    return anitorrentJNI.deadline_stats_t_miss_ratio_get(swigCPtr, this);
+  }
+
+  public void setLateness_p50_millis(long value) {
+    anitorrentJNI.deadline_stats_t_lateness_p50_millis_set(swigCPtr, this, value);
+  }
+
+  public long getLateness_p50_millis() {
+    return anitorrentJNI.deadline_stats_t_lateness_p50_millis_get(swigCPtr, this);
+  }
+
+  public void setLateness_p99_millis(long value) {
+    anitorrentJNI.deadline_stats_t_lateness_p99_millis_set(swigCPtr, this, value);
+  }
+
+  public long getLateness_p99_millis() {
+    return anitorrentJNI.deadline_stats_t_lateness_p99_millis_get(swigCPtr, this);
+  }
+
+  public void setLateness_max_millis(long value) {
+    anitorrentJNI.deadline_stats_t_lateness_max_millis_set(swigCPtr, this, value);
+  }
+
+  public long getLateness_max_millis() {
+    return anitorrentJNI.deadline_stats_t_lateness_max_millis_get(swigCPtr, this);
+  }
+
+  public void setPending_pieces(int value) {
+    anitorrentJNI.deadline_stats_t_pending_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getPending_pieces() {
+    return anitorrentJNI.deadline_stats_t_pending_pieces_get(swigCPtr, this);
+  }
+
+  public void setOverdue_pieces(int value) {
+    anitorrentJNI.deadline_stats_t_overdue_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getOverdue_pieces() {
+    return anitorrentJNI.deadline_stats_t_overdue_pieces_get(swigCPtr, this);
+  }
+
+  public void setBuffer_health_millis(int value) {
+    anitorrentJNI.deadline_stats_t_buffer_health_millis_set(swigCPtr, this, value);
+  }
+
+  public int getBuffer_health_millis() {
+    return anitorrentJNI.deadline_stats_t_buffer_health_millis_get(swigCPtr, this);
+  }
+
+  public void setOn_time_percent(int value) {
+    anitorrentJNI.deadline_stats_t_on_time_percent_set(swigCPtr, this, value);
+  }
+
+  public int getOn_time_percent() {
+    return anitorrentJNI.deadline_stats_t_on_time_percent_get(swigCPtr, this);
+  }
+
+  public deadline_stats_t() {
+    this(anitorrentJNI.new_deadline_stats_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
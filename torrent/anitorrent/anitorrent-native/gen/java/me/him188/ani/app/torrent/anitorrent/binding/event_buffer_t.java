@@ -0,0 +1,145 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class event_buffer_t extends event_listener_t {
+  private transient long swigCPtr;
+
+  protected event_buffer_t(long cPtr, boolean cMemoryOwn) {
+    super(anitorrentJNI.event_buffer_t_SWIGUpcast(cPtr), cMemoryOwn);
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(event_buffer_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(event_buffer_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_event_buffer_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+    super.delete();
+  }
+
+  public event_buffer_t() {
+    this(anitorrentJNI.new_event_buffer_t(), true);
+  }
+
+  public long read(java.nio.ByteBuffer buffer, long capacity) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      return anitorrentJNI.event_buffer_t_read(swigCPtr, this, buffer, capacity);
+    }
+  }
+
+  public long next_read_size() {
+    return anitorrentJNI.event_buffer_t_next_read_size(swigCPtr, this);
+  }
+
+  public long remaining() {
+    return anitorrentJNI.event_buffer_t_remaining(swigCPtr, this);
+  }
+
+  public void clear() {
+    anitorrentJNI.event_buffer_t_clear(swigCPtr, this);
+  }
+
+  public void on_checked(long handle_id) {
+    anitorrentJNI.event_buffer_t_on_checked(swigCPtr, this, handle_id);
+  }
+
+  public void on_metadata_received(long handle_id) {
+    anitorrentJNI.event_buffer_t_on_metadata_received(swigCPtr, this, handle_id);
+  }
+
+  public void on_torrent_added(long handle_id) {
+    anitorrentJNI.event_buffer_t_on_torrent_added(swigCPtr, this, handle_id);
+  }
+
+  public void on_save_resume_data(long handle_id, torrent_resume_data_t data) {
+    anitorrentJNI.event_buffer_t_on_save_resume_data(swigCPtr, this, handle_id, torrent_resume_data_t.getCPtr(data), data);
+  }
+
+  public void on_torrent_state_changed(long handle_id, torrent_state_t state) {
+    anitorrentJNI.event_buffer_t_on_torrent_state_changed(swigCPtr, this, handle_id, state.swigValue());
+  }
+
+  public void on_block_downloading(long handle_id, int piece_index, int block_index) {
+    anitorrentJNI.event_buffer_t_on_block_downloading(swigCPtr, this, handle_id, piece_index, block_index);
+  }
+
+  public void on_piece_finished(long handle_id, int piece_index) {
+    anitorrentJNI.event_buffer_t_on_piece_finished(swigCPtr, this, handle_id, piece_index);
+  }
+
+  public void on_piece_progress(long handle_id, piece_progress_t progress) {
+    anitorrentJNI.event_buffer_t_on_piece_progress(swigCPtr, this, handle_id, piece_progress_t.getCPtr(progress), progress);
+  }
+
+  public void on_status_update(long handle_id, torrent_stats_t stats) {
+    anitorrentJNI.event_buffer_t_on_status_update(swigCPtr, this, handle_id, torrent_stats_t.getCPtr(stats), stats);
+  }
+
+  public void on_file_completed(long handle_id, int file_index) {
+    anitorrentJNI.event_buffer_t_on_file_completed(swigCPtr, this, handle_id, file_index);
+  }
+
+  public void on_torrent_removed(long handle_id, String torrent_name) {
+    anitorrentJNI.event_buffer_t_on_torrent_removed(swigCPtr, this, handle_id, torrent_name);
+  }
+
+  public void on_session_stats(long handle_id, session_stats_t stats) {
+    anitorrentJNI.event_buffer_t_on_session_stats(swigCPtr, this, handle_id, session_stats_t.getCPtr(stats), stats);
+  }
+
+  public void on_resume_data_saved(long handle_id, boolean success) {
+    anitorrentJNI.event_buffer_t_on_resume_data_saved(swigCPtr, this, handle_id, success);
+  }
+
+  public void on_alerts_dropped(long handle_id, long dropped_events, long dropped_categories) {
+    anitorrentJNI.event_buffer_t_on_alerts_dropped(swigCPtr, this, handle_id, dropped_events, dropped_categories);
+  }
+
+  public void on_deadline_missed(long handle_id, deadline_miss_t miss) {
+    anitorrentJNI.event_buffer_t_on_deadline_missed(swigCPtr, this, handle_id, deadline_miss_t.getCPtr(miss), miss);
+  }
+
+  public void on_recheck_progress(long handle_id, recheck_progress_t progress) {
+    anitorrentJNI.event_buffer_t_on_recheck_progress(swigCPtr, this, handle_id, recheck_progress_t.getCPtr(progress), progress);
+  }
+
+  public final static long kMagic = anitorrentJNI.event_buffer_t_kMagic_get();
+  public final static int kVersion = anitorrentJNI.event_buffer_t_kVersion_get();
+  public final static long kBatchHeaderSize = anitorrentJNI.event_buffer_t_kBatchHeaderSize_get();
+  public final static long kRecordHeaderSize = anitorrentJNI.event_buffer_t_kRecordHeaderSize_get();
+}
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,71 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public final class event_kind_t {
+  public final static event_kind_t kEventTorrentAdded = new event_kind_t("kEventTorrentAdded", anitorrentJNI.kEventTorrentAdded_get());
+  public final static event_kind_t kEventChecked = new event_kind_t("kEventChecked", anitorrentJNI.kEventChecked_get());
+  public final static event_kind_t kEventMetadataReceived = new event_kind_t("kEventMetadataReceived", anitorrentJNI.kEventMetadataReceived_get());
+  public final static event_kind_t kEventSaveResumeData = new event_kind_t("kEventSaveResumeData", anitorrentJNI.kEventSaveResumeData_get());
+  public final static event_kind_t kEventTorrentStateChanged = new event_kind_t("kEventTorrentStateChanged", anitorrentJNI.kEventTorrentStateChanged_get());
+  public final static event_kind_t kEventBlockDownloading = new event_kind_t("kEventBlockDownloading", anitorrentJNI.kEventBlockDownloading_get());
+  public final static event_kind_t kEventPieceFinished = new event_kind_t("kEventPieceFinished", anitorrentJNI.kEventPieceFinished_get());
+  public final static event_kind_t kEventStatusUpdate = new event_kind_t("kEventStatusUpdate", anitorrentJNI.kEventStatusUpdate_get());
+  public final static event_kind_t kEventFileCompleted = new event_kind_t("kEventFileCompleted", anitorrentJNI.kEventFileCompleted_get());
+  public final static event_kind_t kEventTorrentRemoved = new event_kind_t("kEventTorrentRemoved", anitorrentJNI.kEventTorrentRemoved_get());
+  public final static event_kind_t kEventSessionStats = new event_kind_t("kEventSessionStats", anitorrentJNI.kEventSessionStats_get());
+  public final static event_kind_t kEventPieceProgress = new event_kind_t("kEventPieceProgress", anitorrentJNI.kEventPieceProgress_get());
+  public final static event_kind_t kEventResumeDataSaved = new event_kind_t("kEventResumeDataSaved", anitorrentJNI.kEventResumeDataSaved_get());
+  public final static event_kind_t kEventAlertsDropped = new event_kind_t("kEventAlertsDropped", anitorrentJNI.kEventAlertsDropped_get());
+  public final static event_kind_t kEventDeadlineMissed = new event_kind_t("kEventDeadlineMissed", anitorrentJNI.kEventDeadlineMissed_get());
+  public final static event_kind_t kEventRecheckProgress = new event_kind_t("kEventRecheckProgress", anitorrentJNI.kEventRecheckProgress_get());
+
+  public final int swigValue() {
+    return swigValue;
+  }
+
+  public String toString() {
+    return swigName;
+  }
+
+  public static event_kind_t swigToEnum(int swigValue) {
+    if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+      return swigValues[swigValue];
+    for (int i = 0; i < swigValues.length; i++)
+      if (swigValues[i].swigValue == swigValue)
+        return swigValues[i];
+    throw new IllegalArgumentException("No enum " + event_kind_t.class + " with value " + swigValue);
+  }
+
+  private event_kind_t(String swigName) {
+    this.swigName = swigName;
+    this.swigValue = swigNext++;
+  }
+
+  private event_kind_t(String swigName, int swigValue) {
+    this.swigName = swigName;
+    this.swigValue = swigValue;
+    swigNext = swigValue+1;
+  }
+
+  private event_kind_t(String swigName, event_kind_t swigEnum) {
+    this.swigName = swigName;
+    this.swigValue = swigEnum.swigValue;
+    swigNext = this.swigValue+1;
+  }
+
+  private static event_kind_t[] swigValues = { kEventTorrentAdded, kEventChecked, kEventMetadataReceived, kEventSaveResumeData, kEventTorrentStateChanged, kEventBlockDownloading, kEventPieceFinished, kEventStatusUpdate, kEventFileCompleted, kEventTorrentRemoved, kEventSessionStats, kEventPieceProgress, kEventResumeDataSaved, kEventAlertsDropped, kEventDeadlineMissed, kEventRecheckProgress };
+  private static int swigNext = 0;
+  private final int swigValue;
+  private final String swigName;
+}
+
+
+//@formatter:on
\ No newline at end of file
@@ -64,6 +64,14 @@ public class event_listener_t {
     anitorrentJNI.event_listener_t_change_ownership(this, swigCPtr, true);
   }
 
+  public void setSubscribed_events(long value) {
+    anitorrentJNI.event_listener_t_subscribed_events_set(swigCPtr, this, value);
+  }
+
+  public long getSubscribed_events() {
+    return anitorrentJNI.event_listener_t_subscribed_events_get(swigCPtr, this);
+  }
+
   public void on_checked(long handle_id) {
     if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_checked(swigCPtr, this, handle_id); else anitorrentJNI.event_listener_t_on_checkedSwigExplicitevent_listener_t(swigCPtr, this, handle_id);
   }
@@ -92,6 +100,10 @@ public class event_listener_t {
     if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_piece_finished(swigCPtr, this, handle_id, piece_index); else anitorrentJNI.event_listener_t_on_piece_finishedSwigExplicitevent_listener_t(swigCPtr, this, handle_id, piece_index);
   }
 
+  public void on_piece_progress(long handle_id, piece_progress_t progress) {
+    if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_piece_progress(swigCPtr, this, handle_id, piece_progress_t.getCPtr(progress), progress); else anitorrentJNI.event_listener_t_on_piece_progressSwigExplicitevent_listener_t(swigCPtr, this, handle_id, piece_progress_t.getCPtr(progress), progress);
+  }
+
   public void on_status_update(long handle_id, torrent_stats_t stats) {
     if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_status_update(swigCPtr, this, handle_id, torrent_stats_t.getCPtr(stats), stats); else anitorrentJNI.event_listener_t_on_status_updateSwigExplicitevent_listener_t(swigCPtr, this, handle_id, torrent_stats_t.getCPtr(stats), stats);
   }
@@ -108,11 +120,29 @@ public class event_listener_t {
     if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_session_stats(swigCPtr, this, handle_id, session_stats_t.getCPtr(stats), stats); else anitorrentJNI.event_listener_t_on_session_statsSwigExplicitevent_listener_t(swigCPtr, this, handle_id, session_stats_t.getCPtr(stats), stats);
   }
 
+  public void on_resume_data_saved(long handle_id, boolean success) {
+    if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_resume_data_saved(swigCPtr, this, handle_id, success); else anitorrentJNI.event_listener_t_on_resume_data_savedSwigExplicitevent_listener_t(swigCPtr, this, handle_id, success);
+  }
+
+  public void on_alerts_dropped(long handle_id, long dropped_events, long dropped_categories) {
+    if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_alerts_dropped(swigCPtr, this, handle_id, dropped_events, dropped_categories); else anitorrentJNI.event_listener_t_on_alerts_droppedSwigExplicitevent_listener_t(swigCPtr, this, handle_id, dropped_events, dropped_categories);
+  }
+
+  public void on_deadline_missed(long handle_id, deadline_miss_t miss) {
+    if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_deadline_missed(swigCPtr, this, handle_id, deadline_miss_t.getCPtr(miss), miss); else anitorrentJNI.event_listener_t_on_deadline_missedSwigExplicitevent_listener_t(swigCPtr, this, handle_id, deadline_miss_t.getCPtr(miss), miss);
+  }
+
+  public void on_recheck_progress(long handle_id, recheck_progress_t progress) {
+    if (getClass() == event_listener_t.class) anitorrentJNI.event_listener_t_on_recheck_progress(swigCPtr, this, handle_id, recheck_progress_t.getCPtr(progress), progress); else anitorrentJNI.event_listener_t_on_recheck_progressSwigExplicitevent_listener_t(swigCPtr, this, handle_id, recheck_progress_t.getCPtr(progress), progress);
+  }
+
   public event_listener_t() {
     this(anitorrentJNI.new_event_listener_t(), true);
     anitorrentJNI.event_listener_t_director_connect(this, swigCPtr, true, true);
   }
 
+  public final static long kAllEvents = anitorrentJNI.event_listener_t_kAllEvents_get();
+  public final static int kUnknownBlockIndex = anitorrentJNI.event_listener_t_kUnknownBlockIndex_get();
 }
 
 //@formatter:on
\ No newline at end of file
@@ -0,0 +1,59 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public final class latency_stage_t {
+  public final static latency_stage_t kLatencyNotified = new latency_stage_t("kLatencyNotified", anitorrentJNI.kLatencyNotified_get());
+  public final static latency_stage_t kLatencyPopped = new latency_stage_t("kLatencyPopped", anitorrentJNI.kLatencyPopped_get());
+  public final static latency_stage_t kLatencyDelivered = new latency_stage_t("kLatencyDelivered", anitorrentJNI.kLatencyDelivered_get());
+  public final static latency_stage_t kLatencyStageCount = new latency_stage_t("kLatencyStageCount", anitorrentJNI.kLatencyStageCount_get());
+
+  public final int swigValue() {
+    return swigValue;
+  }
+
+  public String toString() {
+    return swigName;
+  }
+
+  public static latency_stage_t swigToEnum(int swigValue) {
+    if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+      return swigValues[swigValue];
+    for (int i = 0; i < swigValues.length; i++)
+      if (swigValues[i].swigValue == swigValue)
+        return swigValues[i];
+    throw new IllegalArgumentException("No enum " + latency_stage_t.class + " with value " + swigValue);
+  }
+
+  private latency_stage_t(String swigName) {
+    this.swigName = swigName;
+    this.swigValue = swigNext++;
+  }
+
+  private latency_stage_t(String swigName, int swigValue) {
+    this.swigName = swigName;
+    this.swigValue = swigValue;
+    swigNext = swigValue+1;
+  }
+
+  private latency_stage_t(String swigName, latency_stage_t swigEnum) {
+    this.swigName = swigName;
+    this.swigValue = swigEnum.swigValue;
+    swigNext = this.swigValue+1;
+  }
+
+  private static latency_stage_t[] swigValues = { kLatencyNotified, kLatencyPopped, kLatencyDelivered, kLatencyStageCount };
+  private static int swigNext = 0;
+  private final int swigValue;
+  private final String swigName;
+}
+
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,106 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class latency_summary_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected latency_summary_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(latency_summary_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(latency_summary_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_latency_summary_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setCount(long value) {
+    anitorrentJNI.latency_summary_t_count_set(swigCPtr, this, value);
+  }
+
+  public long getCount() {
+    return anitorrentJNI.latency_summary_t_count_get(swigCPtr, this);
+  }
+
+  public void setMean_us(long value) {
+    anitorrentJNI.latency_summary_t_mean_us_set(swigCPtr, this, value);
+  }
+
+  public long getMean_us() {
+    return anitorrentJNI.latency_summary_t_mean_us_get(swigCPtr, this);
+  }
+
+  public void setP50_us(long value) {
+    anitorrentJNI.latency_summary_t_p50_us_set(swigCPtr, this, value);
+  }
+
+  public long getP50_us() {
+    return anitorrentJNI.latency_summary_t_p50_us_get(swigCPtr, this);
+  }
+
+  public void setP90_us(long value) {
+    anitorrentJNI.latency_summary_t_p90_us_set(swigCPtr, this, value);
+  }
+
+  public long getP90_us() {
+    return anitorrentJNI.latency_summary_t_p90_us_get(swigCPtr, this);
+  }
+
+  public void setP99_us(long value) {
+    anitorrentJNI.latency_summary_t_p99_us_set(swigCPtr, this, value);
+  }
+
+  public long getP99_us() {
+    return anitorrentJNI.latency_summary_t_p99_us_get(swigCPtr, this);
+  }
+
+  public void setMax_us(long value) {
+    anitorrentJNI.latency_summary_t_max_us_set(swigCPtr, this, value);
+  }
+
+  public long getMax_us() {
+    return anitorrentJNI.latency_summary_t_max_us_get(swigCPtr, this);
+  }
+
+  public latency_summary_t() {
+    this(anitorrentJNI.new_latency_summary_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
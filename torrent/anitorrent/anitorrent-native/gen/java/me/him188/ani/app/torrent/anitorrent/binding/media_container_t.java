@@ -0,0 +1,58 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public final class media_container_t {
+  public final static media_container_t kMediaContainerUnknown = new media_container_t("kMediaContainerUnknown", anitorrentJNI.kMediaContainerUnknown_get());
+  public final static media_container_t kMediaContainerMp4 = new media_container_t("kMediaContainerMp4", anitorrentJNI.kMediaContainerMp4_get());
+  public final static media_container_t kMediaContainerMkv = new media_container_t("kMediaContainerMkv", anitorrentJNI.kMediaContainerMkv_get());
+
+  public final int swigValue() {
+    return swigValue;
+  }
+
+  public String toString() {
+    return swigName;
+  }
+
+  public static media_container_t swigToEnum(int swigValue) {
+    if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+      return swigValues[swigValue];
+    for (int i = 0; i < swigValues.length; i++)
+      if (swigValues[i].swigValue == swigValue)
+        return swigValues[i];
+    throw new IllegalArgumentException("No enum " + media_container_t.class + " with value " + swigValue);
+  }
+
+  private media_container_t(String swigName) {
+    this.swigName = swigName;
+    this.swigValue = swigNext++;
+  }
+
+  private media_container_t(String swigName, int swigValue) {
+    this.swigName = swigName;
+    this.swigValue = swigValue;
+    swigNext = swigValue+1;
+  }
+
+  private media_container_t(String swigName, media_container_t swigEnum) {
+    this.swigName = swigName;
+    this.swigValue = swigEnum.swigValue;
+    swigNext = this.swigValue+1;
+  }
+
+  private static media_container_t[] swigValues = { kMediaContainerUnknown, kMediaContainerMp4, kMediaContainerMkv };
+  private static int swigNext = 0;
+  private final int swigValue;
+  private final String swigName;
+}
+
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,98 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class media_index_info_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected media_index_info_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(media_index_info_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(media_index_info_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_media_index_info_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setContainer(int value) {
+    anitorrentJNI.media_index_info_t_container_set(swigCPtr, this, value);
+  }
+
+  public int getContainer() {
+    return anitorrentJNI.media_index_info_t_container_get(swigCPtr, this);
+  }
+
+  public void setDuration_millis(long value) {
+    anitorrentJNI.media_index_info_t_duration_millis_set(swigCPtr, this, value);
+  }
+
+  public long getDuration_millis() {
+    return anitorrentJNI.media_index_info_t_duration_millis_get(swigCPtr, this);
+  }
+
+  public void setNum_keyframes(int value) {
+    anitorrentJNI.media_index_info_t_num_keyframes_set(swigCPtr, this, value);
+  }
+
+  public int getNum_keyframes() {
+    return anitorrentJNI.media_index_info_t_num_keyframes_get(swigCPtr, this);
+  }
+
+  public void setIndex_offset(long value) {
+    anitorrentJNI.media_index_info_t_index_offset_set(swigCPtr, this, value);
+  }
+
+  public long getIndex_offset() {
+    return anitorrentJNI.media_index_info_t_index_offset_get(swigCPtr, this);
+  }
+
+  public void setIndex_size(long value) {
+    anitorrentJNI.media_index_info_t_index_size_set(swigCPtr, this, value);
+  }
+
+  public long getIndex_size() {
+    return anitorrentJNI.media_index_info_t_index_size_get(swigCPtr, this);
+  }
+
+  public media_index_info_t() {
+    this(anitorrentJNI.new_media_index_info_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
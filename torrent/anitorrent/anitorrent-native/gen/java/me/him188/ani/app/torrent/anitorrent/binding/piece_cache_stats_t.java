@@ -0,0 +1,106 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class piece_cache_stats_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected piece_cache_stats_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(piece_cache_stats_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(piece_cache_stats_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_piece_cache_stats_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setCapacity_bytes(long value) {
+    anitorrentJNI.piece_cache_stats_t_capacity_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getCapacity_bytes() {
+    return anitorrentJNI.piece_cache_stats_t_capacity_bytes_get(swigCPtr, this);
+  }
+
+  public void setSize_bytes(long value) {
+    anitorrentJNI.piece_cache_stats_t_size_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getSize_bytes() {
+    return anitorrentJNI.piece_cache_stats_t_size_bytes_get(swigCPtr, this);
+  }
+
+  public void setNum_pieces(int value) {
+    anitorrentJNI.piece_cache_stats_t_num_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getNum_pieces() {
+    return anitorrentJNI.piece_cache_stats_t_num_pieces_get(swigCPtr, this);
+  }
+
+  public void setHits(long value) {
+    anitorrentJNI.piece_cache_stats_t_hits_set(swigCPtr, this, value);
+  }
+
+  public long getHits() {
+    return anitorrentJNI.piece_cache_stats_t_hits_get(swigCPtr, this);
+  }
+
+  public void setMisses(long value) {
+    anitorrentJNI.piece_cache_stats_t_misses_set(swigCPtr, this, value);
+  }
+
+  public long getMisses() {
+    return anitorrentJNI.piece_cache_stats_t_misses_get(swigCPtr, this);
+  }
+
+  public void setEvictions(long value) {
+    anitorrentJNI.piece_cache_stats_t_evictions_set(swigCPtr, this, value);
+  }
+
+  public long getEvictions() {
+    return anitorrentJNI.piece_cache_stats_t_evictions_get(swigCPtr, this);
+  }
+
+  public piece_cache_stats_t() {
+    this(anitorrentJNI.new_piece_cache_stats_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,84 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class piece_progress_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected piece_progress_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(piece_progress_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(piece_progress_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_piece_progress_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setDownloading_pieces(IntVector value) {
+    anitorrentJNI.piece_progress_t_downloading_pieces_set(swigCPtr, this, IntVector.getCPtr(value), value);
+  }
+
+  public IntVector getDownloading_pieces() {
+    long cPtr = anitorrentJNI.piece_progress_t_downloading_pieces_get(swigCPtr, this);
+    return (cPtr == 0) ? null : new IntVector(cPtr, false);
+  }
+
+  public void setFinished_pieces(IntVector value) {
+    anitorrentJNI.piece_progress_t_finished_pieces_set(swigCPtr, this, IntVector.getCPtr(value), value);
+  }
+
+  public IntVector getFinished_pieces() {
+    long cPtr = anitorrentJNI.piece_progress_t_finished_pieces_get(swigCPtr, this);
+    return (cPtr == 0) ? null : new IntVector(cPtr, false);
+  }
+
+  public void setBlocks_downloading(int value) {
+    anitorrentJNI.piece_progress_t_blocks_downloading_set(swigCPtr, this, value);
+  }
+
+  public int getBlocks_downloading() {
+    return anitorrentJNI.piece_progress_t_blocks_downloading_get(swigCPtr, this);
+  }
+
+  public piece_progress_t() {
+    this(anitorrentJNI.new_piece_progress_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,106 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class range_eta_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected range_eta_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(range_eta_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(range_eta_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_range_eta_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setEta_millis(long value) {
+    anitorrentJNI.range_eta_t_eta_millis_set(swigCPtr, this, value);
+  }
+
+  public long getEta_millis() {
+    return anitorrentJNI.range_eta_t_eta_millis_get(swigCPtr, this);
+  }
+
+  public void setRemaining_bytes(long value) {
+    anitorrentJNI.range_eta_t_remaining_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getRemaining_bytes() {
+    return anitorrentJNI.range_eta_t_remaining_bytes_get(swigCPtr, this);
+  }
+
+  public void setMissing_pieces(int value) {
+    anitorrentJNI.range_eta_t_missing_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getMissing_pieces() {
+    return anitorrentJNI.range_eta_t_missing_pieces_get(swigCPtr, this);
+  }
+
+  public void setIn_flight_pieces(int value) {
+    anitorrentJNI.range_eta_t_in_flight_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getIn_flight_pieces() {
+    return anitorrentJNI.range_eta_t_in_flight_pieces_get(swigCPtr, this);
+  }
+
+  public void setRate_bytes_per_second(long value) {
+    anitorrentJNI.range_eta_t_rate_bytes_per_second_set(swigCPtr, this, value);
+  }
+
+  public long getRate_bytes_per_second() {
+    return anitorrentJNI.range_eta_t_rate_bytes_per_second_get(swigCPtr, this);
+  }
+
+  public void setConfidence(float value) {
+    anitorrentJNI.range_eta_t_confidence_set(swigCPtr, this, value);
+  }
+
+  public float getConfidence() {
+    return anitorrentJNI.range_eta_t_confidence_get(swigCPtr, this);
+  }
+
+  public range_eta_t() {
+    this(anitorrentJNI.new_range_eta_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
@@ -0,0 +1,115 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class recheck_progress_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected recheck_progress_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(recheck_progress_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(recheck_progress_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_recheck_progress_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setFile_index(int value) {
+    anitorrentJNI.recheck_progress_t_file_index_set(swigCPtr, this, value);
+  }
+
+  public int getFile_index() {
+    return anitorrentJNI.recheck_progress_t_file_index_get(swigCPtr, this);
+  }
+
+  public void setChecked_pieces(int value) {
+    anitorrentJNI.recheck_progress_t_checked_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getChecked_pieces() {
+    return anitorrentJNI.recheck_progress_t_checked_pieces_get(swigCPtr, this);
+  }
+
+  public void setTotal_pieces(int value) {
+    anitorrentJNI.recheck_progress_t_total_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getTotal_pieces() {
+    return anitorrentJNI.recheck_progress_t_total_pieces_get(swigCPtr, this);
+  }
+
+  public void setFailed_pieces(int value) {
+    anitorrentJNI.recheck_progress_t_failed_pieces_set(swigCPtr, this, value);
+  }
+
+  public int getFailed_pieces() {
+    return anitorrentJNI.recheck_progress_t_failed_pieces_get(swigCPtr, this);
+  }
+
+  public void setNew_failed_pieces(IntVector value) {
+    anitorrentJNI.recheck_progress_t_new_failed_pieces_set(swigCPtr, this, IntVector.getCPtr(value), value);
+  }
+
+  public IntVector getNew_failed_pieces() {
+    long cPtr = anitorrentJNI.recheck_progress_t_new_failed_pieces_get(swigCPtr, this);
+    return (cPtr == 0) ? null : new IntVector(cPtr, false);
+  }
+
+  public void setDone(boolean value) {
+    anitorrentJNI.recheck_progress_t_done_set(swigCPtr, this, value);
+  }
+
+  public boolean getDone() {
+    return anitorrentJNI.recheck_progress_t_done_get(swigCPtr, this);
+  }
+
+  public void setFull_recheck_started(boolean value) {
+    anitorrentJNI.recheck_progress_t_full_recheck_started_set(swigCPtr, this, value);
+  }
+
+  public boolean getFull_recheck_started() {
+    return anitorrentJNI.recheck_progress_t_full_recheck_started_get(swigCPtr, this);
+  }
+
+  public recheck_progress_t() {
+    this(anitorrentJNI.new_recheck_progress_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
@@ -150,6 +150,30 @@ public class session_settings_t {
     return anitorrentJNI.session_settings_t_handshake_client_version_get(swigCPtr, this);
   }
 
+  public void setAlert_queue_size_min(int value) {
+    anitorrentJNI.session_settings_t_alert_queue_size_min_set(swigCPtr, this, value);
+  }
+
+  public int getAlert_queue_size_min() {
+    return anitorrentJNI.session_settings_t_alert_queue_size_min_get(swigCPtr, this);
+  }
+
+  public void setAlert_queue_size_max(int value) {
+    anitorrentJNI.session_settings_t_alert_queue_size_max_set(swigCPtr, this, value);
+  }
+
+  public int getAlert_queue_size_max() {
+    return anitorrentJNI.session_settings_t_alert_queue_size_max_get(swigCPtr, this);
+  }
+
+  public void setPiece_cache_size(long value) {
+    anitorrentJNI.session_settings_t_piece_cache_size_set(swigCPtr, this, value);
+  }
+
+  public long getPiece_cache_size() {
+    return anitorrentJNI.session_settings_t_piece_cache_size_get(swigCPtr, this);
+  }
+
   public session_settings_t() {
     this(anitorrentJNI.new_session_settings_t(), true);
   }
@@ -49,38 +49,142 @@ public class session_stats_t {
     }
   }
 
-  public void setDownload_payload_rate(int value) {
+  public void setDownload_payload_rate(long value) {
     anitorrentJNI.session_stats_t_download_payload_rate_set(swigCPtr, this, value);
   }
 
-  public int getDownload_payload_rate() {
+  public long getDownload_payload_rate() {
     return anitorrentJNI.session_stats_t_download_payload_rate_get(swigCPtr, this);
   }
 
-  public void setTotal_uploaded_bytes(int value) {
-    anitorrentJNI.session_stats_t_total_uploaded_bytes_set(swigCPtr, this, value);
+  public void setUpload_payload_rate(long value) {
+    anitorrentJNI.session_stats_t_upload_payload_rate_set(swigCPtr, this, value);
   }
 
-  public int getTotal_uploaded_bytes() {
-    return anitorrentJNI.session_stats_t_total_uploaded_bytes_get(swigCPtr, this);
+  public long getUpload_payload_rate() {
+    return anitorrentJNI.session_stats_t_upload_payload_rate_get(swigCPtr, this);
   }
 
-  public void setUpload_payload_rate(int value) {
-    anitorrentJNI.session_stats_t_upload_payload_rate_set(swigCPtr, this, value);
+  public void setDownload_rate(long value) {
+    anitorrentJNI.session_stats_t_download_rate_set(swigCPtr, this, value);
   }
 
-  public int getUpload_payload_rate() {
-    return anitorrentJNI.session_stats_t_upload_payload_rate_get(swigCPtr, this);
+  public long getDownload_rate() {
+    return anitorrentJNI.session_stats_t_download_rate_get(swigCPtr, this);
+  }
+
+  public void setUpload_rate(long value) {
+    anitorrentJNI.session_stats_t_upload_rate_set(swigCPtr, this, value);
   }
 
-  public void setTotal_downloaded_bytes(int value) {
+  public long getUpload_rate() {
+    return anitorrentJNI.session_stats_t_upload_rate_get(swigCPtr, this);
+  }
+
+  public void setTotal_downloaded_bytes(long value) {
     anitorrentJNI.session_stats_t_total_downloaded_bytes_set(swigCPtr, this, value);
   }
 
-  public int getTotal_downloaded_bytes() {
+  public long getTotal_downloaded_bytes() {
     return anitorrentJNI.session_stats_t_total_downloaded_bytes_get(swigCPtr, this);
   }
 
+  public void setTotal_uploaded_bytes(long value) {
+    anitorrentJNI.session_stats_t_total_uploaded_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getTotal_uploaded_bytes() {
+    return anitorrentJNI.session_stats_t_total_uploaded_bytes_get(swigCPtr, this);
+  }
+
+  public void setTotal_download_bytes(long value) {
+    anitorrentJNI.session_stats_t_total_download_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getTotal_download_bytes() {
+    return anitorrentJNI.session_stats_t_total_download_bytes_get(swigCPtr, this);
+  }
+
+  public void setTotal_upload_bytes(long value) {
+    anitorrentJNI.session_stats_t_total_upload_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getTotal_upload_bytes() {
+    return anitorrentJNI.session_stats_t_total_upload_bytes_get(swigCPtr, this);
+  }
+
+  public void setWasted_bytes(long value) {
+    anitorrentJNI.session_stats_t_wasted_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getWasted_bytes() {
+    return anitorrentJNI.session_stats_t_wasted_bytes_get(swigCPtr, this);
+  }
+
+  public void setTotal_wasted_bytes(long value) {
+    anitorrentJNI.session_stats_t_total_wasted_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getTotal_wasted_bytes() {
+    return anitorrentJNI.session_stats_t_total_wasted_bytes_get(swigCPtr, this);
+  }
+
+  public void setBlocks_read(long value) {
+    anitorrentJNI.session_stats_t_blocks_read_set(swigCPtr, this, value);
+  }
+
+  public long getBlocks_read() {
+    return anitorrentJNI.session_stats_t_blocks_read_get(swigCPtr, this);
+  }
+
+  public void setBlocks_cache_hits(long value) {
+    anitorrentJNI.session_stats_t_blocks_cache_hits_set(swigCPtr, this, value);
+  }
+
+  public long getBlocks_cache_hits() {
+    return anitorrentJNI.session_stats_t_blocks_cache_hits_get(swigCPtr, this);
+  }
+
+  public void setDisk_queue_depth(long value) {
+    anitorrentJNI.session_stats_t_disk_queue_depth_set(swigCPtr, this, value);
+  }
+
+  public long getDisk_queue_depth() {
+    return anitorrentJNI.session_stats_t_disk_queue_depth_get(swigCPtr, this);
+  }
+
+  public void setDisk_queued_write_bytes(long value) {
+    anitorrentJNI.session_stats_t_disk_queued_write_bytes_set(swigCPtr, this, value);
+  }
+
+  public long getDisk_queued_write_bytes() {
+    return anitorrentJNI.session_stats_t_disk_queued_write_bytes_get(swigCPtr, this);
+  }
+
+  public void setNum_peers(long value) {
+    anitorrentJNI.session_stats_t_num_peers_set(swigCPtr, this, value);
+  }
+
+  public long getNum_peers() {
+    return anitorrentJNI.session_stats_t_num_peers_get(swigCPtr, this);
+  }
+
+  public void setDht_nodes(long value) {
+    anitorrentJNI.session_stats_t_dht_nodes_set(swigCPtr, this, value);
+  }
+
+  public long getDht_nodes() {
+    return anitorrentJNI.session_stats_t_dht_nodes_get(swigCPtr, this);
+  }
+
+  public void setInterval_ms(long value) {
+    anitorrentJNI.session_stats_t_interval_ms_set(swigCPtr, this, value);
+  }
+
+  public long getInterval_ms() {
+    return anitorrentJNI.session_stats_t_interval_ms_get(swigCPtr, this);
+  }
+
   public session_stats_t() {
     this(anitorrentJNI.new_session_stats_t(), true);
   }
@@ -49,6 +49,10 @@ public class session_t {
     }
   }
 
+  public session_t() {
+    this(anitorrentJNI.new_session_t(), true);
+  }
+
   public void start(session_settings_t settings) {
     anitorrentJNI.session_t_start(swigCPtr, this, session_settings_t.getCPtr(settings), settings);
   }
@@ -77,10 +81,46 @@ public class session_t {
     anitorrentJNI.session_t_process_events(swigCPtr, this, event_listener_t.getCPtr(listener), listener);
   }
 
+  public long process_events_batched(event_buffer_t buffer) {
+    return anitorrentJNI.session_t_process_events_batched(swigCPtr, this, event_buffer_t.getCPtr(buffer), buffer);
+  }
+
   public void remove_listener() {
     anitorrentJNI.session_t_remove_listener(swigCPtr, this);
   }
 
+  public void set_torrent_listener(long handle_id, event_listener_t listener) {
+    anitorrentJNI.session_t_set_torrent_listener(swigCPtr, this, handle_id, event_listener_t.getCPtr(listener), listener);
+  }
+
+  public void set_drop_unrouted_events(boolean enabled) {
+    anitorrentJNI.session_t_set_drop_unrouted_events(swigCPtr, this, enabled);
+  }
+
+  public void subscribe(event_listener_t listener) {
+    anitorrentJNI.session_t_subscribe(swigCPtr, this, event_listener_t.getCPtr(listener), listener);
+  }
+
+  public void set_coalesce_piece_progress(boolean enabled) {
+    anitorrentJNI.session_t_set_coalesce_piece_progress(swigCPtr, this, enabled);
+  }
+
+  public boolean start_alert_pump(new_event_listener_t listener, int capacity) {
+    return anitorrentJNI.session_t_start_alert_pump(swigCPtr, this, new_event_listener_t.getCPtr(listener), listener, capacity);
+  }
+
+  public void stop_alert_pump() {
+    anitorrentJNI.session_t_stop_alert_pump(swigCPtr, this);
+  }
+
+  public int drain_events(event_listener_t listener) {
+    return anitorrentJNI.session_t_drain_events(swigCPtr, this, event_listener_t.getCPtr(listener), listener);
+  }
+
+  public long drain_events_batched(event_buffer_t buffer) {
+    return anitorrentJNI.session_t_drain_events_batched(swigCPtr, this, event_buffer_t.getCPtr(buffer), buffer);
+  }
+
   public void set_peer_filter(peer_filter_t filter) {
     anitorrentJNI.session_t_set_peer_filter(swigCPtr, this, peer_filter_t.getCPtr(filter), filter);
   }
@@ -89,12 +129,56 @@ public class session_t {
     anitorrentJNI.session_t_wait_for_alert(swigCPtr, this, timeout_seconds);
   }
 
+  public void post_torrent_updates() {
+    anitorrentJNI.session_t_post_torrent_updates(swigCPtr, this);
+  }
+
   public void post_session_stats() {
     anitorrentJNI.session_t_post_session_stats(swigCPtr, this);
   }
 
-  public session_t() {
-    this(anitorrentJNI.new_session_t(), true);
+  public void set_latency_tracking(boolean enabled) {
+    anitorrentJNI.session_t_set_latency_tracking(swigCPtr, this, enabled);
+  }
+
+  public latency_summary_t latency_summary(int stage, int alert_type) {
+    return new latency_summary_t(anitorrentJNI.session_t_latency_summary(swigCPtr, this, stage, alert_type), true);
+  }
+
+  public void reset_latency_stats() {
+    anitorrentJNI.session_t_reset_latency_stats(swigCPtr, this);
+  }
+
+  public int alert_queue_size() {
+    return anitorrentJNI.session_t_alert_queue_size(swigCPtr, this);
+  }
+
+  public boolean save_resume_data(long handle_id, torrent_resume_data_t data, String path) {
+    return anitorrentJNI.session_t_save_resume_data(swigCPtr, this, handle_id, torrent_resume_data_t.getCPtr(data), data, path);
+  }
+
+  public boolean flush_resume_data(int timeout_millis) {
+    return anitorrentJNI.session_t_flush_resume_data(swigCPtr, this, timeout_millis);
+  }
+
+  public void set_resume_data_fsync(boolean enabled) {
+    anitorrentJNI.session_t_set_resume_data_fsync(swigCPtr, this, enabled);
+  }
+
+  public int start_http_server(int port, int read_timeout_millis) {
+    return anitorrentJNI.session_t_start_http_server(swigCPtr, this, port, read_timeout_millis);
+  }
+
+  public void stop_http_server() {
+    anitorrentJNI.session_t_stop_http_server(swigCPtr, this);
+  }
+
+  public int http_server_port() {
+    return anitorrentJNI.session_t_http_server_port(swigCPtr, this);
+  }
+
+  public void release_piece_state_buffer(long handle_id) {
+    anitorrentJNI.session_t_release_piece_state_buffer(swigCPtr, this, handle_id);
   }
 
 }
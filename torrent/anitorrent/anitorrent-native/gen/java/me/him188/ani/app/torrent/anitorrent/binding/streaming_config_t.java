@@ -0,0 +1,130 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class streaming_config_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected streaming_config_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(streaming_config_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(streaming_config_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_streaming_config_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setFile_index(int value) {
+    anitorrentJNI.streaming_config_t_file_index_set(swigCPtr, this, value);
+  }
+
+  public int getFile_index() {
+    return anitorrentJNI.streaming_config_t_file_index_get(swigCPtr, this);
+  }
+
+  public void setWindow_size(int value) {
+    anitorrentJNI.streaming_config_t_window_size_set(swigCPtr, this, value);
+  }
+
+  public int getWindow_size() {
+    return anitorrentJNI.streaming_config_t_window_size_get(swigCPtr, this);
+  }
+
+  public void setHeader_size(long value) {
+    anitorrentJNI.streaming_config_t_header_size_set(swigCPtr, this, value);
+  }
+
+  public long getHeader_size() {
+    return anitorrentJNI.streaming_config_t_header_size_get(swigCPtr, this);
+  }
+
+  public void setFooter_size(long value) {
+    anitorrentJNI.streaming_config_t_footer_size_set(swigCPtr, this, value);
+  }
+
+  public long getFooter_size() {
+    return anitorrentJNI.streaming_config_t_footer_size_get(swigCPtr, this);
+  }
+
+  public void setPossible_footer_size(long value) {
+    anitorrentJNI.streaming_config_t_possible_footer_size_set(swigCPtr, this, value);
+  }
+
+  public long getPossible_footer_size() {
+    return anitorrentJNI.streaming_config_t_possible_footer_size_get(swigCPtr, this);
+  }
+
+  public void setFirst_deadline_millis(int value) {
+    anitorrentJNI.streaming_config_t_first_deadline_millis_set(swigCPtr, this, value);
+  }
+
+  public int getFirst_deadline_millis() {
+    return anitorrentJNI.streaming_config_t_first_deadline_millis_get(swigCPtr, this);
+  }
+
+  public void setDeadline_base_millis(int value) {
+    anitorrentJNI.streaming_config_t_deadline_base_millis_set(swigCPtr, this, value);
+  }
+
+  public int getDeadline_base_millis() {
+    return anitorrentJNI.streaming_config_t_deadline_base_millis_get(swigCPtr, this);
+  }
+
+  public void setDeadline_step_millis(int value) {
+    anitorrentJNI.streaming_config_t_deadline_step_millis_set(swigCPtr, this, value);
+  }
+
+  public int getDeadline_step_millis() {
+    return anitorrentJNI.streaming_config_t_deadline_step_millis_get(swigCPtr, this);
+  }
+
+  public void setSafety_margin_millis(int value) {
+    anitorrentJNI.streaming_config_t_safety_margin_millis_set(swigCPtr, this, value);
+  }
+
+  public int getSafety_margin_millis() {
+    return anitorrentJNI.streaming_config_t_safety_margin_millis_get(swigCPtr, this);
+  }
+
+  public streaming_config_t() {
+    this(anitorrentJNI.new_streaming_config_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
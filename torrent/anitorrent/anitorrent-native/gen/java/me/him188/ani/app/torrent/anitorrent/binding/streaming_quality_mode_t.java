@@ -0,0 +1,58 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public final class streaming_quality_mode_t {
+  public final static streaming_quality_mode_t kStreamingQualityOff = new streaming_quality_mode_t("kStreamingQualityOff", anitorrentJNI.kStreamingQualityOff_get());
+  public final static streaming_quality_mode_t kStreamingQualityPreferFast = new streaming_quality_mode_t("kStreamingQualityPreferFast", anitorrentJNI.kStreamingQualityPreferFast_get());
+  public final static streaming_quality_mode_t kStreamingQualityAggressive = new streaming_quality_mode_t("kStreamingQualityAggressive", anitorrentJNI.kStreamingQualityAggressive_get());
+
+  public final int swigValue() {
+    return swigValue;
+  }
+
+  public String toString() {
+    return swigName;
+  }
+
+  public static streaming_quality_mode_t swigToEnum(int swigValue) {
+    if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+      return swigValues[swigValue];
+    for (int i = 0; i < swigValues.length; i++)
+      if (swigValues[i].swigValue == swigValue)
+        return swigValues[i];
+    throw new IllegalArgumentException("No enum " + streaming_quality_mode_t.class + " with value " + swigValue);
+  }
+
+  private streaming_quality_mode_t(String swigName) {
+    this.swigName = swigName;
+    this.swigValue = swigNext++;
+  }
+
+  private streaming_quality_mode_t(String swigName, int swigValue) {
+    this.swigName = swigName;
+    this.swigValue = swigValue;
+    swigNext = swigValue+1;
+  }
+
+  private streaming_quality_mode_t(String swigName, streaming_quality_mode_t swigEnum) {
+    this.swigName = swigName;
+    this.swigValue = swigEnum.swigValue;
+    swigNext = this.swigValue+1;
+  }
+
+  private static streaming_quality_mode_t[] swigValues = { kStreamingQualityOff, kStreamingQualityPreferFast, kStreamingQualityAggressive };
+  private static int swigNext = 0;
+  private final int swigValue;
+  private final String swigName;
+}
+
+
+//@formatter:on
\ No newline at end of file
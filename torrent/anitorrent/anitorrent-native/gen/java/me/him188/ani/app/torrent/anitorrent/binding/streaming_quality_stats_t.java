@@ -0,0 +1,90 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public class streaming_quality_stats_t {
+  private transient long swigCPtr;
+  protected transient boolean swigCMemOwn;
+
+  protected streaming_quality_stats_t(long cPtr, boolean cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = cPtr;
+  }
+
+  protected static long getCPtr(streaming_quality_stats_t obj) {
+    return (obj == null) ? 0 : obj.swigCPtr;
+  }
+
+  protected static long swigRelease(streaming_quality_stats_t obj) {
+    long ptr = 0;
+    if (obj != null) {
+      if (!obj.swigCMemOwn)
+        throw new RuntimeException("Cannot release ownership as memory is not owned");
+      ptr = obj.swigCPtr;
+      obj.swigCMemOwn = false;
+      obj.delete();
+    }
+    return ptr;
+  }
+
+  @SuppressWarnings({"deprecation", "removal"})
+  protected void finalize() {
+    delete();
+  }
+
+  public synchronized void delete() {
+    if (swigCPtr != 0) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        anitorrentJNI.delete_streaming_quality_stats_t(swigCPtr);
+      }
+      swigCPtr = 0;
+    }
+  }
+
+  public void setMedian_rtt_millis(int value) {
+    anitorrentJNI.streaming_quality_stats_t_median_rtt_millis_set(swigCPtr, this, value);
+  }
+
+  public int getMedian_rtt_millis() {
+    return anitorrentJNI.streaming_quality_stats_t_median_rtt_millis_get(swigCPtr, this);
+  }
+
+  public void setSlow_peers(int value) {
+    anitorrentJNI.streaming_quality_stats_t_slow_peers_set(swigCPtr, this, value);
+  }
+
+  public int getSlow_peers() {
+    return anitorrentJNI.streaming_quality_stats_t_slow_peers_get(swigCPtr, this);
+  }
+
+  public void setReassigned_requests(long value) {
+    anitorrentJNI.streaming_quality_stats_t_reassigned_requests_set(swigCPtr, this, value);
+  }
+
+  public long getReassigned_requests() {
+    return anitorrentJNI.streaming_quality_stats_t_reassigned_requests_get(swigCPtr, this);
+  }
+
+  public void setDisconnected_peers(long value) {
+    anitorrentJNI.streaming_quality_stats_t_disconnected_peers_set(swigCPtr, this, value);
+  }
+
+  public long getDisconnected_peers() {
+    return anitorrentJNI.streaming_quality_stats_t_disconnected_peers_get(swigCPtr, this);
+  }
+
+  public streaming_quality_stats_t() {
+    this(anitorrentJNI.new_streaming_quality_stats_t(), true);
+  }
+
+}
+
+//@formatter:on
\ No newline at end of file
@@ -98,10 +98,74 @@ public class torrent_handle_t {
     anitorrentJNI.torrent_handle_t_clear_piece_deadlines(swigCPtr, this);
   }
 
+  public void set_piece_deadlines(int first_piece, int count, int base_deadline, int step_deadline, boolean clear_others) {
+    anitorrentJNI.torrent_handle_t_set_piece_deadlines(swigCPtr, this, first_piece, count, base_deadline, step_deadline, clear_others);
+  }
+
+  public void prioritize_pieces(java.nio.ByteBuffer buffer, int num_pieces) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      anitorrentJNI.torrent_handle_t_prioritize_pieces(swigCPtr, this, buffer, num_pieces);
+    }
+  }
+
+  public void prioritize_pieces_bitmap(java.nio.ByteBuffer buffer, int num_pieces, short set_priority, short unset_priority) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      anitorrentJNI.torrent_handle_t_prioritize_pieces_bitmap(swigCPtr, this, buffer, num_pieces, set_priority, unset_priority);
+    }
+  }
+
   public void set_peer_endgame(boolean endgame) {
     anitorrentJNI.torrent_handle_t_set_peer_endgame(swigCPtr, this, endgame);
   }
 
+  public void configure_peer_endgame(int threshold_millis, int min_request_age_millis, int max_extra_peers) {
+    anitorrentJNI.torrent_handle_t_configure_peer_endgame(swigCPtr, this, threshold_millis, min_request_age_millis, max_extra_peers);
+  }
+
+  public void set_asap_deadline_grace(int grace_millis) {
+    anitorrentJNI.torrent_handle_t_set_asap_deadline_grace(swigCPtr, this, grace_millis);
+  }
+
+  public long get_endgame_duplicated_requests() {
+    return anitorrentJNI.torrent_handle_t_get_endgame_duplicated_requests(swigCPtr, this);
+  }
+
+  public void set_streaming_quality_mode(int mode) {
+    anitorrentJNI.torrent_handle_t_set_streaming_quality_mode(swigCPtr, this, mode);
+  }
+
+  public streaming_quality_stats_t get_streaming_quality_stats() {
+    return new streaming_quality_stats_t(anitorrentJNI.torrent_handle_t_get_streaming_quality_stats(swigCPtr, this), true);
+  }
+
+  public deadline_stats_t get_deadline_stats() {
+    return new deadline_stats_t(anitorrentJNI.torrent_handle_t_get_deadline_stats(swigCPtr, this), true);
+  }
+
+  public void reset_deadline_stats() {
+    anitorrentJNI.torrent_handle_t_reset_deadline_stats(swigCPtr, this);
+  }
+
+  public java.nio.ByteBuffer get_piece_state_buffer() {
+    return anitorrentJNI.torrent_handle_t_get_piece_state_buffer(swigCPtr, this);
+  }
+
+  public int get_piece_availability(java.nio.ByteBuffer buffer, int size) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      return anitorrentJNI.torrent_handle_t_get_piece_availability(swigCPtr, this, buffer, size);
+    }
+  }
+
+  public int get_piece_availability_changes(java.nio.ByteBuffer buffer, int size) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      return anitorrentJNI.torrent_handle_t_get_piece_availability_changes(swigCPtr, this, buffer, size);
+    }
+  }
+
   public void add_tracker(String url, short tier, short fail_limit) {
     anitorrentJNI.torrent_handle_t_add_tracker(swigCPtr, this, url, tier, fail_limit);
   }
@@ -126,6 +190,77 @@ public class torrent_handle_t {
     return anitorrentJNI.torrent_handle_t_make_magnet_uri(swigCPtr, this);
   }
 
+  public int read_range(int file_index, long offset, java.nio.ByteBuffer buffer, int length, int timeout_millis) {
+    assert buffer.isDirect() : "Buffer must be allocated direct.";
+    {
+      return anitorrentJNI.torrent_handle_t_read_range(swigCPtr, this, file_index, offset, buffer, length, timeout_millis);
+    }
+  }
+
+  public boolean start_streaming(streaming_config_t config) {
+    return anitorrentJNI.torrent_handle_t_start_streaming(swigCPtr, this, streaming_config_t.getCPtr(config), config);
+  }
+
+  public void seek_streaming(int piece_index) {
+    anitorrentJNI.torrent_handle_t_seek_streaming(swigCPtr, this, piece_index);
+  }
+
+  public void stop_streaming() {
+    anitorrentJNI.torrent_handle_t_stop_streaming(swigCPtr, this);
+  }
+
+  public void update_streaming_playback(long position, long bytes_per_second, float speed) {
+    anitorrentJNI.torrent_handle_t_update_streaming_playback(swigCPtr, this, position, bytes_per_second, speed);
+  }
+
+  public range_eta_t estimate_range_ready(int file_index, long offset, long length) {
+    return new range_eta_t(anitorrentJNI.torrent_handle_t_estimate_range_ready(swigCPtr, this, file_index, offset, length), true);
+  }
+
+  public void set_next_file_prefetch(long bytes) {
+    anitorrentJNI.torrent_handle_t_set_next_file_prefetch(swigCPtr, this, bytes);
+  }
+
+  public int get_prefetch_file() {
+    return anitorrentJNI.torrent_handle_t_get_prefetch_file(swigCPtr, this);
+  }
+
+  public boolean is_streaming_piece(int piece_index) {
+    return anitorrentJNI.torrent_handle_t_is_streaming_piece(swigCPtr, this, piece_index);
+  }
+
+  public void set_piece_cache_size(long capacity_bytes) {
+    anitorrentJNI.torrent_handle_t_set_piece_cache_size(swigCPtr, this, capacity_bytes);
+  }
+
+  public piece_cache_stats_t get_piece_cache_stats() {
+    return new piece_cache_stats_t(anitorrentJNI.torrent_handle_t_get_piece_cache_stats(swigCPtr, this), true);
+  }
+
+  public int recheck_file(int file_index, boolean full_recheck_on_failure) {
+    return anitorrentJNI.torrent_handle_t_recheck_file(swigCPtr, this, file_index, full_recheck_on_failure);
+  }
+
+  public void cancel_recheck_file() {
+    anitorrentJNI.torrent_handle_t_cancel_recheck_file(swigCPtr, this);
+  }
+
+  public int load_media_index(int file_index, int timeout_millis) {
+    return anitorrentJNI.torrent_handle_t_load_media_index(swigCPtr, this, file_index, timeout_millis);
+  }
+
+  public media_index_info_t get_media_index_info(int file_index) {
+    return new media_index_info_t(anitorrentJNI.torrent_handle_t_get_media_index_info(swigCPtr, this, file_index), true);
+  }
+
+  public long media_offset_for_time(int file_index, long time_millis) {
+    return anitorrentJNI.torrent_handle_t_media_offset_for_time(swigCPtr, this, file_index, time_millis);
+  }
+
+  public int media_piece_for_time(int file_index, long time_millis) {
+    return anitorrentJNI.torrent_handle_t_media_piece_for_time(swigCPtr, this, file_index, time_millis);
+  }
+
   public torrent_handle_t() {
     this(anitorrentJNI.new_torrent_handle_t(), true);
   }
@@ -175,6 +310,148 @@ public class torrent_handle_t {
     private final String swigName;
   }
 
+  public final static class read_range_error_t {
+    public final static torrent_handle_t.read_range_error_t kReadRangeInvalidHandle = new torrent_handle_t.read_range_error_t("kReadRangeInvalidHandle", anitorrentJNI.torrent_handle_t_kReadRangeInvalidHandle_get());
+    public final static torrent_handle_t.read_range_error_t kReadRangeInvalidArgument = new torrent_handle_t.read_range_error_t("kReadRangeInvalidArgument", anitorrentJNI.torrent_handle_t_kReadRangeInvalidArgument_get());
+    public final static torrent_handle_t.read_range_error_t kReadRangeTimeout = new torrent_handle_t.read_range_error_t("kReadRangeTimeout", anitorrentJNI.torrent_handle_t_kReadRangeTimeout_get());
+    public final static torrent_handle_t.read_range_error_t kReadRangeFailed = new torrent_handle_t.read_range_error_t("kReadRangeFailed", anitorrentJNI.torrent_handle_t_kReadRangeFailed_get());
+
+    public final int swigValue() {
+      return swigValue;
+    }
+
+    public String toString() {
+      return swigName;
+    }
+
+    public static read_range_error_t swigToEnum(int swigValue) {
+      if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+        return swigValues[swigValue];
+      for (int i = 0; i < swigValues.length; i++)
+        if (swigValues[i].swigValue == swigValue)
+          return swigValues[i];
+      throw new IllegalArgumentException("No enum " + read_range_error_t.class + " with value " + swigValue);
+    }
+
+    private read_range_error_t(String swigName) {
+      this.swigName = swigName;
+      this.swigValue = swigNext++;
+    }
+
+    private read_range_error_t(String swigName, int swigValue) {
+      this.swigName = swigName;
+      this.swigValue = swigValue;
+      swigNext = swigValue+1;
+    }
+
+    private read_range_error_t(String swigName, read_range_error_t swigEnum) {
+      this.swigName = swigName;
+      this.swigValue = swigEnum.swigValue;
+      swigNext = this.swigValue+1;
+    }
+
+    private static read_range_error_t[] swigValues = { kReadRangeInvalidHandle, kReadRangeInvalidArgument, kReadRangeTimeout, kReadRangeFailed };
+    private static int swigNext = 0;
+    private final int swigValue;
+    private final String swigName;
+  }
+
+  public final static class media_index_result_t {
+    public final static torrent_handle_t.media_index_result_t kMediaIndexReady = new torrent_handle_t.media_index_result_t("kMediaIndexReady", anitorrentJNI.torrent_handle_t_kMediaIndexReady_get());
+    public final static torrent_handle_t.media_index_result_t kMediaIndexInvalidHandle = new torrent_handle_t.media_index_result_t("kMediaIndexInvalidHandle", anitorrentJNI.torrent_handle_t_kMediaIndexInvalidHandle_get());
+    public final static torrent_handle_t.media_index_result_t kMediaIndexInvalidArgument = new torrent_handle_t.media_index_result_t("kMediaIndexInvalidArgument", anitorrentJNI.torrent_handle_t_kMediaIndexInvalidArgument_get());
+    public final static torrent_handle_t.media_index_result_t kMediaIndexTimeout = new torrent_handle_t.media_index_result_t("kMediaIndexTimeout", anitorrentJNI.torrent_handle_t_kMediaIndexTimeout_get());
+    public final static torrent_handle_t.media_index_result_t kMediaIndexFailed = new torrent_handle_t.media_index_result_t("kMediaIndexFailed", anitorrentJNI.torrent_handle_t_kMediaIndexFailed_get());
+    public final static torrent_handle_t.media_index_result_t kMediaIndexUnsupported = new torrent_handle_t.media_index_result_t("kMediaIndexUnsupported", anitorrentJNI.torrent_handle_t_kMediaIndexUnsupported_get());
+
+    public final int swigValue() {
+      return swigValue;
+    }
+
+    public String toString() {
+      return swigName;
+    }
+
+    public static media_index_result_t swigToEnum(int swigValue) {
+      if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+        return swigValues[swigValue];
+      for (int i = 0; i < swigValues.length; i++)
+        if (swigValues[i].swigValue == swigValue)
+          return swigValues[i];
+      throw new IllegalArgumentException("No enum " + media_index_result_t.class + " with value " + swigValue);
+    }
+
+    private media_index_result_t(String swigName) {
+      this.swigName = swigName;
+      this.swigValue = swigNext++;
+    }
+
+    private media_index_result_t(String swigName, int swigValue) {
+      this.swigName = swigName;
+      this.swigValue = swigValue;
+      swigNext = swigValue+1;
+    }
+
+    private media_index_result_t(String swigName, media_index_result_t swigEnum) {
+      this.swigName = swigName;
+      this.swigValue = swigEnum.swigValue;
+      swigNext = this.swigValue+1;
+    }
+
+    private static media_index_result_t[] swigValues = { kMediaIndexReady, kMediaIndexInvalidHandle, kMediaIndexInvalidArgument, kMediaIndexTimeout, kMediaIndexFailed, kMediaIndexUnsupported };
+    private static int swigNext = 0;
+    private final int swigValue;
+    private final String swigName;
+  }
+
+  public final static class recheck_result_t {
+    public final static torrent_handle_t.recheck_result_t kRecheckStarted = new torrent_handle_t.recheck_result_t("kRecheckStarted", anitorrentJNI.torrent_handle_t_kRecheckStarted_get());
+    public final static torrent_handle_t.recheck_result_t kRecheckNothingToCheck = new torrent_handle_t.recheck_result_t("kRecheckNothingToCheck", anitorrentJNI.torrent_handle_t_kRecheckNothingToCheck_get());
+    public final static torrent_handle_t.recheck_result_t kRecheckInvalidHandle = new torrent_handle_t.recheck_result_t("kRecheckInvalidHandle", anitorrentJNI.torrent_handle_t_kRecheckInvalidHandle_get());
+    public final static torrent_handle_t.recheck_result_t kRecheckInvalidArgument = new torrent_handle_t.recheck_result_t("kRecheckInvalidArgument", anitorrentJNI.torrent_handle_t_kRecheckInvalidArgument_get());
+    public final static torrent_handle_t.recheck_result_t kRecheckBusy = new torrent_handle_t.recheck_result_t("kRecheckBusy", anitorrentJNI.torrent_handle_t_kRecheckBusy_get());
+    public final static torrent_handle_t.recheck_result_t kRecheckUnsupported = new torrent_handle_t.recheck_result_t("kRecheckUnsupported", anitorrentJNI.torrent_handle_t_kRecheckUnsupported_get());
+
+    public final int swigValue() {
+      return swigValue;
+    }
+
+    public String toString() {
+      return swigName;
+    }
+
+    public static recheck_result_t swigToEnum(int swigValue) {
+      if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+        return swigValues[swigValue];
+      for (int i = 0; i < swigValues.length; i++)
+        if (swigValues[i].swigValue == swigValue)
+          return swigValues[i];
+      throw new IllegalArgumentException("No enum " + recheck_result_t.class + " with value " + swigValue);
+    }
+
+    private recheck_result_t(String swigName) {
+      this.swigName = swigName;
+      this.swigValue = swigNext++;
+    }
+
+    private recheck_result_t(String swigName, int swigValue) {
+      this.swigName = swigName;
+      this.swigValue = swigValue;
+      swigNext = swigValue+1;
+    }
+
+    private recheck_result_t(String swigName, recheck_result_t swigEnum) {
+      this.swigName = swigName;
+      this.swigValue = swigEnum.swigValue;
+      swigNext = this.swigValue+1;
+    }
+
+    private static recheck_result_t[] swigValues = { kRecheckStarted, kRecheckNothingToCheck, kRecheckInvalidHandle, kRecheckInvalidArgument, kRecheckBusy, kRecheckUnsupported };
+    private static int swigNext = 0;
+    private final int swigValue;
+    private final String swigName;
+  }
+
 }
 
 //@formatter:on
\ No newline at end of file
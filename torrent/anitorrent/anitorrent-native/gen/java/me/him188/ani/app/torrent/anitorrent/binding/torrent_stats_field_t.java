@@ -0,0 +1,65 @@
+//@formatter:off
+/* ----------------------------------------------------------------------------
+ * This file was automatically generated by SWIG (https://www.swig.org).
+ * Version 4.2.1
+ *
+ * Do not make changes to this file unless you know what you are doing - modify
+ * the SWIG interface file instead.
+ * ----------------------------------------------------------------------------- */
+
+package me.him188.ani.app.torrent.anitorrent.binding;
+
+public final class torrent_stats_field_t {
+  public final static torrent_stats_field_t kStatsTotal = new torrent_stats_field_t("kStatsTotal", anitorrentJNI.kStatsTotal_get());
+  public final static torrent_stats_field_t kStatsTotalDone = new torrent_stats_field_t("kStatsTotalDone", anitorrentJNI.kStatsTotalDone_get());
+  public final static torrent_stats_field_t kStatsTotalUpload = new torrent_stats_field_t("kStatsTotalUpload", anitorrentJNI.kStatsTotalUpload_get());
+  public final static torrent_stats_field_t kStatsAllTimeUpload = new torrent_stats_field_t("kStatsAllTimeUpload", anitorrentJNI.kStatsAllTimeUpload_get());
+  public final static torrent_stats_field_t kStatsAllTimeDownload = new torrent_stats_field_t("kStatsAllTimeDownload", anitorrentJNI.kStatsAllTimeDownload_get());
+  public final static torrent_stats_field_t kStatsDownloadPayloadRate = new torrent_stats_field_t("kStatsDownloadPayloadRate", anitorrentJNI.kStatsDownloadPayloadRate_get());
+  public final static torrent_stats_field_t kStatsUploadPayloadRate = new torrent_stats_field_t("kStatsUploadPayloadRate", anitorrentJNI.kStatsUploadPayloadRate_get());
+  public final static torrent_stats_field_t kStatsTotalPayloadDownload = new torrent_stats_field_t("kStatsTotalPayloadDownload", anitorrentJNI.kStatsTotalPayloadDownload_get());
+  public final static torrent_stats_field_t kStatsTotalPayloadUpload = new torrent_stats_field_t("kStatsTotalPayloadUpload", anitorrentJNI.kStatsTotalPayloadUpload_get());
+  public final static torrent_stats_field_t kStatsProgress = new torrent_stats_field_t("kStatsProgress", anitorrentJNI.kStatsProgress_get());
+
+  public final int swigValue() {
+    return swigValue;
+  }
+
+  public String toString() {
+    return swigName;
+  }
+
+  public static torrent_stats_field_t swigToEnum(int swigValue) {
+    if (swigValue < swigValues.length && swigValue >= 0 && swigValues[swigValue].swigValue == swigValue)
+      return swigValues[swigValue];
+    for (int i = 0; i < swigValues.length; i++)
+      if (swigValues[i].swigValue == swigValue)
+        return swigValues[i];
+    throw new IllegalArgumentException("No enum " + torrent_stats_field_t.class + " with value " + swigValue);
+  }
+
+  private torrent_stats_field_t(String swigName) {
+    this.swigName = swigName;
+    this.swigValue = swigNext++;
+  }
+
+  private torrent_stats_field_t(String swigName, int swigValue) {
+    this.swigName = swigName;
+    this.swigValue = swigValue;
+    swigNext = swigValue+1;
+  }
+
+  private torrent_stats_field_t(String swigName, torrent_stats_field_t swigEnum) {
+    this.swigName = swigName;
+    this.swigValue = swigEnum.swigValue;
+    swigNext = this.swigValue+1;
+  }
+
+  private static torrent_stats_field_t[] swigValues = { kStatsTotal, kStatsTotalDone, kStatsTotalUpload, kStatsAllTimeUpload, kStatsAllTimeDownload, kStatsDownloadPayloadRate, kStatsUploadPayloadRate, kStatsTotalPayloadDownload, kStatsTotalPayloadUpload, kStatsProgress };
+  private static int swigNext = 0;
+  private final int swigValue;
+  private final String swigName;
+}
+
+
+//@formatter:on
\ No newline at end of file
@@ -129,6 +129,14 @@ public class torrent_stats_t {
     return anitorrentJNI.torrent_stats_t_progress_get(swigCPtr, this);
   }
 
+  public void setChanged_fields(long value) {
+    anitorrentJNI.torrent_stats_t_changed_fields_set(swigCPtr, this, value);
+  }
+
+  public long getChanged_fields() {
+    return anitorrentJNI.torrent_stats_t_changed_fields_get(swigCPtr, this);
+  }
+
   public torrent_stats_t() {
     this(anitorrentJNI.new_torrent_stats_t(), true);
   }
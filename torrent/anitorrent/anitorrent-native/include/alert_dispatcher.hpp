@@ -0,0 +1,125 @@
+#ifndef ALERT_DISPATCHER_H
+#define ALERT_DISPATCHER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+
+#include "events.hpp"
+#include "latency_tracker.hpp"
+#include "libtorrent/alert_types.hpp"
+#include "session_stats.hpp"
+#include "torrent_context.hpp"
+
+namespace anilt {
+/**
+ * Translates libtorrent alerts into event_listener_t calls.
+ *
+ * Handlers are looked up in a table indexed by `alert::type()`, so each alert is dispatched in O(1). The table
+ * also records which events each alert feeds and its alert category, which is used to compute the narrowest
+ * `alert_mask` for a set of subscribed events.
+ *
+ * Alerts must only be dispatched from one thread at a time (the thread that pops them).
+ *
+ * The dispatcher also sizes libtorrent's alert queue: it doubles `alert_queue_size` whenever alerts are dropped,
+ * and halves it again (down to the configured minimum) when batches stay small for a while.
+ */
+class alert_dispatcher_t final {
+  public:
+    alert_dispatcher_t();
+
+    alert_dispatcher_t(const alert_dispatcher_t &) = delete;
+    alert_dispatcher_t &operator=(const alert_dispatcher_t &) = delete;
+
+    void dispatch(lt::alert *alert, event_listener_t &listener);
+
+    /// Dispatches every alert of one `pop_alerts` batch, optionally coalescing piece progress.
+    void dispatch_all(const std::vector<lt::alert *> &alerts, event_listener_t &listener,
+                      bool coalesce_piece_progress);
+
+    /// Sets the bounds of the alert queue size. Must be called before `attach`.
+    void set_alert_queue_bounds(int min_size, int max_size);
+
+    /// Session to resize the alert queue of and to resync piece state from after alerts were dropped.
+    void attach(const std::shared_ptr<lt::session> &session);
+
+    /// Current value of libtorrent's `alert_queue_size`. Can be called from any thread.
+    [[nodiscard]] int alert_queue_size() const { return alert_queue_size_.load(std::memory_order_relaxed); }
+
+    /// Alert being dispatched, or nullptr outside of `dispatch` (e.g. when coalesced progress is flushed)
+    [[nodiscard]] const lt::alert *current_alert() const { return current_alert_; }
+
+    latency_tracker_t &latency() { return latency_; }
+
+    /// Native state of the torrents, fed with the alerts it needs (e.g. read_piece_alert)
+    torrent_registry_t &torrents() { return torrents_; }
+
+    /// The next status update of every torrent is delivered even if unchanged, e.g. after a listener attached.
+    /// Can be called from any thread.
+    void reset_status_updates() { reset_status_updates_.store(true, std::memory_order_relaxed); }
+
+    /// Alert categories libtorrent needs to post to feed the events in `subscribed_events`.
+    [[nodiscard]] lt::alert_category_t alert_mask_for(uint32_t subscribed_events) const;
+
+  private:
+    using handler_t = void (*)(alert_dispatcher_t &self, lt::alert *alert, event_listener_t &listener);
+
+    struct route_t {
+        handler_t handler = nullptr;
+        // Bits of event_kind_t this alert can produce
+        uint32_t events = 0;
+        lt::alert_category_t category{};
+        // Skip the alert if its torrent handle is no longer valid
+        bool requires_valid_handle = false;
+        // Dispatch the alert whatever the listener subscribed to, because native state depends on it. Its category
+        // is part of kInternalCategories, `events` still only lists what the listener receives.
+        bool always = false;
+    };
+
+    template<typename Alert, void (alert_dispatcher_t::*Handler)(Alert &, event_listener_t &)>
+    void route(uint32_t events, bool requires_valid_handle = true, bool always = false);
+
+    void on_state_update(lt::state_update_alert &alert, event_listener_t &listener);
+    void on_session_stats(lt::session_stats_alert &alert, event_listener_t &listener);
+    void on_torrent_removed(lt::torrent_removed_alert &alert, event_listener_t &listener);
+    void on_add_torrent(lt::add_torrent_alert &alert, event_listener_t &listener);
+    void on_torrent_checked(lt::torrent_checked_alert &alert, event_listener_t &listener);
+    void on_metadata_received(lt::metadata_received_alert &alert, event_listener_t &listener);
+    void on_save_resume_data(lt::save_resume_data_alert &alert, event_listener_t &listener);
+    void on_piece_finished(lt::piece_finished_alert &alert, event_listener_t &listener);
+    void on_block_downloading(lt::block_downloading_alert &alert, event_listener_t &listener);
+    void on_state_changed(lt::state_changed_alert &alert, event_listener_t &listener);
+    void on_file_completed(lt::file_completed_alert &alert, event_listener_t &listener);
+    void on_alerts_dropped(lt::alerts_dropped_alert &alert, event_listener_t &listener);
+    void on_read_piece(lt::read_piece_alert &alert, event_listener_t &listener);
+    void on_piece_info(lt::piece_info_alert &alert, event_listener_t &listener);
+
+
+    /// Shrinks the alert queue when it has been mostly unused for a while
+    void on_batch(size_t popped);
+    void set_alert_queue_size(int size);
+
+    std::array<route_t, lt::num_alert_types> routes_{};
+    session_stats_collector_t session_stats_{};
+    // Last reported stats per torrent, to compute torrent_stats_t::changed_fields
+    std::unordered_map<handle_id_t, torrent_stats_t> last_stats_{};
+    std::atomic<bool> reset_status_updates_{false};
+
+    const lt::alert *current_alert_ = nullptr;
+    latency_tracker_t latency_{};
+    torrent_registry_t torrents_{};
+
+    std::weak_ptr<lt::session> session_{};
+    int alert_queue_size_min_ = 10000;
+    int alert_queue_size_max_ = 100000;
+    std::atomic<int> alert_queue_size_{10000};
+    // Largest batch since last_resize_
+    size_t peak_batch_ = 0;
+    std::chrono::steady_clock::time_point last_resize_{};
+};
+
+constexpr uint32_t event_bit(const event_kind_t kind) { return 1u << kind; }
+} // namespace anilt
+
+#endif // ALERT_DISPATCHER_H
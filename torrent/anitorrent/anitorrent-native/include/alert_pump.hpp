@@ -0,0 +1,129 @@
+#ifndef ALERT_PUMP_H
+#define ALERT_PUMP_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <variant>
+
+#include "alert_dispatcher.hpp"
+#include "events.hpp"
+#include "spsc_queue.hpp"
+
+namespace anilt {
+class new_event_listener_t;
+
+/**
+ * Data of the events that do not fit in pump_event_t: stats, progress, deadline misses, and resume data or a
+ * torrent name as bytes. Queued separately, so that the hot events stay small.
+ */
+using pump_payload_t = std::variant<std::monostate, torrent_stats_t, session_stats_t, piece_progress_t,
+                                    deadline_miss_t, recheck_progress_t, std::vector<char>>;
+
+/**
+ * An event translated from a libtorrent alert, see event_kind_t. If `has_payload`, its data is the next
+ * pump_payload_t of the payload queue.
+ */
+struct pump_event_t {
+    event_kind_t kind{};
+    bool has_payload = false;
+    handle_id_t handle_id = 0;
+
+    // piece index, file index, torrent state or dropped events
+    int32_t arg0 = 0;
+    // block index or dropped alert categories
+    int32_t arg1 = 0;
+
+    // Alert the event was translated from, for kLatencyDelivered. -1 if unknown.
+    int alert_type = -1;
+    lt::time_point posted{};
+};
+static_assert(std::is_trivially_copyable_v<pump_event_t>);
+
+/**
+ * Owns a native thread that blocks in `session::wait_for_alert`, translates the alerts into `pump_event_t`s and
+ * pushes them into a bounded single-producer/single-consumer queue.
+ *
+ * The consumer drains the queue with `drain` without taking any lock. `drain` must only be called from one thread
+ * at a time.
+ *
+ * Events are never lost: while the queue is full the pump waits for `drain`, and the events of the batch being
+ * dispatched when it is stopped are kept and delivered by `drain` after the queued ones. A stopped pump can be
+ * started again and keeps its events.
+ */
+class alert_pump_t final {
+  public:
+    /// `capacity` events, a quarter of them with a payload
+    alert_pump_t(std::shared_ptr<lt::session> session, std::shared_ptr<alert_dispatcher_t> dispatcher,
+                 size_t capacity);
+    ~alert_pump_t();
+
+    alert_pump_t(const alert_pump_t &) = delete;
+    alert_pump_t &operator=(const alert_pump_t &) = delete;
+
+    /// `notify` is called from the pump thread when events are queued
+    void start(new_event_listener_t *notify);
+    void stop();
+
+    [[nodiscard]] bool running() const { return running_.load(std::memory_order_acquire); }
+
+    /// Whether events are waiting for `drain`. Exact once the pump is stopped.
+    [[nodiscard]] bool has_events() const;
+
+    /// Replays up to `max_events` queued events on `listener`. Returns the number of events replayed.
+    size_t drain(event_listener_t &listener, size_t max_events);
+
+    void set_coalesce_piece_progress(const bool enabled) {
+        coalesce_piece_progress_.store(enabled, std::memory_order_relaxed);
+    }
+
+    /// Events to queue: the union of `subscribed_events` of every listener `drain` may deliver to.
+    void set_subscribed_events(const uint32_t events) { subscribed_events_.store(events, std::memory_order_relaxed); }
+
+    /// Number of times the pump had to wait because the consumer did not keep up.
+    [[nodiscard]] uint64_t blocked_count() const { return blocked_count_.load(std::memory_order_relaxed); }
+
+  private:
+    friend class pump_writer_t;
+
+    void run();
+
+    /**
+     * Producer side. Waits until there is space for the event (and its payload, if not monostate) or the pump is
+     * stopped, in which case they are kept in `stopped_events_`.
+     */
+    void push(pump_event_t event, pump_payload_t &&payload = {});
+    /// Producer side. Exact for the producer, the consumer only makes more space.
+    [[nodiscard]] bool has_space(bool payload) const;
+
+    /// Consumer side, after space was made
+    void wake_producer();
+
+    static void replay(const pump_event_t &event, pump_payload_t &payload, event_listener_t &listener);
+
+    std::shared_ptr<lt::session> session_;
+    std::shared_ptr<alert_dispatcher_t> dispatcher_;
+    new_event_listener_t *notify_ = nullptr;
+    spsc_queue_t<pump_event_t> queue_;
+    spsc_queue_t<pump_payload_t> payloads_;
+
+    // The producer waits on `space_` while the queues are full, `drain` only notifies when `producer_waiting_`
+    mutable std::mutex wait_lock_;
+    std::condition_variable space_;
+    std::atomic<bool> producer_waiting_{false};
+    // Events that could not be queued because the pump was stopped while the queues were full, and every event
+    // pushed after them until `drain` delivers them, in order. Guarded by `wait_lock_`.
+    std::vector<std::pair<pump_event_t, pump_payload_t>> stopped_events_{};
+    std::atomic<bool> has_stopped_events_{false};
+
+    std::atomic<bool> running_{false};
+    std::atomic<bool> coalesce_piece_progress_{false};
+    std::atomic<uint32_t> subscribed_events_{event_listener_t::kAllEvents};
+    std::atomic<uint64_t> blocked_count_{0};
+    std::thread thread_;
+};
+} // namespace anilt
+
+#endif // ALERT_PUMP_H
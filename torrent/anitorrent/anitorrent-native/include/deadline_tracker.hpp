@@ -0,0 +1,72 @@
+#ifndef DEADLINE_TRACKER_H
+#define DEADLINE_TRACKER_H
+
+#include <bitset>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "events.hpp"
+#include "latency_tracker.hpp"
+
+namespace anilt {
+/**
+ * Tracks every piece of one torrent that has a deadline: when the deadline was first set, when it is due, and
+ * whether the piece finished in time.
+ *
+ * Pieces whose deadline is reset or cleared (e.g. after a seek) are forgotten without counting as missed.
+ * Late pieces are queued as deadline_miss_t until alert_dispatcher_t delivers them. Thread-safe.
+ */
+class deadline_tracker_t final {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    // Number of recent deadline pieces deadline_miss_t::on_time_percent is computed over
+    static constexpr size_t kRecentPieces = 64;
+
+    /**
+     * Keeps the first time a deadline was set on `piece`, and its earliest deadline: a reader asking again for a
+     * piece it waits for must not move the deadline it already missed. A deadline not after `now` is already
+     * missed, the piece counts as late when it finishes.
+     */
+    void on_deadline(int piece, clock::time_point deadline, clock::time_point now);
+    void forget(int piece);
+    void forget_all();
+
+    /// Records the outcome of `piece` if it had a deadline
+    void on_finished(int piece, clock::time_point now);
+
+    /// Late pieces since the previous call, oldest first
+    std::vector<deadline_miss_t> take_misses();
+
+    [[nodiscard]] deadline_stats_t stats(clock::time_point now) const;
+    /// See deadline_miss_t::buffer_health_millis
+    [[nodiscard]] int32_t buffer_health_millis(clock::time_point now) const;
+    /// Resets the counters and the lateness distribution, but not the pending deadlines
+    void reset_stats();
+
+  private:
+    struct pending_t {
+        clock::time_point requested;
+        clock::time_point deadline;
+    };
+
+    // Caller holds lock_
+    [[nodiscard]] int32_t earliest_deadline_millis(clock::time_point now) const;
+    [[nodiscard]] int32_t on_time_percent() const;
+
+    mutable std::mutex lock_;
+    std::unordered_map<int, pending_t> pending_{};
+    std::vector<deadline_miss_t> misses_{};
+    // Bit 0 is the most recent deadline piece, set if it was late
+    std::bitset<kRecentPieces> recent_late_{};
+    size_t recent_count_ = 0;
+    int64_t finished_pieces_ = 0;
+    int64_t missed_pieces_ = 0;
+    // Lateness of missed pieces
+    latency_histogram_t lateness_{};
+};
+} // namespace anilt
+
+#endif // DEADLINE_TRACKER_H
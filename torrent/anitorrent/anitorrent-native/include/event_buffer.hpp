@@ -0,0 +1,107 @@
+#ifndef EVENT_BUFFER_H
+#define EVENT_BUFFER_H
+
+#include <vector>
+
+#include "events.hpp"
+
+namespace anilt {
+extern "C" {
+
+/**
+ * Collects the events of one or more `pop_alerts` into a compact binary buffer, so that Kotlin can
+ * receive a whole batch with a single JNI call instead of one director upcall per alert.
+ *
+ * Usage: `session_t::process_events_batched(buffer)`, then call `read` with a direct ByteBuffer until
+ * `remaining()` is 0.
+ *
+ * All values are in native byte order and are not padded.
+ *
+ * Batch header (written at the start of each `read`):
+ *   u32 magic (kMagic), u16 version (kVersion), u16 reserved, u32 record count, u32 size of all records
+ *
+ * Record:
+ *   u16 kind (event_kind_t), u16 reserved, u32 handle id, u32 payload size, payload
+ *
+ * Payloads:
+ *   kEventTorrentAdded, kEventChecked, kEventMetadataReceived: empty
+ *   kEventSaveResumeData: bencoded resume data
+ *   kEventTorrentStateChanged: i32 torrent_state_t
+ *   kEventBlockDownloading: i32 piece index, i32 block index
+ *   kEventPieceFinished: i32 piece index
+ *   kEventStatusUpdate: i64 total, i64 total_done, i64 total_upload, i64 all_time_upload,
+ *                       i64 all_time_download, i32 download_payload_rate, i32 upload_payload_rate,
+ *                       i64 total_payload_download, i64 total_payload_upload, f32 progress,
+ *                       u32 changed_fields (since version 3)
+ *   kEventFileCompleted: i32 file index
+ *   kEventTorrentRemoved: UTF-8 torrent name, not null-terminated
+ *   kEventSessionStats: i64 download_payload_rate, i64 upload_payload_rate, i64 download_rate, i64 upload_rate,
+ *                       i64 total_downloaded_bytes, i64 total_uploaded_bytes, i64 total_download_bytes,
+ *                       i64 total_upload_bytes, i64 wasted_bytes, i64 total_wasted_bytes, i64 blocks_read,
+ *                       i64 blocks_cache_hits, i64 disk_queue_depth, i64 disk_queued_write_bytes, i64 num_peers,
+ *                       i64 dht_nodes, i64 interval_ms (since version 2)
+ *   kEventPieceProgress: i32 blocks_downloading, i32 n, i32[n] downloading pieces, i32 m, i32[m] finished pieces
+ *   kEventResumeDataSaved: i32 success (0 or 1)
+ *   kEventAlertsDropped: u32 dropped events, u32 dropped alert categories
+ *   kEventDeadlineMissed: i32 piece index, i32 lateness_millis, i32 wait_millis, i32 buffer_health_millis,
+ *                         i32 on_time_percent
+ *   kEventRecheckProgress: i32 file index, i32 checked pieces, i32 total pieces, i32 failed pieces,
+ *                          u32 flags (1: done, 2: full recheck started), i32 n, i32[n] new failed pieces
+ *
+ * New kinds may be added without changing kVersion, readers must skip records of unknown kinds.
+ * kVersion changes only when the layout of an existing record changes.
+ */
+class event_buffer_t final : public event_listener_t {
+  public:
+    static constexpr uint32_t kMagic = 0x45494E41; // "ANIE" in little endian
+    static constexpr uint16_t kVersion = 3;
+    static constexpr size_t kBatchHeaderSize = 16;
+    static constexpr size_t kRecordHeaderSize = 12;
+
+    event_buffer_t() = default;
+
+    /**
+     * Copies a batch header and as many whole records as fit into `buffer`, starting at its address
+     * (the position of the ByteBuffer is ignored).
+     *
+     * @return number of bytes written, or 0 if there is nothing to read or the next record does not fit.
+     * In the latter case, use `next_read_size` to allocate a larger buffer.
+     */
+    size_t read(char *buffer, size_t capacity);
+
+    /// Minimum capacity `read` needs to make progress. 0 if there is nothing to read.
+    [[nodiscard]] size_t next_read_size() const;
+
+    /// Number of bytes not yet consumed by `read`, excluding batch headers.
+    [[nodiscard]] size_t remaining() const { return data_.size() - read_pos_; }
+
+    void clear();
+
+    void on_checked(handle_id_t handle_id) override;
+    void on_metadata_received(handle_id_t handle_id) override;
+    void on_torrent_added(handle_id_t handle_id) override;
+    void on_save_resume_data(handle_id_t handle_id, torrent_resume_data_t &data) override;
+    void on_torrent_state_changed(handle_id_t handle_id, torrent_state_t state) override;
+    void on_block_downloading(handle_id_t handle_id, int32_t piece_index, int block_index) override;
+    void on_piece_finished(handle_id_t handle_id, int32_t piece_index) override;
+    void on_piece_progress(handle_id_t handle_id, piece_progress_t &progress) override;
+    void on_status_update(handle_id_t handle_id, torrent_stats_t &stats) override;
+    void on_file_completed(handle_id_t handle_id, int file_index) override;
+    void on_torrent_removed(handle_id_t handle_id, const char *torrent_name) override;
+    void on_session_stats(handle_id_t handle_id, session_stats_t &stats) override;
+    void on_resume_data_saved(handle_id_t handle_id, bool success) override;
+    void on_alerts_dropped(handle_id_t handle_id, uint32_t dropped_events, uint32_t dropped_categories) override;
+    void on_deadline_missed(handle_id_t handle_id, deadline_miss_t &miss) override;
+    void on_recheck_progress(handle_id_t handle_id, recheck_progress_t &progress) override;
+
+  private:
+    size_t begin_record(event_kind_t kind, handle_id_t handle_id);
+    void end_record(size_t record_start);
+
+    std::vector<char> data_{};
+    size_t read_pos_ = 0;
+};
+}
+} // namespace anilt
+
+#endif // EVENT_BUFFER_H
@@ -60,6 +60,20 @@ enum torrent_state_t {
     checking_resume_data
 };
 
+// Bits of torrent_stats_t::changed_fields
+enum torrent_stats_field_t : uint32_t {
+    kStatsTotal = 1 << 0,
+    kStatsTotalDone = 1 << 1,
+    kStatsTotalUpload = 1 << 2,
+    kStatsAllTimeUpload = 1 << 3,
+    kStatsAllTimeDownload = 1 << 4,
+    kStatsDownloadPayloadRate = 1 << 5,
+    kStatsUploadPayloadRate = 1 << 6,
+    kStatsTotalPayloadDownload = 1 << 7,
+    kStatsTotalPayloadUpload = 1 << 8,
+    kStatsProgress = 1 << 9,
+};
+
 struct torrent_stats_t {
     int64_t total = 0;
 
@@ -75,13 +89,153 @@ struct torrent_stats_t {
     int64_t total_payload_download = 0;
     int64_t total_payload_upload = 0;
     float progress = 0;
+
+    // Bit set of torrent_stats_field_t that differ from the previous update of the same torrent.
+    // All bits are set for the first update of a torrent.
+    uint32_t changed_fields = 0;
 };
 
+// Kinds of events delivered to event_listener_t. Also used as record tags in event_buffer_t.
+enum event_kind_t : uint16_t {
+    kEventTorrentAdded = 1,
+    kEventChecked = 2,
+    kEventMetadataReceived = 3,
+    kEventSaveResumeData = 4,
+    kEventTorrentStateChanged = 5,
+    kEventBlockDownloading = 6,
+    kEventPieceFinished = 7,
+    kEventStatusUpdate = 8,
+    kEventFileCompleted = 9,
+    kEventTorrentRemoved = 10,
+    kEventSessionStats = 11,
+    kEventPieceProgress = 12,
+    kEventResumeDataSaved = 13,
+    kEventAlertsDropped = 14,
+    kEventDeadlineMissed = 15,
+    kEventRecheckProgress = 16,
+};
+
+// Session-wide statistics. See session_t::post_session_stats
 struct session_stats_t {
-    int download_payload_rate = 0;
-    int total_uploaded_bytes = 0;
-    int upload_payload_rate = 0;
-    int total_downloaded_bytes = 0;
+    // Rates are in bytes per second, averaged since the previous session_stats_alert.
+    // They are 0 for the first alert.
+    int64_t download_payload_rate = 0;
+    int64_t upload_payload_rate = 0;
+    // Including protocol and IP overhead
+    int64_t download_rate = 0;
+    int64_t upload_rate = 0;
+
+    int64_t total_downloaded_bytes = 0; // payload
+    int64_t total_uploaded_bytes = 0;   // payload
+    int64_t total_download_bytes = 0;   // including protocol and IP overhead
+    int64_t total_upload_bytes = 0;     // including protocol and IP overhead
+
+    // Redundant and failed-hash bytes since the previous alert, and in total
+    int64_t wasted_bytes = 0;
+    int64_t total_wasted_bytes = 0;
+
+    // Blocks read from disk and blocks served from the cache since the previous alert
+    int64_t blocks_read = 0;
+    int64_t blocks_cache_hits = 0;
+
+    int64_t disk_queue_depth = 0;
+    int64_t disk_queued_write_bytes = 0;
+    int64_t num_peers = 0;
+    int64_t dht_nodes = 0;
+
+    // Time since the previous alert
+    int64_t interval_ms = 0;
+};
+
+// Stages of the event pipeline measured by session_t::set_latency_tracking, all relative to the time libtorrent
+// posted the alert
+enum latency_stage_t {
+    // new_event_listener_t::on_new_events was called. Only recorded for the first alert of each batch.
+    kLatencyNotified = 0,
+    // The alert was popped by process_events or the alert pump
+    kLatencyPopped = 1,
+    // The event_listener_t callbacks for the alert have returned
+    kLatencyDelivered = 2,
+    kLatencyStageCount = 3,
+};
+
+// Latency distribution of one stage, in microseconds. Percentiles are accurate to about 25%.
+struct latency_summary_t {
+    int64_t count = 0;
+    int64_t mean_us = 0;
+    int64_t p50_us = 0;
+    int64_t p90_us = 0;
+    int64_t p99_us = 0;
+    int64_t max_us = 0;
+};
+
+// Usage of the cache of verified pieces of one torrent. See torrent_handle_t::get_piece_cache_stats
+struct piece_cache_stats_t {
+    int64_t capacity_bytes = 0;
+    int64_t size_bytes = 0;
+    int32_t num_pieces = 0;
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t evictions = 0;
+};
+
+// A piece finished after the deadline set on it. See event_listener_t::on_deadline_missed
+struct deadline_miss_t {
+    int32_t piece_index = 0;
+    // How long after its deadline the piece finished
+    int32_t lateness_millis = 0;
+    // From the first time a deadline was set on the piece to its completion
+    int32_t wait_millis = 0;
+    // Time left before the most urgent unfinished deadline piece of the torrent is due. Negative if it is already
+    // late, i.e. playback has probably stalled. INT32_MAX if no deadline is pending.
+    int32_t buffer_health_millis = 0;
+    // Share of the recent deadline pieces (up to 64) that finished in time, 0 to 100
+    int32_t on_time_percent = 100;
+};
+
+// Deadline statistics of one torrent. See torrent_handle_t::get_deadline_stats
+struct deadline_stats_t {
+    // Pieces with a deadline that finished, in time or not
+    int64_t finished_pieces = 0;
+    int64_t missed_pieces = 0;
+    // missed_pieces / finished_pieces
+    float miss_ratio = 0;
+    // Lateness of the missed pieces. Percentiles are accurate to about 25%.
+    int64_t lateness_p50_millis = 0;
+    int64_t lateness_p99_millis = 0;
+    int64_t lateness_max_millis = 0;
+    // Pieces with a deadline that did not finish yet, and those of them past their deadline
+    int32_t pending_pieces = 0;
+    int32_t overdue_pieces = 0;
+    // See deadline_miss_t
+    int32_t buffer_health_millis = 0;
+    int32_t on_time_percent = 100;
+};
+
+// Progress of torrent_handle_t::recheck_file
+struct recheck_progress_t {
+    int32_t file_index = 0;
+    int32_t checked_pieces = 0;
+    // Downloaded pieces overlapping the file
+    int32_t total_pieces = 0;
+    int32_t failed_pieces = 0;
+    // Pieces that failed since the previous event, sorted
+    std::vector<int32_t> new_failed_pieces{};
+    // Last event of the recheck, also sent when it is cancelled
+    bool done = false;
+    // Pieces failed and a full recheck of the torrent was started to download them again
+    bool full_recheck_started = false;
+};
+
+// Block and piece progress of one torrent, coalesced over one batch of alerts.
+// See session_t::set_coalesce_piece_progress
+struct piece_progress_t {
+    // Pieces that had at least one block start downloading, sorted, without duplicates
+    std::vector<int32_t> downloading_pieces{};
+    // Pieces that finished downloading and passed the hash check, sorted, without duplicates
+    std::vector<int32_t> finished_pieces{};
+    // Number of blocks that started downloading
+    int blocks_downloading = 0;
 };
 
 // struct file_progress_sync_t {
@@ -97,16 +251,34 @@ struct session_stats_t {
 class event_listener_t;
 
 struct torrent_resume_data_t {
+    // Blocks. Writes to a temporary file and renames it over `path`, see also session_t::save_resume_data
     void save_to_file(const std::string &path) const;
 
   private:
-    friend void call_listener(lt::alert *alert, libtorrent::session &session, event_listener_t &listener);
+    friend class alert_dispatcher_t;
+    friend class event_buffer_t;
+    friend class alert_pump_t;
+    friend class pump_writer_t;
+    friend class session_t;
     std::vector<char> data_;
 };
 
+class torrent_listener_table_t;
+
 class event_listener_t { // inherited from Kotlin
   public:
-    virtual ~event_listener_t() = default;
+    static constexpr uint32_t kAllEvents = 0xFFFFFFFF;
+    // block_index of on_block_downloading when the block is not known, see on_piece_progress
+    static constexpr int kUnknownBlockIndex = -1;
+
+    /// Removes the routes set for this listener by session_t::set_torrent_listener
+    virtual ~event_listener_t();
+
+    /**
+     * Bit set of `1 << event_kind_t` this listener wants to receive. Events not in the set are not delivered.
+     * See session_t::subscribe for narrowing libtorrent's alert_mask accordingly.
+     */
+    uint32_t subscribed_events = kAllEvents;
 
     virtual void on_checked(handle_id_t handle_id) {}
 
@@ -115,10 +287,17 @@ class event_listener_t { // inherited from Kotlin
     virtual void on_save_resume_data(handle_id_t handle_id, torrent_resume_data_t &data) {}
     virtual void on_torrent_state_changed(handle_id_t handle_id, torrent_state_t state) {}
 
+    // `block_index` is kUnknownBlockIndex when called by the default on_piece_progress, the real block otherwise
     virtual void on_block_downloading(handle_id_t handle_id, int32_t piece_index, int block_index) {}
 
     virtual void on_piece_finished(handle_id_t handle_id, int32_t piece_index) {}
 
+    // Only when session_t::set_coalesce_piece_progress is enabled, replaces on_block_downloading and
+    // on_piece_finished. The default implementation calls on_block_downloading once per downloading piece
+    // (with kUnknownBlockIndex, since coalesced progress does not keep blocks) and on_piece_finished once per
+    // finished piece. Listeners that need block indexes leave coalescing disabled.
+    virtual void on_piece_progress(handle_id_t handle_id, piece_progress_t &progress);
+
     // See torrent_handle_t::post_status_updates
     virtual void on_status_update(handle_id_t handle_id, torrent_stats_t &stats) {}
 
@@ -131,13 +310,40 @@ class event_listener_t { // inherited from Kotlin
 
     virtual void on_session_stats(handle_id_t handle_id, session_stats_t &stats) {}
 
+    // A save requested by session_t::save_resume_data has completed. `success` is false if the file could not
+    // be written, in which case the previous file (if any) is left intact.
+    virtual void on_resume_data_saved(handle_id_t handle_id, bool success) {}
+
+    /**
+     * libtorrent's alert queue overflowed and alerts were lost. `handle_id` is always 0.
+     * @param dropped_events bit set of `1 << event_kind_t` that may have missed updates
+     * @param dropped_categories libtorrent alert categories of the dropped alerts
+     *
+     * If piece events were lost, the piece state of every torrent is delivered again shortly after this event
+     * through `on_piece_progress`, listing all downloaded pieces as finished. It is queried asynchronously, so
+     * other events may arrive in between.
+     */
+    virtual void on_alerts_dropped(handle_id_t handle_id, uint32_t dropped_events, uint32_t dropped_categories) {}
+
+    /**
+     * A piece finished after the deadline set on it by torrent_handle_t or the streaming scheduler. Delivered with
+     * the piece_finished event of that piece. Pieces whose deadline was reset or cleared before they finished are
+     * not reported.
+     */
+    virtual void on_deadline_missed(handle_id_t handle_id, deadline_miss_t &miss) {}
+
+    // See torrent_handle_t::recheck_file
+    virtual void on_recheck_progress(handle_id_t handle_id, recheck_progress_t &progress) {}
+
   private:
     friend class session_t;
+    friend class torrent_listener_table_t;
     std::mutex lock_;
+    // Tables this listener was routed in, see session_t::set_torrent_listener
+    std::mutex tables_lock_;
+    std::vector<std::weak_ptr<torrent_listener_table_t>> tables_{};
 };
 
-
-void call_listener(lt::alert *alert, libtorrent::session &session, event_listener_t &listener);
 }
 } // namespace anilt
 
@@ -0,0 +1,120 @@
+#ifndef FILE_RECHECK_H
+#define FILE_RECHECK_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "events.hpp"
+#include "libtorrent/alert_types.hpp"
+#include "libtorrent/torrent_handle.hpp"
+
+namespace anilt {
+/**
+ * Verifies the downloaded pieces overlapping one file against the SHA-1 hashes of the torrent, without touching
+ * the other files: pieces are read through libtorrent (kParallelReads at a time, including those being hashed)
+ * and hashed on a worker thread, so that hashing does not hold up alert dispatch. The worker runs while a recheck
+ * is in progress.
+ *
+ * Progress is queued for `take_progress`, and a status update of the torrent is posted with it: alert_dispatcher_t
+ * delivers the progress when the state_update_alert arrives.
+ *
+ * libtorrent cannot mark a single piece as missing, so when pieces fail the only way to download them again is
+ * a full `force_recheck`, which is started at the end if requested.
+ *
+ * Thread-safe: `start` is called from Kotlin while `on_read_piece` is called from the alert loop.
+ */
+class file_recheck_t final {
+  public:
+    /// Called on the worker with every piece read for the recheck once hashed. `passed` is false if the read failed.
+    using on_hashed_t =
+        std::function<void(int piece, bool passed, const boost::shared_array<char> &buffer, int size)>;
+
+    static constexpr int kParallelReads = 4;
+    // A progress event is queued every this many pieces, and for every failure
+    static constexpr int kProgressInterval = 16;
+
+    enum start_result_t : int {
+        kStarted = 0,
+        kNothingToCheck = 1,
+        kInvalidArgument = -2,
+        kBusy = -3,
+        kUnsupported = -4,
+    };
+
+    explicit file_recheck_t(on_hashed_t on_hashed);
+    /// Waits for the piece being hashed, the others are dropped
+    ~file_recheck_t();
+
+    file_recheck_t(const file_recheck_t &) = delete;
+    file_recheck_t &operator=(const file_recheck_t &) = delete;
+
+    /// Starts checking file `file_index` of `handle`. Returns a start_result_t.
+    int start(const lt::torrent_handle &handle, int file_index, bool full_recheck_on_failure);
+
+    void cancel();
+
+    /**
+     * Returns true if `alert` is a piece read for the recheck, or a duplicate of a piece being hashed. The data is
+     * then hashed on the worker and passed to `on_hashed`.
+     */
+    bool on_read_piece(const lt::read_piece_alert &alert);
+
+    /**
+     * Reads again the pieces being read, whose read_piece_alert may have been dropped. Called by alert_dispatcher_t
+     * when alerts were dropped, otherwise the recheck would wait for them forever. Alerts received twice are ignored.
+     */
+    void retry_reads();
+
+    /// Progress since the previous call, oldest first
+    std::vector<recheck_progress_t> take_progress();
+
+  private:
+    struct job_t {
+        int piece;
+        bool error;
+        boost::shared_array<char> buffer;
+        int size;
+    };
+
+    void run();
+
+    // Caller holds lock_
+    void read_next();
+    void on_hashed(int piece, bool passed);
+    void queue_progress(bool done);
+
+    const on_hashed_t on_hashed_;
+
+    mutable std::mutex lock_;
+    std::condition_variable jobs_changed_;
+    std::deque<job_t> jobs_{};
+    // Pieces from their read_piece_alert until they are hashed
+    std::unordered_set<int> hashing_{};
+    bool stopping_ = false;
+    // Exits once the recheck is over and `jobs_` is empty, joined by the next `start`
+    std::thread thread_;
+
+    bool running_ = false;
+    lt::torrent_handle handle_{};
+    std::shared_ptr<const lt::torrent_info> torrent_info_{};
+    int file_index_ = -1;
+    bool full_recheck_on_failure_ = false;
+    std::vector<int> pieces_{};
+    size_t next_ = 0;
+    std::unordered_set<int> reading_{};
+    int checked_ = 0;
+    int failed_ = 0;
+    int checked_at_last_progress_ = 0;
+    std::vector<int32_t> new_failed_{};
+    bool full_recheck_started_ = false;
+    std::vector<recheck_progress_t> progress_{};
+};
+} // namespace anilt
+
+#endif // FILE_RECHECK_H
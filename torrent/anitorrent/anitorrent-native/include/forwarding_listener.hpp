@@ -0,0 +1,93 @@
+#ifndef FORWARDING_LISTENER_H
+#define FORWARDING_LISTENER_H
+
+#include "events.hpp"
+
+namespace anilt {
+/**
+ * Forwards every event to a downstream listener. Base class for native stages that sit between
+ * alert_dispatcher_t and the listener given by Kotlin, overriding only the events they care about.
+ */
+class forwarding_listener_t : public event_listener_t {
+  public:
+    explicit forwarding_listener_t(event_listener_t &downstream) : downstream_(downstream) {
+        subscribed_events = downstream.subscribed_events;
+    }
+
+    void on_checked(const handle_id_t handle_id) override {
+        before_forward(handle_id);
+        downstream_.on_checked(handle_id);
+    }
+    void on_metadata_received(const handle_id_t handle_id) override {
+        before_forward(handle_id);
+        downstream_.on_metadata_received(handle_id);
+    }
+    void on_torrent_added(const handle_id_t handle_id) override {
+        before_forward(handle_id);
+        downstream_.on_torrent_added(handle_id);
+    }
+    void on_save_resume_data(const handle_id_t handle_id, torrent_resume_data_t &data) override {
+        before_forward(handle_id);
+        downstream_.on_save_resume_data(handle_id, data);
+    }
+    void on_torrent_state_changed(const handle_id_t handle_id, const torrent_state_t state) override {
+        before_forward(handle_id);
+        downstream_.on_torrent_state_changed(handle_id, state);
+    }
+    void on_block_downloading(const handle_id_t handle_id, const int32_t piece_index, const int block_index) override {
+        before_forward(handle_id);
+        downstream_.on_block_downloading(handle_id, piece_index, block_index);
+    }
+    void on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) override {
+        before_forward(handle_id);
+        downstream_.on_piece_finished(handle_id, piece_index);
+    }
+    void on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) override {
+        before_forward(handle_id);
+        downstream_.on_piece_progress(handle_id, progress);
+    }
+    void on_status_update(const handle_id_t handle_id, torrent_stats_t &stats) override {
+        before_forward(handle_id);
+        downstream_.on_status_update(handle_id, stats);
+    }
+    void on_file_completed(const handle_id_t handle_id, const int file_index) override {
+        before_forward(handle_id);
+        downstream_.on_file_completed(handle_id, file_index);
+    }
+    void on_torrent_removed(const handle_id_t handle_id, const char *torrent_name) override {
+        before_forward(handle_id);
+        downstream_.on_torrent_removed(handle_id, torrent_name);
+    }
+    void on_session_stats(const handle_id_t handle_id, session_stats_t &stats) override {
+        before_forward(handle_id);
+        downstream_.on_session_stats(handle_id, stats);
+    }
+    void on_resume_data_saved(const handle_id_t handle_id, const bool success) override {
+        before_forward(handle_id);
+        downstream_.on_resume_data_saved(handle_id, success);
+    }
+    void on_alerts_dropped(const handle_id_t handle_id, const uint32_t dropped_events,
+                           const uint32_t dropped_categories) override {
+        before_forward(handle_id);
+        downstream_.on_alerts_dropped(handle_id, dropped_events, dropped_categories);
+    }
+
+    void on_deadline_missed(const handle_id_t handle_id, deadline_miss_t &miss) override {
+        before_forward(handle_id);
+        downstream_.on_deadline_missed(handle_id, miss);
+    }
+
+    void on_recheck_progress(const handle_id_t handle_id, recheck_progress_t &progress) override {
+        before_forward(handle_id);
+        downstream_.on_recheck_progress(handle_id, progress);
+    }
+
+  protected:
+    /// Called before any event of `handle_id` is forwarded, so that stages holding back events can release them first
+    virtual void before_forward(handle_id_t handle_id) {}
+
+    event_listener_t &downstream_;
+};
+} // namespace anilt
+
+#endif // FORWARDING_LISTENER_H
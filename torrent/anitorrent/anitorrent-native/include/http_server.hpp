@@ -0,0 +1,94 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+#include "torrent_context.hpp"
+
+namespace anilt {
+/**
+ * Minimal HTTP/1.1 server bound to 127.0.0.1 that serves the files of the torrents in the session, so that any
+ * media player can stream them while they download.
+ *
+ * `GET` and `HEAD` on `/<handle id>/<file index>[/<any name>]` with an optional single `Range: bytes=` header.
+ * Requests whose Host header is not a loopback name or address are refused, against DNS rebinding.
+ * Each response blocks on the pieces it covers: the first piece of a request moves the playhead, and the streaming
+ * scheduler of the torrent if it is outside its window, and the following pieces are requested ahead of the
+ * reader. Bytes are written to the socket straight from the piece buffers.
+ *
+ * Connections are served on their own threads, so a player waiting for a piece does not delay the others. Past
+ * 16 connections, new ones are answered with 503 and closed.
+ * Alerts must be processed (by `session_t::process_events` or the alert pump) while the server is running.
+ */
+class http_server_t final {
+  public:
+    using context_resolver_t = std::function<std::shared_ptr<torrent_context_t>(handle_id_t)>;
+
+    explicit http_server_t(context_resolver_t resolver);
+    ~http_server_t();
+
+    http_server_t(const http_server_t &) = delete;
+    http_server_t &operator=(const http_server_t &) = delete;
+
+    /**
+     * @param port 0 to pick any free port
+     * @param read_timeout_millis how long a response waits for one piece before closing the connection
+     * @return the bound port, or -1
+     */
+    int start(int port, int read_timeout_millis);
+
+    /// Closes all connections and waits for their threads
+    void stop();
+
+    /// -1 if not started
+    [[nodiscard]] int port() const { return port_.load(std::memory_order_relaxed); }
+
+    /// True if the Host header names the loopback interface, with or without a port
+    static bool is_loopback_host(const std::string &host);
+
+    /**
+     * Parses a Range header `bytes=first-last`, where either bound may be omitted. Only the first range of a
+     * multi-range request is served. Omitted bounds are left unchanged.
+     */
+    static bool parse_range(const std::string &value, int64_t &first, int64_t &last);
+
+  private:
+    struct connection_t {
+        explicit connection_t(boost::asio::ip::tcp::socket socket) : socket(std::move(socket)) {}
+
+        boost::asio::ip::tcp::socket socket;
+        std::thread thread{};
+        std::atomic<bool> done{false};
+    };
+
+    struct request_t;
+
+    void do_accept();
+    void serve(connection_t &connection) const;
+    /// Returns false if the connection must be closed
+    bool respond(boost::asio::ip::tcp::socket &socket, const request_t &request) const;
+    bool wait_piece(torrent_context_t &context, int piece, torrent_context_t::piece_data_t &out) const;
+
+    const context_resolver_t resolver_;
+    boost::asio::io_context io_{};
+    boost::asio::ip::tcp::acceptor acceptor_{io_};
+    std::thread io_thread_{};
+    std::atomic<int> port_{-1};
+    std::atomic<bool> stopping_{false};
+    int read_timeout_millis_ = 60000;
+
+    std::mutex connections_lock_;
+    std::list<std::unique_ptr<connection_t>> connections_{};
+};
+} // namespace anilt
+
+#endif // HTTP_SERVER_H
@@ -0,0 +1,82 @@
+#ifndef LATENCY_TRACKER_H
+#define LATENCY_TRACKER_H
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "events.hpp"
+#include "libtorrent/alert.hpp"
+
+namespace anilt {
+/**
+ * Lock-free histogram of durations in microseconds with logarithmic buckets: every power of two is split into
+ * kSubBuckets linear buckets, which bounds the relative error of percentiles to 1 / kSubBuckets.
+ *
+ * `record` can be called concurrently from any thread.
+ */
+class latency_histogram_t final {
+  public:
+    static constexpr int kSubBuckets = 4;
+    // Up to 2^35 us (about 9.5 hours), larger values go to the last bucket
+    static constexpr int kBuckets = kSubBuckets * 34;
+
+    void record(int64_t micros);
+    void reset();
+
+    /// Adds the counts of this histogram to `counts`, and returns the sum and max of the recorded values
+    void merge_into(std::array<uint64_t, kBuckets> &counts, int64_t &sum, int64_t &max) const;
+
+    static latency_summary_t summarize(const std::array<uint64_t, kBuckets> &counts, int64_t sum, int64_t max);
+
+  private:
+    static int bucket_of(int64_t micros);
+    /// Smallest value that falls into `bucket`
+    static int64_t lower_bound_of(int bucket);
+
+    std::array<std::atomic<uint64_t>, kBuckets> counts_{};
+    std::atomic<int64_t> sum_{0};
+    std::atomic<int64_t> max_{0};
+};
+
+/**
+ * Records, per alert type, how long alerts take to go through each latency_stage_t. Disabled by default, in which
+ * case every call is a single relaxed load.
+ */
+class latency_tracker_t final {
+  public:
+    latency_tracker_t();
+
+    void set_enabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    [[nodiscard]] bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Records the time `on_new_events` was called, picked up by the next `on_popped`
+    void on_notified();
+
+    /// Records kLatencyPopped for every alert, and kLatencyNotified for the first one if a notification is pending
+    void on_popped(const std::vector<lt::alert *> &alerts);
+
+    /// Records kLatencyDelivered for every alert
+    void on_delivered(const std::vector<lt::alert *> &alerts);
+
+    void record(latency_stage_t stage, int alert_type, lt::time_point posted, lt::time_point now);
+
+    /// @param alert_type libtorrent alert type, or -1 to merge all types
+    [[nodiscard]] latency_summary_t summary(latency_stage_t stage, int alert_type) const;
+
+    void reset();
+
+  private:
+    latency_histogram_t &histogram(latency_stage_t stage, int alert_type) const {
+        return histograms_[stage * lt::num_alert_types + alert_type];
+    }
+
+    std::atomic<bool> enabled_{false};
+    // Time of the first notification since the last pop, as clock ticks. 0 if none.
+    std::atomic<lt::time_point::rep> notified_at_{0};
+    std::unique_ptr<latency_histogram_t[]> histograms_;
+};
+} // namespace anilt
+
+#endif // LATENCY_TRACKER_H
@@ -0,0 +1,94 @@
+#ifndef LISTENER_ROUTER_H
+#define LISTENER_ROUTER_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "events.hpp"
+
+namespace anilt {
+using torrent_listener_map_t = std::unordered_map<handle_id_t, event_listener_t *>;
+
+/**
+ * Listeners set by session_t::set_torrent_listener, by handle id. Copied on write, so that event processing only
+ * holds the lock to take a snapshot.
+ *
+ * A listener removes itself from every table it is registered in when it is destroyed, see `remove`.
+ */
+class torrent_listener_table_t final : public std::enable_shared_from_this<torrent_listener_table_t> {
+  public:
+    /// Routes the events of `handle_id` to `listener`, or removes the route if `listener` is nullptr
+    void set(handle_id_t handle_id, event_listener_t *listener);
+
+    /**
+     * Removes every route to `listener`, then waits until no batch being dispatched on another thread can still
+     * call it. Routers on the calling thread see the removal before their next event. Called by ~event_listener_t.
+     */
+    void remove(const event_listener_t *listener);
+
+    /// Current routes, nullptr if there are none. `version` changes whenever the routes do.
+    [[nodiscard]] std::shared_ptr<const torrent_listener_map_t> snapshot(uint64_t &version) const;
+
+    [[nodiscard]] uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+    /// Union of `subscribed_events` of every routed listener
+    [[nodiscard]] uint32_t subscribed_events() const;
+
+    /// Held by listener_router_t while it dispatches a batch
+    std::recursive_mutex &dispatch_lock() { return dispatch_lock_; }
+
+  private:
+    mutable std::mutex lock_;
+    std::shared_ptr<const torrent_listener_map_t> routes_;
+    std::atomic<uint64_t> version_{0};
+    std::recursive_mutex dispatch_lock_;
+};
+
+/**
+ * Delivers each event to the listener registered for its torrent (see session_t::set_torrent_listener), or to the
+ * fallback listener if there is none. Session-wide events (handle id 0) always go to the fallback listener.
+ *
+ * Events are only delivered if the target listener subscribed to them. `subscribed_events` of the router is the
+ * union of all targets, so the dispatcher skips events nobody wants.
+ */
+class listener_router_t final : public event_listener_t {
+  public:
+    /// @param drop_unrouted drop torrent events that have no registered listener instead of using the fallback
+    listener_router_t(std::shared_ptr<torrent_listener_table_t> table, event_listener_t &fallback,
+                      bool drop_unrouted);
+
+    void on_checked(handle_id_t handle_id) override;
+    void on_metadata_received(handle_id_t handle_id) override;
+    void on_torrent_added(handle_id_t handle_id) override;
+    void on_save_resume_data(handle_id_t handle_id, torrent_resume_data_t &data) override;
+    void on_torrent_state_changed(handle_id_t handle_id, torrent_state_t state) override;
+    void on_block_downloading(handle_id_t handle_id, int32_t piece_index, int block_index) override;
+    void on_piece_finished(handle_id_t handle_id, int32_t piece_index) override;
+    void on_piece_progress(handle_id_t handle_id, piece_progress_t &progress) override;
+    void on_status_update(handle_id_t handle_id, torrent_stats_t &stats) override;
+    void on_file_completed(handle_id_t handle_id, int file_index) override;
+    void on_torrent_removed(handle_id_t handle_id, const char *torrent_name) override;
+    void on_session_stats(handle_id_t handle_id, session_stats_t &stats) override;
+    void on_resume_data_saved(handle_id_t handle_id, bool success) override;
+    void on_alerts_dropped(handle_id_t handle_id, uint32_t dropped_events, uint32_t dropped_categories) override;
+    void on_deadline_missed(handle_id_t handle_id, deadline_miss_t &miss) override;
+    void on_recheck_progress(handle_id_t handle_id, recheck_progress_t &progress) override;
+
+  private:
+    /// Listener for a torrent event, or nullptr if the event is not wanted by anyone
+    [[nodiscard]] event_listener_t *target(handle_id_t handle_id, uint32_t events) const;
+
+    const std::shared_ptr<torrent_listener_table_t> table_;
+    // Keeps listeners removed on other threads alive until the router is gone
+    std::unique_lock<std::recursive_mutex> dispatching_;
+    // Refreshed when the table changes during the batch, e.g. a listener destroyed by one of its own callbacks
+    mutable std::shared_ptr<const torrent_listener_map_t> routes_;
+    mutable uint64_t version_ = 0;
+    event_listener_t &fallback_;
+    bool drop_unrouted_;
+};
+} // namespace anilt
+
+#endif // LISTENER_ROUTER_H
@@ -0,0 +1,72 @@
+#ifndef MEDIA_INDEX_H
+#define MEDIA_INDEX_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "torrent_handle_t.hpp"
+
+namespace anilt {
+/**
+ * Seek index of a media file, parsed from its container structure: the MP4 box tree (`moov`) or the Matroska
+ * SeekHead, Info, Tracks and Cues elements.
+ *
+ * Parsing only reads the boxes and elements it needs: for MP4 the top-level box headers and `moov`, for Matroska
+ * the elements before the first Cluster and the ones the SeekHead points to. This is what a player reads before
+ * it can start or seek, so these byte ranges are exposed as `metadata_ranges`.
+ *
+ * Fragmented MP4 and Matroska files without Cues are recognized but have no keyframes.
+ */
+class media_index_t final {
+  public:
+    struct keyframe_t {
+        int64_t time_millis = 0;
+        // Offset in the file of the sample (MP4) or the cluster (Matroska) to start decoding from
+        int64_t offset = 0;
+    };
+
+    struct byte_range_t {
+        int64_t offset = 0;
+        int64_t size = 0;
+    };
+
+    /**
+     * Reads `size` bytes at `offset` of the file into `out`. `size` never goes past the end of the file.
+     * Returns false if the bytes are not available, which aborts parsing.
+     */
+    using reader_t = std::function<bool(int64_t offset, int64_t size, std::vector<char> &out)>;
+
+    /// Returns nullptr if the container is not recognized or `read` fails
+    static std::shared_ptr<const media_index_t> parse(int64_t file_size, const reader_t &read);
+
+    [[nodiscard]] media_container_t container() const { return container_; }
+    [[nodiscard]] int64_t duration_millis() const { return duration_millis_; }
+
+    /// Sorted by time
+    [[nodiscard]] const std::vector<keyframe_t> &keyframes() const { return keyframes_; }
+
+    /// Byte ranges of the file a player reads before playing, sorted by offset
+    [[nodiscard]] const std::vector<byte_range_t> &metadata_ranges() const { return metadata_ranges_; }
+
+    /// Range of `moov` or Cues
+    [[nodiscard]] const byte_range_t &index_range() const { return index_range_; }
+
+    /// Offset of the last keyframe at or before `time_millis`, or -1 if there are no keyframes
+    [[nodiscard]] int64_t offset_for_time(int64_t time_millis) const;
+
+  private:
+    static std::shared_ptr<media_index_t> parse_mp4(int64_t file_size, const reader_t &read);
+    static std::shared_ptr<media_index_t> parse_mkv(int64_t file_size, const reader_t &read);
+
+    void add_metadata_range(int64_t offset, int64_t size);
+
+    media_container_t container_ = kMediaContainerUnknown;
+    int64_t duration_millis_ = 0;
+    std::vector<keyframe_t> keyframes_{};
+    std::vector<byte_range_t> metadata_ranges_{};
+    byte_range_t index_range_{};
+};
+} // namespace anilt
+
+#endif // MEDIA_INDEX_H
@@ -0,0 +1,67 @@
+#ifndef PIECE_CACHE_H
+#define PIECE_CACHE_H
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+#include <boost/shared_array.hpp>
+
+#include "events.hpp"
+
+namespace anilt {
+/**
+ * Bounded in-memory cache of verified pieces of one torrent, filled from read_piece_alert so that reading a piece
+ * again (e.g. after seeking backwards) does not go to the disk.
+ *
+ * Pieces are kept in LRU order, but eviction is centred on the playhead: the victim is the piece farthest from the
+ * playhead, the least recently used one among equals. Scanning for it is linear, which is fine because the cache
+ * holds at most a few dozen pieces.
+ *
+ * Not thread-safe, guarded by torrent_context_t.
+ */
+class piece_cache_t final {
+  public:
+    explicit piece_cache_t(const int64_t capacity_bytes) : capacity_bytes_(std::max<int64_t>(0, capacity_bytes)) {}
+
+    /// Evicts pieces until the cache fits. 0 disables the cache.
+    void set_capacity(int64_t capacity_bytes);
+
+    /// Piece being played, -1 if unknown
+    void set_playhead(int piece) { playhead_ = piece; }
+    [[nodiscard]] int playhead() const { return playhead_; }
+
+    /// Returns false if `piece` is not cached. A hit makes `piece` the most recently used one.
+    bool find(int piece, boost::shared_array<char> &buffer, int &size);
+
+    /// Caches `piece`, replacing a previous copy. Pieces larger than the capacity are not cached.
+    void insert(int piece, boost::shared_array<char> buffer, int size);
+
+    void clear();
+
+    [[nodiscard]] piece_cache_stats_t stats() const;
+
+  private:
+    struct entry_t {
+        int piece = 0;
+        boost::shared_array<char> buffer{};
+        int size = 0;
+    };
+
+    void evict(int64_t needed_bytes);
+    [[nodiscard]] int64_t distance(int piece) const;
+
+    int64_t capacity_bytes_;
+    int64_t size_bytes_ = 0;
+    int playhead_ = -1;
+    // Most recently used first
+    std::list<entry_t> entries_{};
+    std::unordered_map<int, std::list<entry_t>::iterator> index_{};
+
+    int64_t hits_ = 0;
+    int64_t misses_ = 0;
+    int64_t evictions_ = 0;
+};
+} // namespace anilt
+
+#endif // PIECE_CACHE_H
@@ -0,0 +1,27 @@
+#ifndef PIECE_DEADLINES_H
+#define PIECE_DEADLINES_H
+
+#include <utility>
+#include <vector>
+
+#include "libtorrent/torrent_handle.hpp"
+#include "plugin/streaming_plugin.h"
+
+namespace anilt {
+/**
+ * Sets the deadline of each (piece, deadline in ms) pair, then makes sure they are downloaded with one
+ * `prioritize_pieces` call instead of one `piece_priority` call per piece.
+ * The deadlines are also recorded in `endgame` if not null.
+ */
+void set_piece_deadlines(const lt::torrent_handle &handle, const std::vector<std::pair<int, int>> &deadlines,
+                         plugin::endgame_state_t *endgame = nullptr);
+
+/// Resets the deadline of each piece, also in `endgame` if not null.
+void reset_piece_deadlines(const lt::torrent_handle &handle, const std::vector<int> &pieces,
+                           plugin::endgame_state_t *endgame = nullptr);
+
+/// Pieces of `before` that are not in `after`, in the order of `before`.
+std::vector<int> pieces_not_in(const std::vector<int> &before, const std::vector<int> &after);
+} // namespace anilt
+
+#endif // PIECE_DEADLINES_H
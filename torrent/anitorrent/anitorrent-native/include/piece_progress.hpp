@@ -0,0 +1,41 @@
+#ifndef PIECE_PROGRESS_H
+#define PIECE_PROGRESS_H
+
+#include <unordered_map>
+
+#include "forwarding_listener.hpp"
+
+namespace anilt {
+/**
+ * Folds `on_block_downloading` and `on_piece_finished` of one batch of alerts into one `on_piece_progress` per
+ * torrent. All other events are forwarded immediately. Call `flush` at the end of the batch.
+ *
+ * Events of one torrent keep their relative order: the progress held back for a torrent is delivered before the
+ * next other event of that torrent, e.g. a piece finishes before the file it completes. Only events of different
+ * torrents may be reordered relative to each other.
+ */
+class piece_progress_coalescer_t final : public forwarding_listener_t {
+  public:
+    explicit piece_progress_coalescer_t(event_listener_t &downstream) : forwarding_listener_t(downstream) {}
+
+    void on_block_downloading(handle_id_t handle_id, int32_t piece_index, int block_index) override;
+    void on_piece_finished(handle_id_t handle_id, int32_t piece_index) override;
+    void on_piece_progress(handle_id_t handle_id, piece_progress_t &progress) override;
+
+    /// Delivers the coalesced progress of every torrent seen since the last flush, in order of first appearance.
+    void flush();
+
+  protected:
+    void before_forward(handle_id_t handle_id) override;
+
+  private:
+    piece_progress_t &progress_of(handle_id_t handle_id);
+    void deliver(handle_id_t handle_id, piece_progress_t &progress);
+
+    std::unordered_map<handle_id_t, piece_progress_t> pending_{};
+    std::vector<handle_id_t> order_{};
+};
+
+} // namespace anilt
+
+#endif // PIECE_PROGRESS_H
@@ -0,0 +1,81 @@
+#ifndef PIECE_STATE_MAP_H
+#define PIECE_STATE_MAP_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace anilt {
+/**
+ * State of every piece of one torrent in native memory that Kotlin maps as a direct ByteBuffer, so that readers
+ * check whether a piece is ready with a memory load instead of maintaining their own state from events.
+ *
+ * Layout, in native byte order:
+ *   u32 sequence, u32 piece count, u32 version (kVersion), u32 reserved, then one byte per piece:
+ *   bits 0-1 piece_state_t, bit 2 kPieceDeadline.
+ *
+ * Each byte is updated atomically. Writers make `sequence` odd while they update several pieces (e.g. a resync),
+ * so a consistent snapshot of many pieces is one read while `sequence` is even and unchanged before and after.
+ *
+ * The buffer is allocated once, when the piece count is known, and never moves or shrinks afterward.
+ */
+class piece_state_map_t final {
+  public:
+    enum piece_state_t : uint8_t {
+        kPieceNone = 0,
+        kPieceDownloading = 1,
+        kPieceFinished = 2,
+    };
+    static constexpr uint8_t kPieceStateMask = 0x03;
+    static constexpr uint8_t kPieceDeadline = 0x04;
+
+    static constexpr uint32_t kVersion = 1;
+    static constexpr size_t kHeaderSize = 16;
+
+    /// Allocates the buffer with one byte per piece from `states`. Returns false if it already exists.
+    bool init(const std::vector<uint8_t> &states);
+
+    [[nodiscard]] bool initialized() const { return initialized_.load(std::memory_order_acquire); }
+
+    /// Replaces the state of all pieces, keeping the deadline flags. The piece count must not change.
+    void sync(const std::vector<uint8_t> &states);
+
+    /// kPieceNone if the map is not initialized
+    [[nodiscard]] piece_state_t state(int piece) const;
+
+    void set_finished(int piece);
+    /// Only pieces without a state become downloading
+    void set_downloading(int piece);
+
+    /**
+     * Makes the pieces of `downloading` (libtorrent's download queue) downloading, and the other downloading pieces
+     * lose their state. Finished pieces are not changed.
+     */
+    void sync_downloading(const std::vector<int> &downloading);
+
+    void set_deadline(int piece, bool deadline);
+    void clear_deadlines();
+
+    /// nullptr until `init`
+    [[nodiscard]] char *data() const;
+    [[nodiscard]] size_t size() const { return kHeaderSize + num_pieces_; }
+
+  private:
+    static constexpr size_t kHeaderWords = kHeaderSize / sizeof(uint32_t);
+
+    /// Replaces the byte of `piece` by `update(byte)` atomically. Caller holds `lock_`.
+    template<typename Fn>
+    void update(int piece, Fn &&update);
+    void begin_write();
+    void end_write();
+
+    std::mutex lock_;
+    std::unique_ptr<std::atomic<uint32_t>[]> words_;
+    size_t num_pieces_ = 0;
+    std::atomic<bool> initialized_{false};
+};
+} // namespace anilt
+
+#endif // PIECE_STATE_MAP_H
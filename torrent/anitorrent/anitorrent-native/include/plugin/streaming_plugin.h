@@ -0,0 +1,179 @@
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <libtorrent/extensions.hpp>
+#include <libtorrent/peer_connection_handle.hpp>
+#include "deadline_tracker.hpp"
+#include "piece_state_map.hpp"
+#include "torrent_handle_t.hpp"
+
+#ifndef ANI_STREAMING_PLUGIN_H
+#define ANI_STREAMING_PLUGIN_H
+
+namespace anilt::plugin {
+    using steady_clock = std::chrono::steady_clock;
+
+    /**
+     * Deadlines of the pieces of one torrent that are being streamed, and how streaming_torrent_plugin treats them.
+     * Written by the threads calling torrent_handle_t and streaming_scheduler_t, read by streaming_torrent_plugin on
+     * libtorrent's network thread.
+     */
+    class endgame_state_t final {
+    public:
+        /// Deadlines are also flagged in `piece_states` and recorded in `tracker` if not null
+        explicit endgame_state_t(std::shared_ptr<piece_state_map_t> piece_states = nullptr,
+                                 std::shared_ptr<deadline_tracker_t> tracker = nullptr)
+                : piece_states_(std::move(piece_states)), tracker_(std::move(tracker))
+        {}
+
+        void set_enabled(bool enabled);
+        [[nodiscard]] bool enabled() const;
+
+        void configure(int threshold_millis, int min_request_age_millis, int max_extra_peers);
+
+        /// How long after it is first set a deadline of 0 or less is due, see `set_deadline`
+        void set_asap_grace(int grace_millis);
+
+        /**
+         * `deadline_millis` is relative to now, like lt::torrent_handle::set_piece_deadline. Deadlines of 0 or less
+         * ask for the piece as soon as possible (the streaming defaults are negative): it is due the asap grace
+         * after the deadline was first set, and is urgent once it waited the endgame threshold.
+         */
+        void set_deadline(int piece, int deadline_millis);
+        void reset_deadline(int piece);
+        void clear();
+        /// The piece passed the hash check: its deadline is met (or missed) rather than reset
+        void on_piece_passed(int piece);
+
+        /**
+         * Pieces whose deadline is less than the threshold away (or already passed), and pieces without a positive
+         * deadline set for longer than the threshold, most urgent first
+         */
+        [[nodiscard]] std::vector<int> urgent_pieces(steady_clock::time_point now) const;
+
+        [[nodiscard]] steady_clock::duration min_request_age() const;
+        [[nodiscard]] int max_extra_peers() const;
+
+        void count_duplicated_request() { ++duplicated_requests_; }
+        [[nodiscard]] uint64_t duplicated_requests() const { return duplicated_requests_; }
+
+        /// Pieces with a deadline, whether or not endgame is enabled
+        [[nodiscard]] std::vector<int> deadline_pieces() const;
+
+        void set_quality_mode(streaming_quality_mode_t mode) { quality_mode_ = mode; }
+        [[nodiscard]] streaming_quality_mode_t quality_mode() const { return quality_mode_; }
+
+        /// Written by streaming_torrent_plugin, `reassigned` and `disconnected` are added to the totals
+        void update_quality_stats(int median_rtt_millis, int slow_peers, int reassigned, int disconnected);
+        [[nodiscard]] streaming_quality_stats_t quality_stats() const;
+
+    private:
+        const std::shared_ptr<piece_state_map_t> piece_states_;
+        const std::shared_ptr<deadline_tracker_t> tracker_;
+        mutable std::mutex lock_;
+        bool enabled_ = false;
+        std::chrono::milliseconds threshold_{1500};
+        std::chrono::milliseconds min_request_age_{500};
+        std::chrono::milliseconds asap_grace_{3000};
+        int max_extra_peers_ = 2;
+        struct deadline_t {
+            steady_clock::time_point due;
+            // When an `asap` deadline was first set
+            steady_clock::time_point since;
+            bool asap = false;
+        };
+        std::unordered_map<int, deadline_t> deadlines_;
+        std::atomic<uint64_t> duplicated_requests_{0};
+        std::atomic<streaming_quality_mode_t> quality_mode_{kStreamingQualityOff};
+        streaming_quality_stats_t quality_stats_{};
+    };
+
+    class streaming_torrent_plugin;
+
+    // Tracks the block requests we sent to one peer and how fast it delivers
+    class streaming_peer_plugin final : public lt::peer_plugin {
+    public:
+        explicit streaming_peer_plugin(lt::peer_connection_handle p)
+                : peer_connection_(std::move(p))
+        {}
+
+        void sent_request(lt::peer_request const& r) override;
+
+        void sent_cancel(lt::peer_request const& r) override;
+
+        bool on_piece(lt::peer_request const& r, lt::span<char const> buf) override;
+
+        bool on_reject(lt::peer_request const& r) override;
+
+        bool on_choke() override;
+
+        void tick() override;
+
+    private:
+        friend class streaming_torrent_plugin;
+
+        struct request_t {
+            int piece;
+            int block;
+            steady_clock::time_point sent;
+        };
+
+        [[nodiscard]] bool has_request(int piece, int block) const;
+        void erase_request(int piece, int block);
+        void erase_piece(int piece);
+
+        [[nodiscard]] steady_clock::duration oldest_request_age(steady_clock::time_point now) const;
+
+        lt::peer_connection_handle peer_connection_;
+        std::vector<request_t> requests_;
+
+        int64_t bytes_since_tick_ = 0;
+        // Smoothed payload bytes per second
+        double rate_ = 0;
+        // Smoothed time from sending a block request to receiving the block
+        double rtt_millis_ = 0;
+        int rtt_samples_ = 0;
+        // Consecutive ticks this peer was slow
+        int slow_ticks_ = 0;
+    };
+
+    /**
+     * Streaming endgame: when a deadline piece is about to miss its deadline, the blocks of it that are still
+     * outstanding are requested again from up to `max_extra_peers` other peers, fastest first. libtorrent cancels
+     * the duplicates once one copy arrives. This keeps one slow peer from holding the playhead.
+     *
+     * With a streaming_quality_mode_t other than off, peers whose block round-trip time is well above the median
+     * for several ticks lose their requests for deadline pieces to the fastest low-RTT peers, before the deadline
+     * gets close.
+     */
+    class streaming_torrent_plugin final : public lt::torrent_plugin {
+    public:
+        explicit streaming_torrent_plugin(std::shared_ptr<endgame_state_t> state)
+                : state_(std::move(state))
+        {}
+
+        std::shared_ptr<lt::peer_plugin> new_connection(lt::peer_connection_handle const& handle) override;
+
+        void on_piece_pass(lt::piece_index_t piece) override;
+
+        void on_piece_failed(lt::piece_index_t piece) override;
+
+        void tick() override;
+
+    private:
+        using peer_list_t = std::vector<std::shared_ptr<streaming_peer_plugin>>;
+
+        /// Live peers, fastest first
+        peer_list_t live_peers();
+
+        void apply_quality_mode(const peer_list_t &peers, steady_clock::time_point now);
+        void run_endgame(const peer_list_t &peers, steady_clock::time_point now);
+
+        std::shared_ptr<endgame_state_t> state_;
+        std::vector<std::weak_ptr<streaming_peer_plugin>> peers_;
+    };
+} // namespace anilt::plugin
+
+
+#endif //ANI_STREAMING_PLUGIN_H
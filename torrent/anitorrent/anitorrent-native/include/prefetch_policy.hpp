@@ -0,0 +1,66 @@
+#ifndef PREFETCH_POLICY_H
+#define PREFETCH_POLICY_H
+
+#include <mutex>
+#include <vector>
+
+#include "libtorrent/torrent_handle.hpp"
+#include "torrent_handle_t.hpp"
+
+namespace anilt {
+/**
+ * While a file of a multi-file torrent is streaming, downloads the start and the end of the next file in index
+ * order at low priority, so that playing it starts without waiting for its metadata.
+ *
+ * Only pieces that would not be downloaded otherwise (priority 0) are raised, and they are set back to 0 whenever
+ * the buffer of the playing file is short, so prefetching never competes with playback. A piece whose priority was
+ * changed by someone else since the policy last set it is left alone from then on. Thread-safe: `update` is called
+ * from the alert loop while the other functions are called from Kotlin.
+ */
+class prefetch_policy_t final {
+  public:
+    explicit prefetch_policy_t(lt::torrent_handle handle) : handle_(std::move(handle)) {}
+
+    prefetch_policy_t(const prefetch_policy_t &) = delete;
+    prefetch_policy_t &operator=(const prefetch_policy_t &) = delete;
+
+    /// Bytes prefetched from the start of the next file, 0 to disable
+    void set_size(int64_t bytes);
+
+    /// Targets the file after `config.file_index`, and the end of it given by `config.footer_size`
+    void start(const streaming_config_t &config);
+
+    /// Sets the prefetched pieces that are not downloaded back to priority 0
+    void stop();
+
+    /**
+     * Yields while fewer than half of streaming_config_t::window_size pieces are finished ahead of the playhead,
+     * and resumes once a whole window is. See streaming_scheduler_t::buffered_pieces.
+     */
+    void update(int buffered_pieces);
+
+    /// File being prefetched, -1 if none
+    [[nodiscard]] int target_file() const;
+
+  private:
+    // Caller holds lock_
+    void retarget();
+    /// Sets `pieces_` still at `applied_` to `priority` and drops the others
+    void apply(lt::download_priority_t priority);
+    void release();
+
+    const lt::torrent_handle handle_;
+    mutable std::mutex lock_;
+    int64_t size_ = 0;
+    bool streaming_ = false;
+    streaming_config_t config_{};
+    int target_file_ = -1;
+    // Pieces raised from priority 0
+    std::vector<int> pieces_{};
+    // Priority last set on pieces_
+    lt::download_priority_t applied_ = lt::dont_download;
+    bool yielding_ = false;
+};
+} // namespace anilt
+
+#endif // PREFETCH_POLICY_H
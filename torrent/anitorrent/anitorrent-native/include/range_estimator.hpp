@@ -0,0 +1,42 @@
+#ifndef RANGE_ESTIMATOR_H
+#define RANGE_ESTIMATOR_H
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+
+#include "libtorrent/torrent_handle.hpp"
+#include "torrent_handle_t.hpp"
+
+namespace anilt {
+/**
+ * Estimates when a byte range of one torrent will be downloaded.
+ *
+ * Two rates are combined: the rate at which pieces completed over the last kWindow, and the current payload rate
+ * of the connected peers that have at least one missing piece of the range. The confidence grows with the number
+ * of recent completions and with how well both rates agree, and decays for estimates far in the future.
+ *
+ * `on_piece_finished` is called from the alert loop, `estimate` from any thread.
+ */
+class range_estimator_t final {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr auto kWindow = std::chrono::seconds(30);
+
+    void on_piece_finished(clock::time_point now);
+
+    /// Queries `handle` for piece, download queue, availability and peer state. Requires metadata.
+    [[nodiscard]] range_eta_t estimate(const lt::torrent_handle &handle, int file_index, int64_t offset,
+                                       int64_t length, clock::time_point now) const;
+
+  private:
+    /// Pieces completed per second over the window, and the number of completions it is based on
+    [[nodiscard]] double completion_rate(clock::time_point now, int &samples) const;
+
+    mutable std::mutex lock_;
+    std::deque<clock::time_point> completions_{};
+};
+} // namespace anilt
+
+#endif // RANGE_ESTIMATOR_H
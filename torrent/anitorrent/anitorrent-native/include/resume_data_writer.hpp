@@ -0,0 +1,83 @@
+#ifndef RESUME_DATA_WRITER_H
+#define RESUME_DATA_WRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "events.hpp"
+
+namespace anilt {
+/**
+ * Persists resume data on a background I/O thread, so that saving many torrents does not stall event processing.
+ *
+ * Each file is written to `<path>.tmp`, synced and then atomically renamed over `<path>`, so a crash mid-write
+ * leaves either the old or the new file, never a truncated one. Repeated saves to the same path that are still
+ * pending are coalesced into the latest one, which completes all of them. All files of one batch are written first
+ * and synced together, and each directory of the batch is opened and synced once.
+ *
+ * Completions are queued and delivered by `deliver_completions` on the thread that processes events.
+ */
+class resume_data_writer_t final {
+  public:
+    /// `notify` is called from the I/O thread when completions are available.
+    explicit resume_data_writer_t(std::function<void()> notify);
+    ~resume_data_writer_t();
+
+    resume_data_writer_t(const resume_data_writer_t &) = delete;
+    resume_data_writer_t &operator=(const resume_data_writer_t &) = delete;
+
+    void enqueue(handle_id_t handle_id, std::vector<char> &&data, std::string path);
+
+    /// Blocks until all saves enqueued before this call are done. Returns false on timeout.
+    bool flush(std::chrono::milliseconds timeout);
+
+    void set_fsync(bool enabled);
+
+    /// Calls `on_resume_data_saved` for every save completed since the last call.
+    void deliver_completions(event_listener_t &listener);
+
+    /// Writes `data` to `path` through a temporary file and an atomic rename. Blocks.
+    static bool write_atomically(const std::vector<char> &data, const std::string &path, bool fsync);
+
+  private:
+    struct job_t {
+        std::vector<char> data;
+        std::string path;
+        // Handles whose saves were coalesced into this job, in enqueue order
+        std::vector<handle_id_t> handle_ids;
+    };
+
+    struct completion_t {
+        handle_id_t handle_id;
+        bool success;
+    };
+
+    void run();
+
+    std::function<void()> notify_;
+
+    std::mutex lock_;
+    std::condition_variable jobs_changed_;
+    // By path
+    std::unordered_map<std::string, job_t> pending_{};
+    std::vector<std::string> order_{};
+    // Incremented when a job is enqueued / when a batch containing it is done. Used by flush.
+    uint64_t enqueued_ = 0;
+    uint64_t done_ = 0;
+    bool fsync_ = true;
+    bool stopping_ = false;
+
+    std::mutex completions_lock_;
+    std::vector<completion_t> completions_{};
+
+    std::thread thread_;
+};
+} // namespace anilt
+
+#endif // RESUME_DATA_WRITER_H
@@ -0,0 +1,50 @@
+#ifndef SESSION_STATS_H
+#define SESSION_STATS_H
+
+#include <array>
+
+#include "events.hpp"
+#include "libtorrent/alert_types.hpp"
+
+namespace anilt {
+/**
+ * Turns the raw counters of `session_stats_alert` into `session_stats_t`.
+ *
+ * Counter indices are looked up once by name. The previous snapshot is kept to compute deltas and per-second rates,
+ * so the first alert only reports totals and gauges.
+ */
+class session_stats_collector_t final {
+  public:
+    session_stats_collector_t();
+
+    void update(const lt::session_stats_alert &alert, session_stats_t &stats);
+
+  private:
+    enum metric_t {
+        kRecvPayloadBytes,
+        kSentPayloadBytes,
+        kRecvBytes,
+        kSentBytes,
+        kRecvIpOverheadBytes,
+        kSentIpOverheadBytes,
+        kRecvRedundantBytes,
+        kRecvFailedBytes,
+        kQueuedDiskJobs,
+        kQueuedWriteBytes,
+        kBlocksRead,
+        kBlocksCacheHits,
+        kPeersConnected,
+        kDhtNodes,
+        kMetricCount,
+    };
+
+    [[nodiscard]] int64_t value(lt::span<const int64_t> counters, metric_t metric) const;
+
+    std::array<int, kMetricCount> indices_{};
+    std::array<int64_t, kMetricCount> previous_{};
+    lt::time_point previous_time_{};
+    bool has_previous_ = false;
+};
+} // namespace anilt
+
+#endif // SESSION_STATS_H
@@ -3,7 +3,12 @@
 #define SESSION_T_H
 #include <string>
 
+#include "alert_pump.hpp"
+#include "event_buffer.hpp"
+#include "http_server.hpp"
 #include "events.hpp"
+#include "listener_router.hpp"
+#include "resume_data_writer.hpp"
 #include "torrent_add_info_t.hpp"
 #include "torrent_handle_t.hpp"
 #include "torrent_info_t.hpp"
@@ -52,6 +57,16 @@ struct session_settings_t final {
     /// libtorrent::settings_pack::handshake_client_version
     std::string handshake_client_version{};
 
+    /// Bounds of libtorrent::settings_pack::alert_queue_size. The queue starts at the minimum, doubles whenever
+    /// alerts are dropped and shrinks back when it stays mostly unused. See event_listener_t::on_alerts_dropped
+    /// The minimum is the size used before the queue became adaptive, libtorrent's own default is only 2000.
+    int alert_queue_size_min = 10000;
+    int alert_queue_size_max = 100000;
+
+    /// Bytes of verified pieces kept in memory per torrent, so that torrent_handle_t::read_range does not read
+    /// them from disk again after seeking backwards. 0 disables the cache.
+    int64_t piece_cache_size = 16 * 1024 * 1024;
+
     session_settings_t() = default;
 };
 
@@ -64,6 +79,9 @@ class new_event_listener_t {
 
 class session_t final {
   public:
+    session_t() = default;
+    ~session_t();
+
     // session_settings_t is owned by Java and will be destroyed after this call
     void start(const session_settings_t &settings);
     void apply_settings(const session_settings_t &settings);
@@ -83,17 +101,180 @@ class session_t final {
 
     void process_events(event_listener_t *listener) const;
 
+    /**
+     * Same as `process_events`, but appends all events to `buffer` instead of calling a listener for each of them.
+     * @return number of bytes available to `event_buffer_t::read`
+     */
+    size_t process_events_batched(event_buffer_t *buffer) const;
+
     void remove_listener() const;
 
+    /**
+     * Delivers the events of torrent `handle_id` to `listener` instead of the listener passed to `process_events`
+     * or `drain_events`. Pass nullptr to remove the route. Session-wide events always go to the latter.
+     *
+     * `listener` is called on the thread that processes events. Its routes are removed when it is destroyed.
+     */
+    void set_torrent_listener(handle_id_t handle_id, event_listener_t *listener) const;
+
+    /// When enabled, events of torrents without a listener set by `set_torrent_listener` are dropped.
+    void set_drop_unrouted_events(bool enabled) const;
+
+    /**
+     * Narrows libtorrent's alert_mask to the alerts that feed `listener->subscribed_events` and the subscriptions of
+     * the listeners set by `set_torrent_listener`, so that libtorrent does not allocate alerts nobody consumes.
+     * The alert pump only queues these events as well. Call again after changing `subscribed_events`.
+     */
+    void subscribe(const event_listener_t *listener);
+
+    /**
+     * When enabled, `on_block_downloading` and `on_piece_finished` of one batch of alerts are folded into one
+     * `event_listener_t::on_piece_progress` per torrent. The events of one torrent stay in alert order: its progress
+     * is delivered before its next other event, or at the end of the batch. Block indexes are not kept, see
+     * event_listener_t::kUnknownBlockIndex.
+     */
+    void set_coalesce_piece_progress(bool enabled);
+
+    /**
+     * Starts a native thread that waits for alerts, translates them and queues the events, so that the consumer
+     * no longer has to pop alerts itself. `listener` is notified from the pump thread when new events are queued.
+     *
+     * While the pump is running, `process_events` does nothing. Use `drain_events` instead.
+     *
+     * @param capacity maximum number of queued events. The pump waits for the consumer when the queue is full.
+     * Ignored if a stopped pump still has events, which is then started again.
+     */
+    bool start_alert_pump(new_event_listener_t *listener, int capacity = 4096);
+
+    /**
+     * Stops the pump thread. Events it already queued are not lost: the next `process_events` or `drain_events`
+     * delivers them before any new event. The listener of `set_new_event_listener` is notified of alerts again.
+     */
+    void stop_alert_pump();
+
+    /**
+     * Delivers the events queued by the alert pump to `listener`, without locking.
+     * Must only be called from one thread at a time.
+     * @return number of events delivered
+     */
+    int drain_events(event_listener_t *listener) const;
+
+    /// Same as `drain_events`, but appends the events to `buffer`. See `process_events_batched`.
+    size_t drain_events_batched(event_buffer_t *buffer) const;
+
     void set_peer_filter(anilt::peer_filter_t *filter);
 
     /// blocks
     void wait_for_alert(int timeout_seconds) const;
 
+    /**
+     * Posts one state update covering only the torrents whose status changed since the previous call, delivered as
+     * event_listener_t::on_status_update with `torrent_stats_t::changed_fields` set. Torrents whose reported fields
+     * did not change are skipped, except for the first update after a listener attached. Prefer this over calling
+     * torrent_handle_t::post_status_updates for every torrent, which is always delivered.
+     */
+    void post_torrent_updates() const;
+
+    /// Posts a session_stats_alert, delivered as event_listener_t::on_session_stats
     void post_session_stats() const;
 
+    /**
+     * Records how long alerts take from being posted by libtorrent to each latency_stage_t, per alert type.
+     * Cheap enough to leave enabled. See `latency_summary`.
+     */
+    void set_latency_tracking(bool enabled) const;
+
+    /**
+     * @param stage a latency_stage_t
+     * @param alert_type libtorrent alert type (`lt::alert::type()`), or -1 for all alerts
+     */
+    [[nodiscard]] latency_summary_t latency_summary(int stage, int alert_type = -1) const;
+
+    void reset_latency_stats() const;
+
+    /// Current libtorrent alert_queue_size, see session_settings_t::alert_queue_size_min
+    [[nodiscard]] int alert_queue_size() const;
+
+    /**
+     * Saves `data` to `path` on a background I/O thread, through a temporary file and an atomic rename.
+     * `data` is moved and is empty after this call. If a save for the same torrent is still pending, it is
+     * replaced by this one.
+     *
+     * Completion is delivered as event_listener_t::on_resume_data_saved by `process_events` or `drain_events`.
+     */
+    bool save_resume_data(handle_id_t handle_id, torrent_resume_data_t &data, const std::string &path) const;
+
+    /**
+     * Blocks until all pending `save_resume_data` calls are written, e.g. before shutdown.
+     * @return false if the timeout elapsed first
+     */
+    bool flush_resume_data(int timeout_millis) const;
+
+    /// Whether `save_resume_data` syncs the files to disk before renaming them. Enabled by default.
+    void set_resume_data_fsync(bool enabled) const;
+
+    /**
+     * Starts an HTTP server on 127.0.0.1 that streams file `i` of the torrent with handle id `id` at
+     * `http://127.0.0.1:<port>/<id>/<i>`, with Range support. A name can be appended to the path
+     * (e.g. `/<id>/<i>/video.mkv`) for players that look at the extension.
+     *
+     * Responses wait for the pieces they cover, for at most `read_timeout_millis` per piece.
+     * Alerts must be processed while it runs.
+     *
+     * @param port 0 to pick any free port
+     * @return the bound port, or -1. If the server is already running, its port.
+     */
+    int start_http_server(int port = 0, int read_timeout_millis = 60000);
+
+    void stop_http_server();
+
+    /// -1 if the server is not running
+    [[nodiscard]] int http_server_port() const;
+
+    /**
+     * Releases the memory of the ByteBuffers returned by torrent_handle_t::get_piece_state_buffer for torrent
+     * `handle_id`: now if the torrent is removed, otherwise when it is. Call once they are no longer used, they must
+     * not be accessed after that and the removal. Until then, the memory of removed torrents is kept.
+     */
+    void release_piece_state_buffer(handle_id_t handle_id) const;
+
   private:
+    /// Wraps `fallback` so that torrent events go to the listeners set by `set_torrent_listener`
+    listener_router_t make_router(event_listener_t &fallback) const;
+
+    [[nodiscard]] std::shared_ptr<alert_pump_t> pump() const;
+
+    /// Forgets `alert_pump` once it is stopped and all its events are delivered
+    void release_stopped_pump(const std::shared_ptr<alert_pump_t> &alert_pump) const;
+
+    /// Notifies `listener` of new alerts, or nobody if nullptr. Caller holds the global lock.
+    void install_alert_notify(lt::session &session, new_event_listener_t *listener) const;
+
+    /// Applies the union of the subscriptions of all listeners to the alert mask and the alert pump
+    void update_subscriptions() const;
+
     std::shared_ptr<libtorrent::session> session_;
+    std::shared_ptr<alert_dispatcher_t> dispatcher_;
+    mutable lt::alert_category_t alert_mask_{};
+    // Listener of the previous process_events or drain_events, to deliver fresh stats to a new one
+    mutable std::atomic<event_listener_t *> last_listener_{nullptr};
+    // subscribed_events of the listener passed to `subscribe`
+    std::atomic<uint32_t> subscribed_events_{event_listener_t::kAllEvents};
+    // Read by drain_events and process_events without the global lock, use `pump()` to take a snapshot
+    mutable std::mutex alert_pump_lock_;
+    mutable std::shared_ptr<alert_pump_t> alert_pump_;
+    std::atomic<bool> coalesce_piece_progress_{false};
+    std::shared_ptr<resume_data_writer_t> resume_writer_;
+    std::shared_ptr<http_server_t> http_server_;
+    // Listener to wake up when events arrive from native threads other than libtorrent's
+    mutable std::atomic<new_event_listener_t *> new_event_listener_{nullptr};
+    // Listener of `set_new_event_listener`, notified of alerts while the alert pump is not running. Guarded by the
+    // global lock.
+    mutable new_event_listener_t *alert_notify_listener_ = nullptr;
+    const std::shared_ptr<torrent_listener_table_t> torrent_listeners_ = std::make_shared<torrent_listener_table_t>();
+    // Serializes update_subscriptions
+    mutable std::mutex subscriptions_lock_;
+    mutable std::atomic<bool> drop_unrouted_events_{false};
     peer_filter_t * peer_filter_ = nullptr;
     static bool compute_add_torrent_params(const torrent_add_info_t &info, lt::add_torrent_params &params);
 };
@@ -0,0 +1,76 @@
+#ifndef ANI_SPSC_QUEUE_H
+#define ANI_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace anilt {
+/**
+ * Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ *
+ * Capacity is rounded up to a power of two.
+ */
+template<typename T>
+class spsc_queue_t final {
+  public:
+    explicit spsc_queue_t(const size_t capacity) : slots_(round_up(capacity)), mask_(slots_.size() - 1) {}
+
+    spsc_queue_t(const spsc_queue_t &) = delete;
+    spsc_queue_t &operator=(const spsc_queue_t &) = delete;
+
+    /// Producer only. Returns false if the queue is full, in which case `value` is left untouched.
+    bool try_push(T &&value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ == slots_.size()) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == slots_.size())
+                return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer only. Returns false if the queue is empty.
+    bool try_pop(T &out) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+                return false;
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] size_t capacity() const { return slots_.size(); }
+
+    /// Approximate when called concurrently.
+    [[nodiscard]] size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+  private:
+    static size_t round_up(const size_t capacity) {
+        size_t n = 1;
+        while (n < capacity)
+            n <<= 1;
+        return n;
+    }
+
+    std::vector<T> slots_;
+    const size_t mask_;
+
+    // Consumer side
+    alignas(64) std::atomic<size_t> head_{0};
+    size_t cached_tail_ = 0;
+
+    // Producer side
+    alignas(64) std::atomic<size_t> tail_{0};
+    size_t cached_head_ = 0;
+};
+} // namespace anilt
+
+#endif // ANI_SPSC_QUEUE_H
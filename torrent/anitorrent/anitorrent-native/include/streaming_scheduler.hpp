@@ -0,0 +1,119 @@
+#ifndef STREAMING_SCHEDULER_H
+#define STREAMING_SCHEDULER_H
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "libtorrent/torrent_handle.hpp"
+#include "media_index.hpp"
+#include "plugin/streaming_plugin.h"
+#include "torrent_handle_t.hpp"
+
+namespace anilt {
+/**
+ * Keeps a sliding window of pieces with deadlines ahead of the playhead of one file, like Kotlin's
+ * TorrentDownloadController, but advanced directly from piece_finished_alert in the alert loop.
+ *
+ * The window holds up to `window_size` unfinished pieces from the piece of the last seek: whenever one of them
+ * finishes, the next unfinished piece is appended, so that libtorrent focuses on the pieces needed next.
+ * When playback starts, the pieces holding the file's header and footer are requested too, because players read
+ * metadata from both ends, or exactly the pieces holding the container index if a media_index_t is known.
+ *
+ * Deadlines grow by a fixed step along the window, or follow the time playback reaches each piece once a bitrate
+ * is known (see `update_playback`).
+ *
+ * Thread-safe: `seek` is called from Kotlin while `on_piece_finished` is called from the alert loop.
+ */
+class streaming_scheduler_t final {
+  public:
+    /// `handle` must have metadata. Deadlines are also recorded in `endgame`.
+    streaming_scheduler_t(lt::torrent_handle handle, const streaming_config_t &config,
+                          std::shared_ptr<plugin::endgame_state_t> endgame);
+
+    [[nodiscard]] bool valid() const { return first_piece_ <= last_piece_; }
+
+    /**
+     * Replaces the header and footer guessed from the config by the metadata ranges of `index`. Ranges in the
+     * second half of the file are treated as the footer. Call before the first `seek`.
+     */
+    void use_media_index(const media_index_t &index);
+
+    /// Moves the window to start at `piece_index` and reprioritizes. Pieces leaving the window lose their deadline.
+    void seek(int piece_index);
+
+    /// Resets the deadlines of the window and empties it. The scheduler does nothing more until the next `seek`.
+    void stop();
+
+    void on_piece_finished(int piece_index);
+
+    /**
+     * Replaces the finished pieces, e.g. after a recheck or lost piece_finished_alerts, and refills the window from
+     * the piece of the last `seek`. Pieces leaving the window lose their deadline.
+     */
+    void sync_finished(const std::vector<bool> &finished);
+
+    /// See torrent_handle_t::update_streaming_playback. Reapplies the deadlines of the window.
+    void update_playback(int64_t position, int64_t bytes_per_second, float speed);
+
+    /// Piece holding `position`, a byte offset in the file. -1 if the scheduler is not valid.
+    [[nodiscard]] int piece_of(int64_t position) const;
+
+    [[nodiscard]] bool is_downloading(int piece_index) const;
+
+    /**
+     * True if `piece_index` is between the piece of the last `seek` and the end of the window, finished or not, or
+     * is a header or footer piece being downloaded. Reading it needs no `seek`.
+     */
+    [[nodiscard]] bool in_window(int piece_index) const;
+
+    /**
+     * Number of finished pieces from `piece_index` up to the first unfinished piece of the file, i.e. what playback
+     * can read from there without waiting. INT_MAX if the rest of the file is finished, 0 outside the file.
+     */
+    [[nodiscard]] int buffered_pieces(int piece_index) const;
+
+  private:
+    void fill_window(int piece_index);
+    /// Next unfinished piece after `start` before the footer, or `start` if there is none
+    int find_next_downloading_piece(int start) const;
+    bool in_possible_footer(int piece_index) const;
+    /// Piece holding `offset`, an offset in the torrent clamped to the file
+    int piece_at(int64_t offset) const;
+    void apply_deadlines() const;
+    /// Deadline of a piece of the window from the playback estimates. Caller holds `lock_`.
+    int playback_deadline(int piece, std::chrono::steady_clock::time_point now) const;
+
+    const lt::torrent_handle handle_;
+    const streaming_config_t config_;
+    const std::shared_ptr<plugin::endgame_state_t> endgame_;
+
+    int64_t file_begin_ = 0;
+    int64_t file_end_ = 0;
+    int64_t piece_length_ = 0;
+    // Pieces of the file, inclusive
+    int first_piece_ = 0;
+    int last_piece_ = -1;
+    // Last piece of the window before the footer
+    int last_index_ = -1;
+    std::vector<int> header_pieces_{};
+    std::vector<int> footer_pieces_{};
+    int possible_footer_first_ = 0;
+    int possible_footer_last_ = -1;
+
+    mutable std::mutex lock_;
+    std::vector<bool> finished_{};
+    std::vector<int> downloading_{};
+    // Piece of the last seek
+    int window_start_ = 0;
+    int window_end_ = -1;
+
+    // Playback estimates from update_playback, unused while bytes_per_second is 0
+    int64_t playback_position_ = 0;
+    int64_t playback_bytes_per_second_ = 0;
+    double playback_speed_ = 1;
+    std::chrono::steady_clock::time_point playback_updated_{};
+};
+} // namespace anilt
+
+#endif // STREAMING_SCHEDULER_H
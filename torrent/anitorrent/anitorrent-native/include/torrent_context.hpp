@@ -0,0 +1,276 @@
+#ifndef TORRENT_CONTEXT_H
+#define TORRENT_CONTEXT_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "deadline_tracker.hpp"
+#include "events.hpp"
+#include "file_recheck.hpp"
+#include "libtorrent/alert_types.hpp"
+#include "libtorrent/torrent_handle.hpp"
+#include "media_index.hpp"
+#include "piece_cache.hpp"
+#include "piece_state_map.hpp"
+#include "prefetch_policy.hpp"
+#include "range_estimator.hpp"
+#include "plugin/streaming_plugin.h"
+#include "streaming_scheduler.hpp"
+
+namespace anilt {
+/**
+ * Native state of one torrent, shared by the torrent_handle_t given to Kotlin and alert_dispatcher_t.
+ *
+ * Serves piece reads: `request_piece` asks libtorrent for a piece (setting a deadline if it is not downloaded yet),
+ * and `wait_piece` blocks until the read_piece_alert for it is dispatched. Concurrent requests for the same piece
+ * share one libtorrent read. Every piece read for a request is kept in a piece_cache_t, which serves later requests
+ * first.
+ *
+ * Alerts must be processed (by `session_t::process_events` or the alert pump) while a thread waits.
+ *
+ * Also owns the optional streaming_scheduler_t of the torrent, the media_index_t of its files, the deadlines
+ * read by its streaming plugin, the deadline_tracker_t measuring whether they are met, and the prefetch_policy_t
+ * of the file after the one streaming.
+ */
+class torrent_context_t final {
+  public:
+    struct piece_data_t {
+        boost::shared_array<char> buffer{};
+        int size = 0;
+        bool failed = false;
+    };
+
+    class piece_request_t final {
+      public:
+        [[nodiscard]] int piece() const { return piece_; }
+
+      private:
+        friend class torrent_context_t;
+        explicit piece_request_t(const int piece) : piece_(piece) {}
+
+        const int piece_;
+        // Guarded by torrent_context_t::lock_
+        bool done_ = false;
+        // read_piece was called for this request. Each request reads its piece once, see `issue_read`.
+        bool read_issued_ = false;
+        piece_data_t data_{};
+    };
+
+    torrent_context_t(lt::torrent_handle handle, int64_t cache_capacity_bytes) :
+        handle_(std::move(handle)), prefetch_(handle_), cache_(cache_capacity_bytes) {}
+
+    torrent_context_t(const torrent_context_t &) = delete;
+    torrent_context_t &operator=(const torrent_context_t &) = delete;
+
+    [[nodiscard]] const lt::torrent_handle &handle() const { return handle_; }
+
+    [[nodiscard]] const std::shared_ptr<plugin::endgame_state_t> &endgame() const { return endgame_; }
+
+    [[nodiscard]] deadline_tracker_t &deadlines() const { return *deadlines_; }
+
+    prefetch_policy_t &prefetch() { return prefetch_; }
+
+    [[nodiscard]] const range_estimator_t &range_estimator() const { return range_estimator_; }
+
+    file_recheck_t &recheck() { return recheck_; }
+
+    /// Allocates the piece state map from the current torrent status on first call. nullptr without metadata.
+    std::shared_ptr<piece_state_map_t> piece_states();
+
+    /**
+     * `piece_states`, whose memory is then given to Kotlin. When the torrent is removed, torrent_registry_t keeps
+     * exported maps until `torrent_registry_t::release_piece_states`, as the ByteBuffer over them may outlive the
+     * torrent and its handles.
+     */
+    std::shared_ptr<piece_state_map_t> export_piece_states();
+
+    /// The piece state map if `export_piece_states` returned it since the last `release_piece_states`, else nullptr
+    [[nodiscard]] std::shared_ptr<piece_state_map_t> exported_piece_states() const;
+
+    /// Kotlin no longer uses the exported map, it is freed with this context
+    void release_piece_states() { piece_states_exported_.store(false, std::memory_order_relaxed); }
+
+    /**
+     * Re-reads the piece state without blocking the caller: posts a status and a download queue query, whose alerts
+     * complete the resync through `on_resync_status` and `on_resync_queue`. Called by alert_dispatcher_t, e.g. after
+     * alerts were dropped. With `report`, the result is also delivered to the listener.
+     */
+    void request_piece_resync(bool report);
+
+    /**
+     * Called by alert_dispatcher_t with every torrent status. Completes the resync posted by request_piece_resync,
+     * and refreshes the downloading pieces (see `refresh_downloading`).
+     */
+    void on_resync_status(const lt::torrent_status &status);
+
+    /**
+     * Called by alert_dispatcher_t with the download queue posted by request_piece_resync. Updates the piece state
+     * map and returns true if the resync asked for a report, which is then stored in `progress`.
+     */
+    bool on_resync_queue(const std::vector<lt::partial_piece_info> &queue, piece_progress_t &progress);
+
+    /**
+     * Called by alert_dispatcher_t when a check (e.g. force_recheck) ends: pieces may have been lost, so the piece
+     * cache is emptied and the piece state map and the scheduler are resynced.
+     */
+    void on_torrent_checked();
+
+    /// Starts reading `piece`. If it is not downloaded yet, it is given `deadline_ms` and read once available.
+    std::shared_ptr<piece_request_t> request_piece(int piece, int deadline_ms);
+
+    /**
+     * Blocks until `request` is done or `until`. Returns false on timeout. A timed out request nobody else waits for
+     * is forgotten, unless `keep_on_timeout` because the caller waits for it again.
+     */
+    bool wait_piece(const std::shared_ptr<piece_request_t> &request, std::chrono::steady_clock::time_point until,
+                    piece_data_t &out, bool keep_on_timeout = false);
+
+    /// True if a request for `piece` is waiting for its read, so its deadline must be kept
+    [[nodiscard]] bool has_pending_read(int piece) const;
+
+    /// Called by alert_dispatcher_t. A piece also read by the recheck completes the requests once it is hashed.
+    void on_read_piece(const lt::read_piece_alert &alert);
+
+    /// Reads the pieces of pending requests again, called by alert_dispatcher_t when read_piece_alerts were dropped
+    void retry_pending_reads();
+
+    /// Called by alert_dispatcher_t
+    void on_piece_finished(int piece_index);
+
+    /// Called by alert_dispatcher_t
+    void on_block_downloading(int piece_index);
+
+    /// The next status update of this torrent is delivered even if unchanged, see torrent_handle_t::post_status_updates
+    void request_status() { status_requested_.store(true, std::memory_order_relaxed); }
+
+    /// Called by alert_dispatcher_t. True once after each `request_status`
+    bool take_status_request() { return status_requested_.exchange(false, std::memory_order_relaxed); }
+
+    /// Piece being played, around which the piece cache is kept
+    void set_playhead(int piece);
+
+    /// Lets the prefetch_policy_t yield or resume from the pieces buffered ahead of the playhead by the scheduler
+    void update_prefetch();
+
+    void set_cache_capacity(int64_t capacity_bytes);
+    [[nodiscard]] piece_cache_stats_t cache_stats() const;
+
+    /**
+     * Availability of every piece among connected peers, from libtorrent's piece picker. Also becomes the baseline
+     * of `piece_availability_changes`. All 0 while seeding, empty without metadata.
+     */
+    std::vector<int> piece_availability();
+
+    /**
+     * Pieces whose availability differs from the baseline, as (piece, availability) pairs in piece order. At most
+     * `max_changes` are returned, and only those are moved into the baseline, so the rest are returned by the
+     * next call. The first call compares against zero.
+     */
+    std::vector<std::pair<int, int>> piece_availability_changes(size_t max_changes);
+
+    void set_media_index(int file_index, std::shared_ptr<const media_index_t> index);
+    [[nodiscard]] std::shared_ptr<const media_index_t> media_index(int file_index) const;
+
+    void set_scheduler(std::shared_ptr<streaming_scheduler_t> scheduler);
+    [[nodiscard]] std::shared_ptr<streaming_scheduler_t> scheduler() const;
+
+    /// Fails all pending reads, cancels a recheck and empties the piece cache. Called when the torrent is removed.
+    void close();
+
+  private:
+    /// Marks `request` as read, returns false if it already was or is done. The caller then calls read_piece.
+    bool issue_read(const std::shared_ptr<piece_request_t> &request);
+
+    /// Reads the pending requests whose piece is finished in `states` but was never read, e.g. after a
+    /// piece_finished_alert was dropped
+    void read_finished_pending(const std::vector<uint8_t> &states);
+
+    void complete(const std::shared_ptr<piece_request_t> &request, piece_data_t &&data);
+
+    /// Completes the pending request of `piece` with the data read, and caches it. Fails it if not `ok`.
+    void complete_read(int piece, bool ok, const boost::shared_array<char> &buffer, int size);
+
+    /**
+     * Posts a download queue query to update the downloading pieces of the state map, at most once per
+     * kDownloadingRefreshInterval. Block progress alerts are only posted when the listener subscribes to them, the
+     * queue is always right. Called on the thread that dispatches alerts.
+     */
+    void refresh_downloading(std::chrono::steady_clock::time_point now);
+
+    /// One byte per piece in piece_state_map_t layout, from the torrent status. Blocks on the network thread.
+    [[nodiscard]] std::vector<uint8_t> current_piece_states() const;
+
+    /// Availability from libtorrent, all 0 when it has none for a seed. Blocks on the network thread.
+    [[nodiscard]] std::vector<int> query_piece_availability() const;
+
+    const lt::torrent_handle handle_;
+    const std::shared_ptr<piece_state_map_t> piece_states_ = std::make_shared<piece_state_map_t>();
+    const std::shared_ptr<deadline_tracker_t> deadlines_ = std::make_shared<deadline_tracker_t>();
+    const std::shared_ptr<plugin::endgame_state_t> endgame_ =
+        std::make_shared<plugin::endgame_state_t>(piece_states_, deadlines_);
+    prefetch_policy_t prefetch_;
+    range_estimator_t range_estimator_{};
+    std::atomic<bool> status_requested_{false};
+    // Piece resync in flight, only used by the thread that dispatches alerts
+    // kWaitingDownloadQueue only refreshes the downloading pieces
+    enum class resync_step_t { kIdle, kWaitingStatus, kWaitingQueue, kWaitingDownloadQueue };
+    resync_step_t resync_step_ = resync_step_t::kIdle;
+    std::chrono::steady_clock::time_point last_downloading_refresh_{};
+    std::atomic<bool> piece_states_exported_{false};
+    bool resync_report_ = false;
+    // The resync in flight may predate a check, another one follows it
+    bool resync_again_ = false;
+    std::vector<uint8_t> resync_states_{};
+
+    mutable std::mutex lock_;
+    std::condition_variable piece_done_;
+    std::unordered_map<int, std::shared_ptr<piece_request_t>> pending_reads_{};
+    bool closed_ = false;
+    piece_cache_t cache_;
+    std::unordered_map<int, std::shared_ptr<const media_index_t>> media_indexes_{};
+    std::shared_ptr<streaming_scheduler_t> scheduler_;
+    // Availability last returned to the caller of piece_availability(_changes)
+    std::vector<int> availability_baseline_{};
+    // Destroyed first: its worker completes pending reads until then
+    file_recheck_t recheck_{[this](const int piece, const bool passed, const boost::shared_array<char> &buffer,
+                                   const int size) { complete_read(piece, passed, buffer, size); }};
+};
+
+/**
+ * torrent_context_t of every torrent in the session, by handle id. Thread-safe.
+ */
+class torrent_registry_t final {
+  public:
+    /// Capacity of the piece cache of every torrent, including the ones attached later
+    void set_piece_cache_capacity(int64_t capacity_bytes);
+
+    /// Returns the context of `handle`, creating it if needed
+    std::shared_ptr<torrent_context_t> attach(const lt::torrent_handle &handle);
+
+    [[nodiscard]] std::shared_ptr<torrent_context_t> find(handle_id_t handle_id) const;
+
+    [[nodiscard]] std::vector<std::shared_ptr<torrent_context_t>> all() const;
+
+    /// Closes and forgets the context of a removed torrent
+    void remove(handle_id_t handle_id);
+
+    /**
+     * Frees the exported piece state map of `handle_id` if the torrent is removed, otherwise lets it be freed with
+     * the context when it is. See session_t::release_piece_state_buffer
+     */
+    void release_piece_states(handle_id_t handle_id);
+
+  private:
+    mutable std::mutex lock_;
+    std::unordered_map<handle_id_t, std::shared_ptr<torrent_context_t>> contexts_{};
+    // Of removed torrents, until released. See torrent_context_t::export_piece_states
+    std::unordered_map<handle_id_t, std::shared_ptr<piece_state_map_t>> exported_piece_states_{};
+    int64_t piece_cache_capacity_ = 16 * 1024 * 1024;
+};
+} // namespace anilt
+
+#endif // TORRENT_CONTEXT_H
@@ -2,13 +2,102 @@
 #ifndef TORRENT_HANDLE_T_H
 #define TORRENT_HANDLE_T_H
 
+#include "events.hpp"
 #include "libtorrent/torrent.hpp"
 #include "peer_filter.hpp"
 #include "torrent_info_t.hpp"
 
 namespace anilt {
+class torrent_context_t;
+
 extern "C" {
 
+// See torrent_handle_t::start_streaming. Defaults match Kotlin's TorrentDownloadController.
+struct streaming_config_t final {
+    int file_index = 0;
+
+    /// Maximum number of pieces with deadlines ahead of the playhead
+    int window_size = 8;
+
+    /// Bytes at the start and the end of the file requested when playback starts, for container metadata
+    int64_t header_size = 128 * 1024;
+    int64_t footer_size = 128 * 1024;
+
+    /// Seeking into this many bytes at the end of the file is treated as reading metadata and keeps the window
+    int64_t possible_footer_size = 128 * 1024;
+
+    /// Deadline of the first piece of the window
+    int first_deadline_millis = -10000;
+    /// Deadline of the other pieces: base + step * distance from the first piece (from the end for footer pieces)
+    int deadline_base_millis = -5000;
+    int deadline_step_millis = 700;
+
+    /// Once torrent_handle_t::update_streaming_playback gave a bitrate, pieces are due this long before playback
+    /// reaches them
+    int safety_margin_millis = 3000;
+
+    streaming_config_t() = default;
+};
+
+// Native memory mapped as a direct ByteBuffer by the SWIG typemap in anitorrent.i, null if `data` is null
+struct piece_state_buffer_t final {
+    char *data = nullptr;
+    int64_t size = 0;
+};
+
+// See torrent_handle_t::set_streaming_quality_mode
+enum streaming_quality_mode_t : int {
+    // libtorrent picks peers for deadline pieces
+    kStreamingQualityOff = 0,
+    // Blocks of deadline pieces held by consistently slow peers are moved to fast, low-RTT peers
+    kStreamingQualityPreferFast = 1,
+    // Also disconnects peers that stay slow, as long as enough other peers are unchoked
+    kStreamingQualityAggressive = 2,
+};
+
+struct streaming_quality_stats_t final {
+    // Median block round-trip time of the peers, -1 if not enough peers were measured
+    int32_t median_rtt_millis = -1;
+    // Peers currently considered slow
+    int32_t slow_peers = 0;
+    // Block requests moved from slow to fast peers
+    int64_t reassigned_requests = 0;
+    int64_t disconnected_peers = 0;
+};
+
+// See torrent_handle_t::estimate_range_ready
+struct range_eta_t final {
+    // Estimated time until every byte of the range is downloaded and verified, 0 if it already is,
+    // -1 if unknown (nothing is downloading, or no connected peer has a missing piece)
+    int64_t eta_millis = -1;
+    // Bytes of the missing pieces of the range, minus the blocks already received
+    int64_t remaining_bytes = 0;
+    int32_t missing_pieces = 0;
+    // Missing pieces with blocks received or requested
+    int32_t in_flight_pieces = 0;
+    // Download rate the estimate is based on, in bytes per second
+    int64_t rate_bytes_per_second = 0;
+    // 0 to 1. See range_estimator_t
+    float confidence = 0;
+};
+
+enum media_container_t : int {
+    kMediaContainerUnknown = 0,
+    kMediaContainerMp4 = 1,
+    kMediaContainerMkv = 2,
+};
+
+// See torrent_handle_t::get_media_index_info
+struct media_index_info_t final {
+    // media_container_t, kMediaContainerUnknown if no index is loaded
+    int container = kMediaContainerUnknown;
+    int64_t duration_millis = 0;
+    int32_t num_keyframes = 0;
+    /// Range in the file of the moov box or the Cues element, 0 if there is none
+    int64_t index_offset = 0;
+    int64_t index_size = 0;
+};
+
 class torrent_handle_t final {
   public:
     unsigned int id = 0;
@@ -38,9 +127,102 @@ class torrent_handle_t final {
     void reset_piece_deadline(int32_t index) const;
     void clear_piece_deadlines() const;
 
-    /// This function blocks.
+    /**
+     * Sets the deadlines of `count` pieces starting at `first_piece` to `base_deadline + i * step_deadline` and
+     * makes sure they are downloaded, in one call. With `clear_others`, the deadlines of other pieces are reset first,
+     * which is what a seek needs, except those of pieces a pending read waits for.
+     */
+    void set_piece_deadlines(int32_t first_piece, int count, int base_deadline, int step_deadline,
+                             bool clear_others) const;
+
+    /**
+     * Sets the priority of every piece from `buffer` (a direct ByteBuffer), one byte per piece.
+     * Pieces after `num_pieces` are not changed. Priorities above 7 are clamped to 7, and nothing is changed if
+     * `num_pieces` exceeds the number of pieces. See libtorrent::download_priority_t
+     */
+    void prioritize_pieces(char *buffer, int num_pieces) const;
+
+    /**
+     * Sets the priority of the first `num_pieces` pieces from a bitmap in `buffer` (a direct ByteBuffer): piece i is
+     * bit (i % 8) of byte (i / 8), and gets `set_priority` if the bit is set and `unset_priority` otherwise.
+     * `num_pieces` must be the number of pieces of the torrent, otherwise nothing is changed. Priorities are clamped
+     * to 7.
+     */
+    void prioritize_pieces_bitmap(char *buffer, int num_pieces, uint8_t set_priority, uint8_t unset_priority) const;
+
+    /**
+     * Enables the streaming endgame of this torrent: when a piece with a deadline is about to miss it, its
+     * outstanding blocks are also requested from other fast peers. Disabled by default.
+     */
     void set_peer_endgame(bool endgame) const;
 
+    /**
+     * @param threshold_millis how long before its deadline a piece is considered late
+     * @param min_request_age_millis only blocks requested at least this long ago are duplicated
+     * @param max_extra_peers maximum number of additional peers requesting the same block
+     */
+    void configure_peer_endgame(int threshold_millis, int min_request_age_millis, int max_extra_peers) const;
+
+    /**
+     * Deadlines of 0 or less (as soon as possible) are due `grace_millis` after they are first set, which is when
+     * the deadline statistics count them as missed. 3000 by default.
+     */
+    void set_asap_deadline_grace(int grace_millis) const;
+
+    /// Number of block requests duplicated by the streaming endgame so far
+    [[nodiscard]] int64_t get_endgame_duplicated_requests() const;
+
+    /**
+     * Sets how peers are picked for the blocks of pieces with deadlines, a streaming_quality_mode_t.
+     * The block round-trip time and throughput of every peer are measured in any mode.
+     */
+    void set_streaming_quality_mode(int mode) const;
+
+    [[nodiscard]] streaming_quality_stats_t get_streaming_quality_stats() const;
+
+    /**
+     * Whether pieces met the deadlines set by set_piece_deadline(s), read_range and the streaming scheduler.
+     * Each late piece is also reported by event_listener_t::on_deadline_missed.
+     */
+    [[nodiscard]] deadline_stats_t get_deadline_stats() const;
+
+    /// Resets the counters of get_deadline_stats, e.g. after changing the streaming window
+    void reset_deadline_stats() const;
+
+    /**
+     * Direct ByteBuffer over the state of every piece, updated in place by the alert loop. See piece_state_map_t
+     * for the layout; use native byte order. Null until the torrent has metadata.
+     *
+     * Finished pieces and deadlines are always tracked. Downloading pieces are synced from libtorrent's download
+     * queue, at most once a second as pieces finish and on status updates, and also follow block progress alerts
+     * while the listener subscribes to kEventBlockDownloading or kEventPieceProgress.
+     *
+     * The memory is not owned by the ByteBuffer: it stays valid after the torrent is removed and this
+     * torrent_handle_t is deleted, until session_t::release_piece_state_buffer is called for this torrent or the
+     * session is destroyed. Every call returns the same memory.
+     */
+    [[nodiscard]] piece_state_buffer_t get_piece_state_buffer() const;
+
+    /**
+     * Writes the number of connected peers that have each piece into `buffer` (a direct ByteBuffer), one byte per
+     * piece saturated at 255, for up to `size` pieces. libtorrent does not track availability once the torrent is a
+     * seed, all pieces are then 0.
+     *
+     * The snapshot also becomes the baseline of get_piece_availability_changes.
+     *
+     * @return number of pieces of the torrent, which may exceed `size`, or -1 without metadata
+     */
+    int get_piece_availability(char *buffer, int size) const;
+
+    /**
+     * Writes the pieces whose availability changed since the previous get_piece_availability(_changes) into
+     * `buffer` (a direct ByteBuffer) as records of i32 piece index, i32 availability, in native byte order and
+     * piece order. Changes that do not fit in `size` bytes are returned by the next call.
+     *
+     * @return number of records written, or -1 without metadata
+     */
+    int get_piece_availability_changes(char *buffer, int size) const;
+
     void add_tracker(const std::string &url, std::uint8_t tier = 0, std::uint8_t fail_limit = 0) const;
 
     void resume() const;
@@ -55,11 +237,139 @@ class torrent_handle_t final {
     // Return empty string if handle is not valid
     std::string make_magnet_uri();
 
+    enum read_range_error_t : int {
+        kReadRangeInvalidHandle = -1,
+        kReadRangeInvalidArgument = -2,
+        kReadRangeTimeout = -3,
+        kReadRangeFailed = -4,
+    };
+
+    /**
+     * Reads up to `length` bytes of file `file_index` starting at `offset` into `buffer` (a direct ByteBuffer).
+     * Pieces not downloaded yet get deadlines in reading order, and are read through libtorrent's disk cache as
+     * soon as they pass the hash check. This function blocks, while alerts must be processed by another thread.
+     *
+     * @return number of bytes read, which is less than `length` at the end of the file or if the timeout elapsed
+     * after some bytes were read. Otherwise a negative read_range_error_t.
+     */
+    int read_range(int file_index, int64_t offset, char *buffer, int length, int timeout_millis) const;
+
+    /**
+     * Starts a native sliding-window scheduler for a file: pieces ahead of the playhead get deadlines, and the
+     * window advances from piece_finished_alert inside the alert loop, without calling back into Kotlin.
+     * Replaces a previous scheduler. Requires metadata.
+     */
+    bool start_streaming(const streaming_config_t &config) const;
+
+    /// Moves the window of the scheduler to `piece_index` (an index in the torrent) and reprioritizes pieces.
+    /// Pieces of the previous window outside the new one lose their deadline.
+    void seek_streaming(int piece_index) const;
+
+    /// Removes the scheduler and resets the deadlines of its window.
+    void stop_streaming() const;
+
+    /**
+     * Switches the deadlines of the scheduler from fixed steps to the time playback will reach each piece: a piece
+     * starting `d` bytes after `position` is due in `d / (bytes_per_second * speed)` minus
+     * streaming_config_t::safety_margin_millis. Pieces at or behind the position, and metadata pieces, keep
+     * first_deadline_millis. Call again whenever the estimates change; the position is extrapolated in between.
+     *
+     * @param position byte offset of playback in the file
+     * @param bytes_per_second bitrate estimate of the media, 0 to go back to fixed steps
+     * @param speed playback speed, 1 for normal. 0 (paused) is treated as 1 so that the buffer keeps filling.
+     */
+    void update_streaming_playback(int64_t position, int64_t bytes_per_second, float speed) const;
+
+    /**
+     * Predicts when bytes [offset, offset + length) of file `file_index` will be readable, from the pieces
+     * completed recently, the blocks in flight and the rates of the peers that have the missing pieces.
+     * Assumes the range gets the torrent's throughput, which holds when its pieces have deadlines.
+     */
+    [[nodiscard]] range_eta_t estimate_range_ready(int file_index, int64_t offset, int64_t length) const;
+
+    /**
+     * While a file is streaming, downloads the first `bytes` (at least streaming_config_t::header_size) and the
+     * last footer_size bytes of the next file in index order at low priority, so that the next episode of a season
+     * pack starts instantly. Only pieces with priority 0 are raised, and they go back to 0 while fewer than
+     * half of streaming_config_t::window_size pieces are finished ahead of the playhead, so prefetching yields to
+     * playback. It resumes once a whole window is finished ahead. 0 disables it.
+     */
+    void set_next_file_prefetch(int64_t bytes) const;
+
+    /// File being prefetched, -1 if none
+    [[nodiscard]] int get_prefetch_file() const;
+
+    /// Whether the scheduler currently requests `piece_index`
+    [[nodiscard]] bool is_streaming_piece(int piece_index) const;
+
+    /**
+     * Sets how many bytes of verified pieces `read_range` keeps in memory for this torrent, replacing
+     * session_settings_t::piece_cache_size until the next `session_t::apply_settings`. 0 disables the cache.
+     */
+    void set_piece_cache_size(int64_t capacity_bytes) const;
+
+    [[nodiscard]] piece_cache_stats_t get_piece_cache_stats() const;
+
+    enum media_index_result_t : int {
+        kMediaIndexReady = 0,
+        kMediaIndexInvalidHandle = -1,
+        kMediaIndexInvalidArgument = -2,
+        kMediaIndexTimeout = -3,
+        kMediaIndexFailed = -4,
+        kMediaIndexUnsupported = -5,
+    };
+
+    enum recheck_result_t : int {
+        kRecheckStarted = 0,
+        // No piece of the file is downloaded
+        kRecheckNothingToCheck = 1,
+        kRecheckInvalidHandle = -1,
+        kRecheckInvalidArgument = -2,
+        // Another file of this torrent is being checked
+        kRecheckBusy = -3,
+        // v2-only torrent
+        kRecheckUnsupported = -4,
+    };
+
+    /**
+     * Verifies the downloaded pieces overlapping file `file_index` against the piece hashes, reading nothing
+     * else, so that a modified or truncated file is found in seconds instead of rechecking the whole torrent.
+     * Runs in the alert loop; progress is reported by event_listener_t::on_recheck_progress.
+     *
+     * libtorrent has no way to mark single pieces as missing. If pieces fail and `full_recheck_on_failure` is set,
+     * a full `force_recheck` is started at the end to download them again; otherwise they are only reported. When
+     * the full check ends, the piece cache is emptied and the piece states are resynced.
+     * Data that fails the check is neither cached nor returned by read_range or the HTTP server.
+     *
+     * @return a recheck_result_t
+     */
+    int recheck_file(int file_index, bool full_recheck_on_failure) const;
+
+    void cancel_recheck_file() const;
+
+    /**
+     * Parses the container index (MP4 moov, Matroska SeekHead and Cues) of file `file_index` through `read_range`,
+     * so that exactly the pieces holding it are downloaded first. Once loaded, `start_streaming` requests these
+     * pieces instead of streaming_config_t::header_size and footer_size. This function blocks like `read_range`.
+     *
+     * @return a media_index_result_t
+     */
+    int load_media_index(int file_index, int timeout_millis) const;
+
+    [[nodiscard]] media_index_info_t get_media_index_info(int file_index) const;
+
+    /// Offset in file `file_index` of the last keyframe at or before `time_millis`, or -1 if unknown
+    [[nodiscard]] int64_t media_offset_for_time(int file_index, int64_t time_millis) const;
+
+    /// Piece (an index in the torrent) holding the keyframe of `media_offset_for_time`, or -1 if unknown
+    [[nodiscard]] int media_piece_for_time(int file_index, int64_t time_millis) const;
+
   private:
     friend class session_t;
 
     std::shared_ptr<libtorrent::torrent_handle> handle_;
     std::shared_ptr<torrent_info_t> info_;
+    std::shared_ptr<torrent_context_t> context_;
     // std::mutex lock;
 };
 }
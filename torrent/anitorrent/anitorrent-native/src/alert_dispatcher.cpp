@@ -0,0 +1,358 @@
+#include "alert_dispatcher.hpp"
+
+#include <algorithm>
+
+#include "global_lock.h"
+#include "libtorrent/write_resume_data.hpp"
+#include "piece_progress.hpp"
+
+namespace anilt {
+// The alert queue is halved when the largest batch stayed below a quarter of it for this long
+static constexpr auto kAlertQueueShrinkInterval = std::chrono::seconds(60);
+
+// Categories of the alerts dispatched for native state whatever the listener subscribed to: piece_finished_alert
+// (streaming scheduler, piece state), read_piece_alert (read_range, file recheck), torrent_checked_alert (piece
+// resync) and torrent_removed_alert.
+// alerts_dropped_alert is posted regardless of the alert mask.
+static constexpr lt::alert_category_t kInternalCategories =
+    lt::alert_category::piece_progress | lt::alert_category::storage | lt::alert_category::status;
+
+template<typename Alert, void (alert_dispatcher_t::*Handler)(Alert &, event_listener_t &)>
+void alert_dispatcher_t::route(const uint32_t events, const bool requires_valid_handle, const bool always) {
+    static_assert(Alert::alert_type >= 0 && Alert::alert_type < lt::num_alert_types);
+    auto &route = routes_[Alert::alert_type];
+    route.handler = [](alert_dispatcher_t &self, lt::alert *alert, event_listener_t &listener) {
+        (self.*Handler)(*static_cast<Alert *>(alert), listener);
+    };
+    route.events = events;
+    route.category = Alert::static_category;
+    route.requires_valid_handle = requires_valid_handle;
+    route.always = always;
+}
+
+alert_dispatcher_t::alert_dispatcher_t() {
+    // Non-torrent alerts
+    // Also completes piece resyncs, see torrent_context_t::request_piece_resync, and delivers recheck progress
+    route<lt::state_update_alert, &alert_dispatcher_t::on_state_update>(
+        event_bit(kEventStatusUpdate) | event_bit(kEventRecheckProgress), false, true);
+    route<lt::session_stats_alert, &alert_dispatcher_t::on_session_stats>(event_bit(kEventSessionStats), false);
+    // Needed by everyone: lost alerts grow the queue and resync piece state
+    route<lt::alerts_dropped_alert, &alert_dispatcher_t::on_alerts_dropped>(event_bit(kEventAlertsDropped), false,
+                                                                            true);
+
+    // torrent_removed_alert 可能在 set handle invalid 之后触发，需要提前处理
+    // Always dispatched to release native per-torrent state
+    route<lt::torrent_removed_alert, &alert_dispatcher_t::on_torrent_removed>(event_bit(kEventTorrentRemoved), false,
+                                                                              true);
+
+    // Answer of torrent_context_t::request_piece_resync, delivered as on_piece_progress, or of its periodic download
+    // queue refresh
+    route<lt::piece_info_alert, &alert_dispatcher_t::on_piece_info>(
+        event_bit(kEventBlockDownloading) | event_bit(kEventPieceFinished) | event_bit(kEventPieceProgress), true,
+        true);
+
+    // Feeds torrent_handle_t::read_range, whatever the listener subscribed to
+    route<lt::read_piece_alert, &alert_dispatcher_t::on_read_piece>(0, true, true);
+
+    route<lt::add_torrent_alert, &alert_dispatcher_t::on_add_torrent>(event_bit(kEventTorrentAdded));
+    // Also resyncs the piece state after a recheck, whatever the listener subscribed to
+    route<lt::torrent_checked_alert, &alert_dispatcher_t::on_torrent_checked>(event_bit(kEventChecked), true, true);
+    route<lt::metadata_received_alert, &alert_dispatcher_t::on_metadata_received>(
+        event_bit(kEventMetadataReceived));
+    route<lt::save_resume_data_alert, &alert_dispatcher_t::on_save_resume_data>(event_bit(kEventSaveResumeData));
+    // Also advances streaming_scheduler_t, whatever the listener subscribed to
+    route<lt::piece_finished_alert, &alert_dispatcher_t::on_piece_finished>(
+        event_bit(kEventPieceFinished) | event_bit(kEventPieceProgress) | event_bit(kEventDeadlineMissed), true, true);
+    route<lt::block_downloading_alert, &alert_dispatcher_t::on_block_downloading>(
+        event_bit(kEventBlockDownloading) | event_bit(kEventPieceProgress));
+    route<lt::state_changed_alert, &alert_dispatcher_t::on_state_changed>(event_bit(kEventTorrentStateChanged));
+    route<lt::file_completed_alert, &alert_dispatcher_t::on_file_completed>(event_bit(kEventFileCompleted));
+}
+
+void alert_dispatcher_t::dispatch(lt::alert *alert, event_listener_t &listener) {
+    const int type = alert->type();
+    if (type < 0 || type >= lt::num_alert_types) {
+        return;
+    }
+    const auto &route = routes_[type];
+    if (!route.handler || !(route.always || route.events & listener.subscribed_events)) {
+        return;
+    }
+    if (route.requires_valid_handle && !static_cast<lt::torrent_alert *>(alert)->handle.is_valid()) {
+        return;
+    }
+    current_alert_ = alert;
+    route.handler(*this, alert, listener);
+    current_alert_ = nullptr;
+}
+
+void alert_dispatcher_t::dispatch_all(const std::vector<lt::alert *> &alerts, event_listener_t &listener,
+                                      const bool coalesce_piece_progress) {
+    if (!coalesce_piece_progress) {
+        for (lt::alert *alert: alerts) {
+            if (alert) {
+                dispatch(alert, listener);
+            }
+        }
+        on_batch(alerts.size());
+        return;
+    }
+
+    piece_progress_coalescer_t coalescer(listener);
+    for (lt::alert *alert: alerts) {
+        if (alert) {
+            dispatch(alert, coalescer);
+        }
+    }
+    coalescer.flush();
+    on_batch(alerts.size());
+}
+
+void alert_dispatcher_t::set_alert_queue_bounds(const int min_size, const int max_size) {
+    alert_queue_size_min_ = std::max(1, min_size);
+    alert_queue_size_max_ = std::max(alert_queue_size_min_, max_size);
+    alert_queue_size_.store(alert_queue_size_min_, std::memory_order_relaxed);
+}
+
+void alert_dispatcher_t::attach(const std::shared_ptr<lt::session> &session) {
+    session_ = session;
+    last_resize_ = std::chrono::steady_clock::now();
+}
+
+void alert_dispatcher_t::set_alert_queue_size(const int size) {
+    alert_queue_size_.store(size, std::memory_order_relaxed);
+    peak_batch_ = 0;
+    last_resize_ = std::chrono::steady_clock::now();
+    if (const auto session = session_.lock()) {
+        lt::settings_pack pack;
+        pack.set_int(lt::settings_pack::alert_queue_size, size);
+        session->apply_settings(std::move(pack));
+    }
+}
+
+void alert_dispatcher_t::on_batch(const size_t popped) {
+    peak_batch_ = std::max(peak_batch_, popped);
+    if (std::chrono::steady_clock::now() - last_resize_ < kAlertQueueShrinkInterval) {
+        return;
+    }
+    const int size = alert_queue_size();
+    if (size > alert_queue_size_min_ && peak_batch_ * 4 < static_cast<size_t>(size)) {
+        set_alert_queue_size(std::max(alert_queue_size_min_, size / 2));
+    } else {
+        // Start a new observation window
+        peak_batch_ = 0;
+        last_resize_ = std::chrono::steady_clock::now();
+    }
+}
+
+lt::alert_category_t alert_dispatcher_t::alert_mask_for(const uint32_t subscribed_events) const {
+    lt::alert_category_t mask = kInternalCategories;
+    for (const auto &route: routes_) {
+        if (route.handler && (route.events & subscribed_events)) {
+            mask |= route.category;
+        }
+    }
+    return mask;
+}
+
+static uint32_t changed_fields(const torrent_stats_t &previous, const torrent_stats_t &current) {
+    uint32_t changed = 0;
+    const auto check = [&](const bool differs, const torrent_stats_field_t field) {
+        if (differs) {
+            changed |= field;
+        }
+    };
+    check(previous.total != current.total, kStatsTotal);
+    check(previous.total_done != current.total_done, kStatsTotalDone);
+    check(previous.total_upload != current.total_upload, kStatsTotalUpload);
+    check(previous.all_time_upload != current.all_time_upload, kStatsAllTimeUpload);
+    check(previous.all_time_download != current.all_time_download, kStatsAllTimeDownload);
+    check(previous.download_payload_rate != current.download_payload_rate, kStatsDownloadPayloadRate);
+    check(previous.upload_payload_rate != current.upload_payload_rate, kStatsUploadPayloadRate);
+    check(previous.total_payload_download != current.total_payload_download, kStatsTotalPayloadDownload);
+    check(previous.total_payload_upload != current.total_payload_upload, kStatsTotalPayloadUpload);
+    check(previous.progress != current.progress, kStatsProgress);
+    return changed;
+}
+
+void alert_dispatcher_t::on_state_update(lt::state_update_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_state_update_event_t");
+    if (reset_status_updates_.exchange(false, std::memory_order_relaxed)) {
+        last_stats_.clear();
+    }
+    for (auto &torrent: alert.status) {
+        torrent_stats_t stats;
+        stats.total = torrent.total;
+        stats.total_done = torrent.total_done;
+        stats.total_upload = torrent.total_upload;
+        stats.all_time_download = torrent.all_time_download;
+        stats.all_time_upload = torrent.all_time_upload;
+        stats.download_payload_rate = torrent.download_payload_rate;
+        stats.upload_payload_rate = torrent.upload_payload_rate;
+        stats.progress = torrent.progress;
+        stats.total_payload_download = torrent.total_payload_download;
+        stats.total_payload_upload = torrent.total_payload_upload;
+
+        const handle_id_t handle_id = torrent.handle.id();
+        const auto context = torrents_.find(handle_id);
+        if (context) {
+            context->on_resync_status(torrent);
+            // file_recheck_t posts a status update with its progress
+            for (auto &progress: context->recheck().take_progress()) {
+                if (listener.subscribed_events & event_bit(kEventRecheckProgress)) {
+                    listener.on_recheck_progress(handle_id, progress);
+                }
+            }
+        }
+        if (!(listener.subscribed_events & event_bit(kEventStatusUpdate))) {
+            continue;
+        }
+        const auto [it, inserted] = last_stats_.try_emplace(handle_id, stats);
+        stats.changed_fields = inserted ? 0xFFFFFFFF : changed_fields(it->second, stats);
+        // Only the periodic session-wide poll is deduplicated, an explicit post_status_updates is always answered
+        const bool requested = context && context->take_status_request();
+        if (stats.changed_fields == 0 && !requested) {
+            continue;
+        }
+        it->second = stats;
+        listener.on_status_update(handle_id, stats);
+    }
+}
+
+void alert_dispatcher_t::on_session_stats(lt::session_stats_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:session_stats_alert");
+    session_stats_t stats;
+    session_stats_.update(alert, stats);
+    listener.on_session_stats(0, stats);
+}
+
+void alert_dispatcher_t::on_torrent_removed(lt::torrent_removed_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_removed_alert");
+    last_stats_.erase(alert.handle.id());
+    torrents_.remove(alert.handle.id());
+    if (!(listener.subscribed_events & event_bit(kEventTorrentRemoved))) {
+        return;
+    }
+    listener.on_torrent_removed(alert.handle.id(), alert.torrent_name());
+}
+
+void alert_dispatcher_t::on_add_torrent(lt::add_torrent_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_added_event_t");
+    listener.on_torrent_added(alert.handle.id());
+}
+
+void alert_dispatcher_t::on_torrent_checked(lt::torrent_checked_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_checked_event_t");
+    if (const auto context = torrents_.find(alert.handle.id())) {
+        context->on_torrent_checked();
+    }
+    if (listener.subscribed_events & event_bit(kEventChecked)) {
+        listener.on_checked(alert.handle.id());
+    }
+}
+
+void alert_dispatcher_t::on_metadata_received(lt::metadata_received_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:metadata_received_alert");
+    listener.on_metadata_received(alert.handle.id());
+}
+
+void alert_dispatcher_t::on_save_resume_data(lt::save_resume_data_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_save_resume_data_event_t");
+    torrent_resume_data_t data;
+    data.data_ = write_resume_data_buf(alert.params);
+    listener.on_save_resume_data(alert.handle.id(), data);
+}
+
+void alert_dispatcher_t::on_piece_finished(lt::piece_finished_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:piece_finished_event_t");
+    const auto context = torrents_.find(alert.handle.id());
+    if (context) {
+        context->on_piece_finished(static_cast<int>(alert.piece_index));
+    }
+    if (listener.subscribed_events & (event_bit(kEventPieceFinished) | event_bit(kEventPieceProgress))) {
+        listener.on_piece_finished(alert.handle.id(), static_cast<int32_t>(alert.piece_index));
+    }
+    if (context) {
+        // Taken even if nobody listens, so that they do not pile up
+        for (auto &miss: context->deadlines().take_misses()) {
+            if (listener.subscribed_events & event_bit(kEventDeadlineMissed)) {
+                listener.on_deadline_missed(alert.handle.id(), miss);
+            }
+        }
+    }
+}
+
+void alert_dispatcher_t::on_block_downloading(lt::block_downloading_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:block_downloading_event_t");
+    if (const auto context = torrents_.find(alert.handle.id())) {
+        context->on_block_downloading(static_cast<int>(alert.piece_index));
+    }
+    listener.on_block_downloading(alert.handle.id(), static_cast<int32_t>(alert.piece_index), alert.block_index);
+}
+
+void alert_dispatcher_t::on_state_changed(lt::state_changed_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:torrent_state_changed_event_t");
+    const auto state = static_cast<torrent_state_t>(alert.state);
+    listener.on_torrent_state_changed(alert.handle.id(), state);
+}
+
+void alert_dispatcher_t::on_file_completed(lt::file_completed_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:file_completed_alert");
+    listener.on_file_completed(alert.handle.id(), static_cast<int32_t>(alert.index));
+}
+
+void alert_dispatcher_t::on_alerts_dropped(lt::alerts_dropped_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:alerts_dropped_alert");
+    // Only the alerts we route are known, the others are not in alert_mask anyway
+    uint32_t dropped_events = 0;
+    lt::alert_category_t dropped_categories{};
+    const int types = std::min(lt::num_alert_types, static_cast<int>(alert.dropped_alerts.size()));
+    for (int type = 0; type < types; ++type) {
+        if (alert.dropped_alerts[type] && routes_[type].handler) {
+            dropped_events |= routes_[type].events;
+            dropped_categories |= routes_[type].category;
+        }
+    }
+
+    if (const int size = alert_queue_size(); size < alert_queue_size_max_) {
+        set_alert_queue_size(static_cast<int>(std::min<int64_t>(alert_queue_size_max_, int64_t{size} * 2)));
+    }
+
+    // The alert itself is routed for all events, deliver only what the listener asked for
+    if (listener.subscribed_events & event_bit(kEventAlertsDropped)) {
+        listener.on_alerts_dropped(0, dropped_events, static_cast<uint32_t>(dropped_categories));
+    }
+    constexpr uint32_t piece_events =
+        event_bit(kEventBlockDownloading) | event_bit(kEventPieceFinished) | event_bit(kEventPieceProgress);
+    if (dropped_events & piece_events) {
+        // Querying the torrents here would block event processing on the network thread, the answers arrive as
+        // state_update_alert and piece_info_alert instead
+        const bool report = dropped_events & listener.subscribed_events & piece_events;
+        for (const auto &context: torrents_.all()) {
+            context->request_piece_resync(report);
+        }
+    }
+    if (alert.dropped_alerts[lt::read_piece_alert::alert_type]) {
+        for (const auto &context: torrents_.all()) {
+            context->retry_pending_reads();
+            context->recheck().retry_reads();
+        }
+    }
+}
+
+void alert_dispatcher_t::on_piece_info(lt::piece_info_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:piece_info_alert");
+    const auto context = torrents_.find(alert.handle.id());
+    piece_progress_t progress;
+    if (context && context->on_resync_queue(alert.piece_info, progress)) {
+        listener.on_piece_progress(alert.handle.id(), progress);
+    }
+}
+
+void alert_dispatcher_t::on_read_piece(lt::read_piece_alert &alert, event_listener_t &listener) {
+    function_printer_t _fp("alert_dispatcher_t:read_piece_alert");
+    if (const auto context = torrents_.find(alert.handle.id())) {
+        context->on_read_piece(alert);
+    }
+}
+} // namespace anilt
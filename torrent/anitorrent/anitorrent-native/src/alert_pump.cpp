@@ -0,0 +1,304 @@
+#include "alert_pump.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "global_lock.h"
+#include "libtorrent/alert_types.hpp"
+#include "session_t.hpp"
+
+namespace anilt {
+static constexpr auto kWaitInterval = std::chrono::milliseconds(200);
+
+// Translates listener calls made by alert_dispatcher_t into queued events
+class pump_writer_t final : public event_listener_t {
+  public:
+    explicit pump_writer_t(alert_pump_t &pump) : pump_(pump) {}
+
+    void on_checked(const handle_id_t handle_id) override { push(kEventChecked, handle_id); }
+    void on_metadata_received(const handle_id_t handle_id) override { push(kEventMetadataReceived, handle_id); }
+    void on_torrent_added(const handle_id_t handle_id) override { push(kEventTorrentAdded, handle_id); }
+
+    void on_save_resume_data(const handle_id_t handle_id, torrent_resume_data_t &data) override {
+        pump_.push(make(kEventSaveResumeData, handle_id), std::move(data.data_));
+    }
+
+    void on_torrent_state_changed(const handle_id_t handle_id, const torrent_state_t state) override {
+        push(kEventTorrentStateChanged, handle_id, state);
+    }
+
+    void on_block_downloading(const handle_id_t handle_id, const int32_t piece_index, const int block_index) override {
+        push(kEventBlockDownloading, handle_id, piece_index, block_index);
+    }
+
+    void on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) override {
+        push(kEventPieceFinished, handle_id, piece_index);
+    }
+
+    void on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) override {
+        pump_.push(make(kEventPieceProgress, handle_id), std::move(progress));
+    }
+
+    void on_status_update(const handle_id_t handle_id, torrent_stats_t &stats) override {
+        pump_.push(make(kEventStatusUpdate, handle_id), stats);
+    }
+
+    void on_file_completed(const handle_id_t handle_id, const int file_index) override {
+        push(kEventFileCompleted, handle_id, file_index);
+    }
+
+    void on_torrent_removed(const handle_id_t handle_id, const char *torrent_name) override {
+        std::vector<char> name;
+        if (torrent_name) {
+            // keep the terminating '\0' so that replay can pass it as a C string
+            name.assign(torrent_name, torrent_name + std::strlen(torrent_name) + 1);
+        }
+        pump_.push(make(kEventTorrentRemoved, handle_id), std::move(name));
+    }
+
+    void on_session_stats(const handle_id_t handle_id, session_stats_t &stats) override {
+        pump_.push(make(kEventSessionStats, handle_id), stats);
+    }
+
+    void on_alerts_dropped(const handle_id_t handle_id, const uint32_t dropped_events,
+                           const uint32_t dropped_categories) override {
+        push(kEventAlertsDropped, handle_id, static_cast<int32_t>(dropped_events),
+             static_cast<int32_t>(dropped_categories));
+    }
+
+    void on_deadline_missed(const handle_id_t handle_id, deadline_miss_t &miss) override {
+        pump_.push(make(kEventDeadlineMissed, handle_id), miss);
+    }
+
+    void on_recheck_progress(const handle_id_t handle_id, recheck_progress_t &progress) override {
+        pump_.push(make(kEventRecheckProgress, handle_id), std::move(progress));
+    }
+
+  private:
+    pump_event_t make(const event_kind_t kind, const handle_id_t handle_id, const int32_t arg0 = 0,
+                      const int32_t arg1 = 0) const {
+        pump_event_t event;
+        if (const lt::alert *alert = pump_.dispatcher_->current_alert()) {
+            event.alert_type = alert->type();
+            event.posted = alert->timestamp();
+        }
+        event.kind = kind;
+        event.handle_id = handle_id;
+        event.arg0 = arg0;
+        event.arg1 = arg1;
+        return event;
+    }
+
+    void push(const event_kind_t kind, const handle_id_t handle_id, const int32_t arg0 = 0, const int32_t arg1 = 0) {
+        pump_.push(make(kind, handle_id, arg0, arg1));
+    }
+
+    alert_pump_t &pump_;
+};
+
+alert_pump_t::alert_pump_t(std::shared_ptr<lt::session> session, std::shared_ptr<alert_dispatcher_t> dispatcher,
+                           const size_t capacity) :
+    session_(std::move(session)), dispatcher_(std::move(dispatcher)), queue_(capacity),
+    payloads_(std::max<size_t>(capacity / 4, 1)) {}
+
+alert_pump_t::~alert_pump_t() { stop(); }
+
+void alert_pump_t::start(new_event_listener_t *notify) {
+    function_printer_t _fp("alert_pump_t::start");
+    if (running_.exchange(true)) {
+        return;
+    }
+    notify_ = notify;
+    thread_ = std::thread([this] { run(); });
+}
+
+void alert_pump_t::stop() {
+    function_printer_t _fp("alert_pump_t::stop");
+    running_.store(false, std::memory_order_release);
+    {
+        // The producer either has not checked `running_` yet or is waiting
+        std::lock_guard _(wait_lock_);
+    }
+    space_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool alert_pump_t::has_events() const {
+    return queue_.size() != 0 || has_stopped_events_.load(std::memory_order_acquire);
+}
+
+void alert_pump_t::run() {
+    pump_writer_t writer(*this);
+    std::vector<lt::alert *> alerts;
+    while (running_.load(std::memory_order_acquire)) {
+        if (!session_->wait_for_alert(kWaitInterval)) {
+            continue;
+        }
+        session_->pop_alerts(&alerts);
+        dispatcher_->latency().on_popped(alerts);
+
+        const size_t queued_before = queue_.size();
+        writer.subscribed_events = subscribed_events_.load(std::memory_order_relaxed);
+        dispatcher_->dispatch_all(alerts, writer, coalesce_piece_progress_.load(std::memory_order_relaxed));
+        if (notify_ && (queue_.size() != queued_before || has_stopped_events_.load(std::memory_order_relaxed))) {
+            notify_->on_new_events();
+        }
+    }
+}
+
+bool alert_pump_t::has_space(const bool payload) const {
+    return queue_.size() < queue_.capacity() && (!payload || payloads_.size() < payloads_.capacity());
+}
+
+void alert_pump_t::push(pump_event_t event, pump_payload_t &&payload) {
+    event.has_payload = !std::holds_alternative<std::monostate>(payload);
+    const auto enqueue = [&] {
+        // Payload first, so that it is there when the consumer pops the event
+        if (event.has_payload) {
+            payloads_.try_push(std::move(payload));
+        }
+        queue_.try_push(std::move(event));
+    };
+    if (!has_stopped_events_.load(std::memory_order_acquire) && has_space(event.has_payload)) {
+        enqueue();
+        return;
+    }
+
+    if (!has_stopped_events_.load(std::memory_order_acquire) && running_.load(std::memory_order_acquire)) {
+        blocked_count_.fetch_add(1, std::memory_order_relaxed);
+        // Queue is full: make sure the consumer knows, then wait for it to catch up.
+        // Blocking here lets libtorrent's own alert queue absorb the burst instead of losing events.
+        if (notify_) {
+            notify_->on_new_events();
+        }
+    }
+    std::unique_lock lock(wait_lock_);
+    if (!has_stopped_events_.load(std::memory_order_relaxed)) {
+        producer_waiting_.store(true, std::memory_order_relaxed);
+        // Pairs with the fence in wake_producer: either drain sees `producer_waiting_` or we see its space
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        space_.wait(lock, [&] { return !running_.load(std::memory_order_acquire) || has_space(event.has_payload); });
+        producer_waiting_.store(false, std::memory_order_relaxed);
+        if (has_space(event.has_payload)) {
+            enqueue();
+            return;
+        }
+    }
+    stopped_events_.emplace_back(event, std::move(payload));
+    has_stopped_events_.store(true, std::memory_order_release);
+}
+
+void alert_pump_t::wake_producer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (producer_waiting_.load(std::memory_order_relaxed)) {
+        std::lock_guard _(wait_lock_);
+        space_.notify_one();
+    }
+}
+
+size_t alert_pump_t::drain(event_listener_t &listener, const size_t max_events) {
+    function_printer_t _fp("alert_pump_t::drain");
+    size_t count = 0;
+    auto &latency = dispatcher_->latency();
+    const auto delivered = [&](const pump_event_t &event) {
+        if (event.alert_type >= 0 && latency.enabled()) {
+            latency.record(kLatencyDelivered, event.alert_type, event.posted, lt::clock_type::now());
+        }
+        ++count;
+    };
+
+    pump_event_t event;
+    pump_payload_t payload;
+    while (count < max_events && queue_.try_pop(event)) {
+        if (event.has_payload) {
+            payloads_.try_pop(payload);
+        }
+        wake_producer();
+        replay(event, payload, listener);
+        payload = std::monostate{};
+        delivered(event);
+    }
+
+    // Events kept while stopped come after every queued one
+    if (count < max_events && queue_.size() == 0 && has_stopped_events_.load(std::memory_order_acquire)) {
+        std::vector<std::pair<pump_event_t, pump_payload_t>> events;
+        {
+            std::lock_guard _(wait_lock_);
+            const size_t taken = std::min(max_events - count, stopped_events_.size());
+            const auto end = stopped_events_.begin() + static_cast<std::ptrdiff_t>(taken);
+            events.assign(std::make_move_iterator(stopped_events_.begin()), std::make_move_iterator(end));
+            stopped_events_.erase(stopped_events_.begin(), end);
+            if (stopped_events_.empty()) {
+                has_stopped_events_.store(false, std::memory_order_release);
+            }
+        }
+        for (auto &[stopped, stopped_payload]: events) {
+            replay(stopped, stopped_payload, listener);
+            delivered(stopped);
+        }
+    }
+    return count;
+}
+
+void alert_pump_t::replay(const pump_event_t &event, pump_payload_t &payload, event_listener_t &listener) {
+    switch (event.kind) {
+        case kEventTorrentAdded:
+            listener.on_torrent_added(event.handle_id);
+            break;
+        case kEventChecked:
+            listener.on_checked(event.handle_id);
+            break;
+        case kEventMetadataReceived:
+            listener.on_metadata_received(event.handle_id);
+            break;
+        case kEventSaveResumeData: {
+            torrent_resume_data_t data;
+            data.data_ = std::move(std::get<std::vector<char>>(payload));
+            listener.on_save_resume_data(event.handle_id, data);
+            break;
+        }
+        case kEventTorrentStateChanged:
+            listener.on_torrent_state_changed(event.handle_id, static_cast<torrent_state_t>(event.arg0));
+            break;
+        case kEventBlockDownloading:
+            listener.on_block_downloading(event.handle_id, event.arg0, event.arg1);
+            break;
+        case kEventPieceFinished:
+            listener.on_piece_finished(event.handle_id, event.arg0);
+            break;
+        case kEventPieceProgress:
+            listener.on_piece_progress(event.handle_id, std::get<piece_progress_t>(payload));
+            break;
+        case kEventStatusUpdate:
+            listener.on_status_update(event.handle_id, std::get<torrent_stats_t>(payload));
+            break;
+        case kEventFileCompleted:
+            listener.on_file_completed(event.handle_id, event.arg0);
+            break;
+        case kEventTorrentRemoved: {
+            const auto &name = std::get<std::vector<char>>(payload);
+            listener.on_torrent_removed(event.handle_id, name.empty() ? "" : name.data());
+            break;
+        }
+        case kEventSessionStats:
+            listener.on_session_stats(event.handle_id, std::get<session_stats_t>(payload));
+            break;
+        case kEventAlertsDropped:
+            listener.on_alerts_dropped(event.handle_id, static_cast<uint32_t>(event.arg0),
+                                       static_cast<uint32_t>(event.arg1));
+            break;
+        case kEventDeadlineMissed:
+            listener.on_deadline_missed(event.handle_id, std::get<deadline_miss_t>(payload));
+            break;
+        case kEventRecheckProgress:
+            listener.on_recheck_progress(event.handle_id, std::get<recheck_progress_t>(payload));
+            break;
+        case kEventResumeDataSaved:
+            // Delivered by resume_data_writer_t, never queued
+            break;
+    }
+}
+} // namespace anilt
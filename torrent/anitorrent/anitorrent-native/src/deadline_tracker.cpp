@@ -0,0 +1,134 @@
+#include "deadline_tracker.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace anilt {
+// Misses are taken on every piece_finished_alert, this only bounds the queue if nobody dispatches alerts
+static constexpr size_t kMaxQueuedMisses = 256;
+
+static int32_t to_millis(const deadline_tracker_t::clock::duration duration) {
+    const auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(duration).count();
+    return static_cast<int32_t>(std::clamp<int64_t>(millis, std::numeric_limits<int32_t>::min(),
+                                                    std::numeric_limits<int32_t>::max()));
+}
+
+void deadline_tracker_t::on_deadline(const int piece, const clock::time_point deadline, const clock::time_point now) {
+    std::lock_guard _(lock_);
+    const auto [it, inserted] = pending_.try_emplace(piece, pending_t{now, deadline});
+    if (!inserted) {
+        it->second.deadline = std::min(it->second.deadline, deadline);
+    }
+}
+
+void deadline_tracker_t::forget(const int piece) {
+    std::lock_guard _(lock_);
+    pending_.erase(piece);
+}
+
+void deadline_tracker_t::forget_all() {
+    std::lock_guard _(lock_);
+    pending_.clear();
+}
+
+void deadline_tracker_t::on_finished(const int piece, const clock::time_point now) {
+    std::lock_guard _(lock_);
+    const auto it = pending_.find(piece);
+    if (it == pending_.end()) {
+        return;
+    }
+    const pending_t pending = it->second;
+    pending_.erase(it);
+
+    const bool late = now > pending.deadline;
+    ++finished_pieces_;
+    recent_late_ <<= 1;
+    recent_late_[0] = late;
+    recent_count_ = std::min(recent_count_ + 1, kRecentPieces);
+    if (!late) {
+        return;
+    }
+    ++missed_pieces_;
+    lateness_.record(std::chrono::duration_cast<std::chrono::microseconds>(now - pending.deadline).count());
+    if (misses_.size() >= kMaxQueuedMisses) {
+        return;
+    }
+    deadline_miss_t miss;
+    miss.piece_index = piece;
+    miss.lateness_millis = to_millis(now - pending.deadline);
+    miss.wait_millis = to_millis(now - pending.requested);
+    miss.buffer_health_millis = earliest_deadline_millis(now);
+    miss.on_time_percent = on_time_percent();
+    misses_.push_back(miss);
+}
+
+std::vector<deadline_miss_t> deadline_tracker_t::take_misses() {
+    std::lock_guard _(lock_);
+    std::vector<deadline_miss_t> misses;
+    misses.swap(misses_);
+    return misses;
+}
+
+int32_t deadline_tracker_t::buffer_health_millis(const clock::time_point now) const {
+    std::lock_guard _(lock_);
+    return earliest_deadline_millis(now);
+}
+
+int32_t deadline_tracker_t::earliest_deadline_millis(const clock::time_point now) const {
+    if (pending_.empty()) {
+        return std::numeric_limits<int32_t>::max();
+    }
+    const auto earliest = std::min_element(pending_.begin(), pending_.end(), [](const auto &a, const auto &b) {
+        return a.second.deadline < b.second.deadline;
+    });
+    return to_millis(earliest->second.deadline - now);
+}
+
+int32_t deadline_tracker_t::on_time_percent() const {
+    if (recent_count_ == 0) {
+        return 100;
+    }
+    std::bitset<kRecentPieces> window;
+    window.set();
+    window >>= kRecentPieces - recent_count_;
+    const size_t late = (recent_late_ & window).count();
+    return static_cast<int32_t>(100 * (recent_count_ - late) / recent_count_);
+}
+
+deadline_stats_t deadline_tracker_t::stats(const clock::time_point now) const {
+    std::lock_guard _(lock_);
+    deadline_stats_t stats;
+    stats.finished_pieces = finished_pieces_;
+    stats.missed_pieces = missed_pieces_;
+    stats.miss_ratio =
+        finished_pieces_ > 0 ? static_cast<float>(missed_pieces_) / static_cast<float>(finished_pieces_) : 0;
+
+    std::array<uint64_t, latency_histogram_t::kBuckets> counts{};
+    int64_t sum = 0;
+    int64_t max = 0;
+    lateness_.merge_into(counts, sum, max);
+    const latency_summary_t lateness = latency_histogram_t::summarize(counts, sum, max);
+    stats.lateness_p50_millis = lateness.p50_us / 1000;
+    stats.lateness_p99_millis = lateness.p99_us / 1000;
+    stats.lateness_max_millis = lateness.max_us / 1000;
+
+    stats.pending_pieces = static_cast<int32_t>(pending_.size());
+    for (const auto &[piece, pending]: pending_) {
+        if (pending.deadline < now) {
+            ++stats.overdue_pieces;
+        }
+    }
+    stats.buffer_health_millis = earliest_deadline_millis(now);
+    stats.on_time_percent = on_time_percent();
+    return stats;
+}
+
+void deadline_tracker_t::reset_stats() {
+    std::lock_guard _(lock_);
+    recent_late_.reset();
+    recent_count_ = 0;
+    finished_pieces_ = 0;
+    missed_pieces_ = 0;
+    lateness_.reset();
+}
+} // namespace anilt
@@ -0,0 +1,225 @@
+#include "event_buffer.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+#include "global_lock.h"
+
+namespace anilt {
+static void put_bytes(std::vector<char> &out, const char *bytes, const size_t size) {
+    if (size == 0)
+        return;
+    const size_t pos = out.size();
+    out.resize(pos + size);
+    std::memcpy(out.data() + pos, bytes, size);
+}
+
+template<typename T>
+static void put(std::vector<char> &out, const T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    put_bytes(out, reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+size_t event_buffer_t::begin_record(const event_kind_t kind, const handle_id_t handle_id) {
+    const size_t start = data_.size();
+    put(data_, static_cast<uint16_t>(kind));
+    put(data_, static_cast<uint16_t>(0));
+    put(data_, static_cast<uint32_t>(handle_id));
+    put(data_, static_cast<uint32_t>(0)); // payload size, patched by end_record
+    return start;
+}
+
+void event_buffer_t::end_record(const size_t record_start) {
+    const auto payload_size = static_cast<uint32_t>(data_.size() - record_start - kRecordHeaderSize);
+    std::memcpy(data_.data() + record_start + 8, &payload_size, sizeof(payload_size));
+}
+
+static uint32_t record_size_at(const std::vector<char> &data, const size_t pos) {
+    uint32_t payload_size;
+    std::memcpy(&payload_size, data.data() + pos + 8, sizeof(payload_size));
+    return static_cast<uint32_t>(event_buffer_t::kRecordHeaderSize) + payload_size;
+}
+
+size_t event_buffer_t::next_read_size() const {
+    if (remaining() == 0)
+        return 0;
+    return kBatchHeaderSize + record_size_at(data_, read_pos_);
+}
+
+size_t event_buffer_t::read(char *buffer, const size_t capacity) {
+    function_printer_t _fp("event_buffer_t::read");
+    if (!buffer || remaining() == 0 || capacity < next_read_size())
+        return 0;
+
+    size_t end = read_pos_;
+    uint32_t record_count = 0;
+    while (end < data_.size()) {
+        const size_t record_size = record_size_at(data_, end);
+        if (kBatchHeaderSize + (end - read_pos_) + record_size > capacity)
+            break;
+        end += record_size;
+        ++record_count;
+    }
+
+    const auto records_size = static_cast<uint32_t>(end - read_pos_);
+    const uint16_t reserved = 0;
+    char *out = buffer;
+    std::memcpy(out, &kMagic, 4);
+    std::memcpy(out + 4, &kVersion, 2);
+    std::memcpy(out + 6, &reserved, 2);
+    std::memcpy(out + 8, &record_count, 4);
+    std::memcpy(out + 12, &records_size, 4);
+    std::memcpy(out + kBatchHeaderSize, data_.data() + read_pos_, records_size);
+
+    read_pos_ = end;
+    if (read_pos_ == data_.size()) {
+        data_.clear();
+        read_pos_ = 0;
+    }
+    return kBatchHeaderSize + records_size;
+}
+
+void event_buffer_t::clear() {
+    data_.clear();
+    read_pos_ = 0;
+}
+
+void event_buffer_t::on_checked(const handle_id_t handle_id) {
+    end_record(begin_record(kEventChecked, handle_id));
+}
+
+void event_buffer_t::on_metadata_received(const handle_id_t handle_id) {
+    end_record(begin_record(kEventMetadataReceived, handle_id));
+}
+
+void event_buffer_t::on_torrent_added(const handle_id_t handle_id) {
+    end_record(begin_record(kEventTorrentAdded, handle_id));
+}
+
+void event_buffer_t::on_save_resume_data(const handle_id_t handle_id, torrent_resume_data_t &data) {
+    const size_t start = begin_record(kEventSaveResumeData, handle_id);
+    put_bytes(data_, data.data_.data(), data.data_.size());
+    end_record(start);
+}
+
+void event_buffer_t::on_torrent_state_changed(const handle_id_t handle_id, const torrent_state_t state) {
+    const size_t start = begin_record(kEventTorrentStateChanged, handle_id);
+    put(data_, static_cast<int32_t>(state));
+    end_record(start);
+}
+
+void event_buffer_t::on_block_downloading(const handle_id_t handle_id, const int32_t piece_index,
+                                          const int block_index) {
+    const size_t start = begin_record(kEventBlockDownloading, handle_id);
+    put(data_, piece_index);
+    put(data_, static_cast<int32_t>(block_index));
+    end_record(start);
+}
+
+void event_buffer_t::on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) {
+    const size_t start = begin_record(kEventPieceFinished, handle_id);
+    put(data_, piece_index);
+    end_record(start);
+}
+
+void event_buffer_t::on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) {
+    const size_t start = begin_record(kEventPieceProgress, handle_id);
+    put(data_, static_cast<int32_t>(progress.blocks_downloading));
+    put(data_, static_cast<int32_t>(progress.downloading_pieces.size()));
+    put_bytes(data_, reinterpret_cast<const char *>(progress.downloading_pieces.data()),
+              progress.downloading_pieces.size() * sizeof(int32_t));
+    put(data_, static_cast<int32_t>(progress.finished_pieces.size()));
+    put_bytes(data_, reinterpret_cast<const char *>(progress.finished_pieces.data()),
+              progress.finished_pieces.size() * sizeof(int32_t));
+    end_record(start);
+}
+
+void event_buffer_t::on_status_update(const handle_id_t handle_id, torrent_stats_t &stats) {
+    const size_t start = begin_record(kEventStatusUpdate, handle_id);
+    put(data_, stats.total);
+    put(data_, stats.total_done);
+    put(data_, stats.total_upload);
+    put(data_, stats.all_time_upload);
+    put(data_, stats.all_time_download);
+    put(data_, static_cast<int32_t>(stats.download_payload_rate));
+    put(data_, static_cast<int32_t>(stats.upload_payload_rate));
+    put(data_, stats.total_payload_download);
+    put(data_, stats.total_payload_upload);
+    put(data_, stats.progress);
+    put(data_, stats.changed_fields);
+    end_record(start);
+}
+
+void event_buffer_t::on_file_completed(const handle_id_t handle_id, const int file_index) {
+    const size_t start = begin_record(kEventFileCompleted, handle_id);
+    put(data_, static_cast<int32_t>(file_index));
+    end_record(start);
+}
+
+void event_buffer_t::on_torrent_removed(const handle_id_t handle_id, const char *torrent_name) {
+    const size_t start = begin_record(kEventTorrentRemoved, handle_id);
+    if (torrent_name) {
+        put_bytes(data_, torrent_name, std::strlen(torrent_name));
+    }
+    end_record(start);
+}
+
+void event_buffer_t::on_session_stats(const handle_id_t handle_id, session_stats_t &stats) {
+    const size_t start = begin_record(kEventSessionStats, handle_id);
+    put(data_, stats.download_payload_rate);
+    put(data_, stats.upload_payload_rate);
+    put(data_, stats.download_rate);
+    put(data_, stats.upload_rate);
+    put(data_, stats.total_downloaded_bytes);
+    put(data_, stats.total_uploaded_bytes);
+    put(data_, stats.total_download_bytes);
+    put(data_, stats.total_upload_bytes);
+    put(data_, stats.wasted_bytes);
+    put(data_, stats.total_wasted_bytes);
+    put(data_, stats.blocks_read);
+    put(data_, stats.blocks_cache_hits);
+    put(data_, stats.disk_queue_depth);
+    put(data_, stats.disk_queued_write_bytes);
+    put(data_, stats.num_peers);
+    put(data_, stats.dht_nodes);
+    put(data_, stats.interval_ms);
+    end_record(start);
+}
+
+void event_buffer_t::on_resume_data_saved(const handle_id_t handle_id, const bool success) {
+    const size_t start = begin_record(kEventResumeDataSaved, handle_id);
+    put(data_, static_cast<int32_t>(success ? 1 : 0));
+    end_record(start);
+}
+
+void event_buffer_t::on_alerts_dropped(const handle_id_t handle_id, const uint32_t dropped_events,
+                                       const uint32_t dropped_categories) {
+    const size_t start = begin_record(kEventAlertsDropped, handle_id);
+    put(data_, dropped_events);
+    put(data_, dropped_categories);
+    end_record(start);
+}
+
+void event_buffer_t::on_deadline_missed(const handle_id_t handle_id, deadline_miss_t &miss) {
+    const size_t start = begin_record(kEventDeadlineMissed, handle_id);
+    put(data_, miss.piece_index);
+    put(data_, miss.lateness_millis);
+    put(data_, miss.wait_millis);
+    put(data_, miss.buffer_health_millis);
+    put(data_, miss.on_time_percent);
+    end_record(start);
+}
+
+void event_buffer_t::on_recheck_progress(const handle_id_t handle_id, recheck_progress_t &progress) {
+    const size_t start = begin_record(kEventRecheckProgress, handle_id);
+    put(data_, progress.file_index);
+    put(data_, progress.checked_pieces);
+    put(data_, progress.total_pieces);
+    put(data_, progress.failed_pieces);
+    put(data_, static_cast<uint32_t>((progress.done ? 1u : 0u) | (progress.full_recheck_started ? 2u : 0u)));
+    put(data_, static_cast<int32_t>(progress.new_failed_pieces.size()));
+    put_bytes(data_, reinterpret_cast<const char *>(progress.new_failed_pieces.data()),
+              progress.new_failed_pieces.size() * sizeof(int32_t));
+    end_record(start);
+}
+} // namespace anilt
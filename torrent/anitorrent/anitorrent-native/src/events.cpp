@@ -1,128 +1,34 @@
 ﻿
 #include "events.hpp"
 
-#include <fstream>
-
 #include "global_lock.h"
-#include "libtorrent/alert_types.hpp"
-#include "libtorrent/bencode.hpp"
-#include "libtorrent/write_resume_data.hpp"
+#include "listener_router.hpp"
+#include "resume_data_writer.hpp"
 
 namespace anilt {
-
-
-void call_listener(lt::alert *alert, libtorrent::session &session, event_listener_t &listener) {
-    // Non-torrent alerts
-
-    if (const auto a = lt::alert_cast<lt::state_update_alert>(alert)) {
-        function_printer_t _fp("call_listener:torrent_state_update_event_t");
-        for (auto &torrent: a->status) {
-            torrent_stats_t stats;
-            stats.total = torrent.total;
-            stats.total_done = torrent.total_done;
-            stats.total_upload = torrent.total_upload;
-            stats.all_time_download = torrent.all_time_download;
-            stats.all_time_upload = torrent.all_time_upload;
-            stats.download_payload_rate = torrent.download_payload_rate;
-            stats.upload_payload_rate = torrent.upload_payload_rate;
-            stats.progress = torrent.progress;
-            stats.total_payload_download = torrent.total_payload_download;
-            stats.total_payload_upload = torrent.total_payload_upload;
-            listener.on_status_update(torrent.handle.id(), stats);
+event_listener_t::~event_listener_t() {
+    std::vector<std::weak_ptr<torrent_listener_table_t>> tables;
+    {
+        std::lock_guard _(tables_lock_);
+        tables.swap(tables_);
+    }
+    for (const auto &weak: tables) {
+        if (const auto table = weak.lock()) {
+            table->remove(this);
         }
-        return;
     }
+}
 
-    // if (const auto a = lt::alert_cast<lt::session_stats_alert>(alert)) {
-    //     function_printer_t _fp("call_listener:torrent_state_update_event_t");
-    //     session_stats_t stats;
-    // a->counters()[lt::counters::];
-    // for (auto &torrent: a->status) {
-    //     torrent_stats_t stats;
-    //     stats.download_payload_rate = torrent.download_payload_rate;
-    //     stats.upload_payload_rate = torrent.upload_payload_rate;
-    //     stats.progress = torrent.progress;
-    //     listener.on_status_update(torrent.handle.id(), stats);
-    // }
-    // return;
-    // }
-
-    auto *torrent_alert = dynamic_cast<lt::torrent_alert *>(alert);
-    if (!torrent_alert) {
-        return;
-    }
-
-    // torrent_removed_alert 可能在 set handle invalid 之后触发，需要提前处理
-    if (const auto a = lt::alert_cast<lt::torrent_removed_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:torrent_removed_alert");
-        listener.on_torrent_removed(a->handle.id(), a->torrent_name());
-    }
-    
-    const auto handle = torrent_alert->handle;
-    if (!handle.is_valid())
-        return;
-
-    if (lt::alert_cast<lt::add_torrent_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:torrent_added_event_t");
-        listener.on_torrent_added(handle.id());
-        return;
-    }
-    if (lt::alert_cast<lt::torrent_checked_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:torrent_checked_event_t");
-        listener.on_checked(handle.id());
-        return;
+void event_listener_t::on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) {
+    for (const auto piece_index: progress.downloading_pieces) {
+        on_block_downloading(handle_id, piece_index, kUnknownBlockIndex);
     }
-    if (lt::alert_cast<lt::metadata_received_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:metadata_received_alert");
-        listener.on_metadata_received(handle.id());
-        return;
-    }
-    if (const auto a = lt::alert_cast<lt::save_resume_data_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:torrent_save_resume_data_event_t");
-        const auto params = a->params;
-        torrent_resume_data_t data;
-        data.data_ = write_resume_data_buf(params);
-        listener.on_save_resume_data(handle.id(), data);
-        return;
-    }
-    if (const auto a = lt::alert_cast<lt::piece_finished_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:piece_finished_event_t");
-        listener.on_piece_finished(a->handle.id(), static_cast<int32_t>(a->piece_index));
-        return;
-    }
-    if (const auto a = lt::alert_cast<lt::block_downloading_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:block_downloading_event_t");
-        listener.on_block_downloading(a->handle.id(), static_cast<int32_t>(a->piece_index), a->block_index);
-        return;
-    }
-    if (const auto a = lt::alert_cast<lt::state_changed_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:torrent_state_changed_event_t");
-        const auto state = static_cast<torrent_state_t>(a->state);
-        listener.on_torrent_state_changed(a->handle.id(), state);
-        return;
-    }
-    if (const auto a = lt::alert_cast<lt::file_completed_alert>(torrent_alert)) {
-        function_printer_t _fp("call_listener:file_completed_alert");
-        listener.on_file_completed(a->handle.id(), static_cast<int32_t>(a->index));
+    for (const auto piece_index: progress.finished_pieces) {
+        on_piece_finished(handle_id, piece_index);
     }
 }
 
-static void writeVectorToFile(const std::vector<char> &data, const std::string &filePath) {
-    // Open the file in binary mode
-    std::ofstream outFile(filePath, std::ios::binary);
-
-    // Check if the file was opened successfully
-    if (!outFile) {
-        std::cerr << "Error opening file for writing: " << filePath << std::endl;
-        return;
-    }
-
-    // Write the contents of the vector to the file
-    outFile.write(data.data(), static_cast<long>(data.size()));
-
-    // Close the file
-    outFile.close();
+void torrent_resume_data_t::save_to_file(const std::string &path) const {
+    resume_data_writer_t::write_atomically(data_, path, false);
 }
-
-void torrent_resume_data_t::save_to_file(const std::string &path) const { writeVectorToFile(data_, path); }
 } // namespace anilt
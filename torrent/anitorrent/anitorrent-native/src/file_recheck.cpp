@@ -0,0 +1,208 @@
+#include "file_recheck.hpp"
+
+#include <algorithm>
+
+#include "global_lock.h"
+#include "libtorrent/hasher.hpp"
+#include "libtorrent/torrent_info.hpp"
+#include "libtorrent/torrent_status.hpp"
+
+namespace anilt {
+file_recheck_t::file_recheck_t(on_hashed_t on_hashed) : on_hashed_(std::move(on_hashed)) {}
+
+file_recheck_t::~file_recheck_t() {
+    {
+        std::lock_guard _(lock_);
+        stopping_ = true;
+    }
+    jobs_changed_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+int file_recheck_t::start(const lt::torrent_handle &handle, const int file_index,
+                          const bool full_recheck_on_failure) {
+    function_printer_t _fp("file_recheck_t::start");
+    const auto ti = handle.torrent_file();
+    if (!ti || file_index < 0 || file_index >= ti->num_files()) {
+        return kInvalidArgument;
+    }
+    if (!ti->v1()) {
+        // v2-only torrents have merkle trees instead of piece hashes
+        return kUnsupported;
+    }
+    const auto &files = ti->files();
+    const lt::file_index_t file(file_index);
+    const int64_t size = files.file_size(file);
+    if (size <= 0) {
+        return kNothingToCheck;
+    }
+    const int64_t begin = files.file_offset(file);
+    const auto first_piece = static_cast<int>(begin / ti->piece_length());
+    const auto last_piece = static_cast<int>((begin + size - 1) / ti->piece_length());
+
+    // Pieces not downloaded have nothing to verify
+    const lt::torrent_status status = handle.status(lt::torrent_handle::query_pieces);
+    std::vector<int> pieces;
+    for (int piece = first_piece; piece <= last_piece && piece < status.pieces.size(); ++piece) {
+        if (status.pieces[lt::piece_index_t(piece)]) {
+            pieces.push_back(piece);
+        }
+    }
+    if (pieces.empty()) {
+        return kNothingToCheck;
+    }
+
+    std::unique_lock lock(lock_);
+    if (running_) {
+        return kBusy;
+    }
+    if (thread_.joinable()) {
+        // The worker of the previous recheck hashes what is left and exits
+        std::thread previous = std::move(thread_);
+        lock.unlock();
+        previous.join();
+        lock.lock();
+        if (running_) {
+            return kBusy;
+        }
+    }
+    running_ = true;
+    handle_ = handle;
+    torrent_info_ = ti;
+    file_index_ = file_index;
+    full_recheck_on_failure_ = full_recheck_on_failure;
+    pieces_ = std::move(pieces);
+    next_ = 0;
+    reading_.clear();
+    checked_ = 0;
+    failed_ = 0;
+    checked_at_last_progress_ = 0;
+    new_failed_.clear();
+    full_recheck_started_ = false;
+    read_next();
+    thread_ = std::thread([this] { run(); });
+    return kStarted;
+}
+
+void file_recheck_t::cancel() {
+    function_printer_t _fp("file_recheck_t::cancel");
+    {
+        std::lock_guard _(lock_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        reading_.clear();
+        queue_progress(true);
+    }
+    jobs_changed_.notify_all();
+}
+
+void file_recheck_t::read_next() {
+    // Pieces waiting for the worker count as being read, which bounds the buffers held
+    while (next_ < pieces_.size() && reading_.size() + hashing_.size() < kParallelReads) {
+        const int piece = pieces_[next_++];
+        reading_.insert(piece);
+        handle_.read_piece(lt::piece_index_t(piece));
+    }
+}
+
+void file_recheck_t::retry_reads() {
+    function_printer_t _fp("file_recheck_t::retry_reads");
+    std::lock_guard _(lock_);
+    if (!running_) {
+        return;
+    }
+    for (const int piece: reading_) {
+        handle_.read_piece(lt::piece_index_t(piece));
+    }
+}
+
+void file_recheck_t::queue_progress(const bool done) {
+    recheck_progress_t progress;
+    progress.file_index = file_index_;
+    progress.checked_pieces = checked_;
+    progress.total_pieces = static_cast<int32_t>(pieces_.size());
+    progress.failed_pieces = failed_;
+    // Parallel reads complete in any order
+    std::sort(new_failed_.begin(), new_failed_.end());
+    progress.new_failed_pieces.swap(new_failed_);
+    progress.done = done;
+    progress.full_recheck_started = full_recheck_started_;
+    progress_.push_back(std::move(progress));
+    checked_at_last_progress_ = checked_;
+    // Wakes alert_dispatcher_t up to deliver it
+    handle_.post_status({});
+}
+
+bool file_recheck_t::on_read_piece(const lt::read_piece_alert &alert) {
+    const int piece = static_cast<int>(alert.piece);
+    {
+        std::lock_guard _(lock_);
+        if (hashing_.count(piece)) {
+            return true;
+        }
+        if (!running_ || reading_.erase(piece) == 0) {
+            return false;
+        }
+        hashing_.insert(piece);
+        jobs_.push_back({piece, static_cast<bool>(alert.error), alert.buffer, alert.size});
+    }
+    jobs_changed_.notify_all();
+    return true;
+}
+
+void file_recheck_t::run() {
+    std::unique_lock lock(lock_);
+    while (true) {
+        jobs_changed_.wait(lock, [this] { return stopping_ || !jobs_.empty() || !running_; });
+        if (stopping_ || jobs_.empty()) {
+            return;
+        }
+        job_t job = std::move(jobs_.front());
+        jobs_.pop_front();
+        const auto ti = torrent_info_;
+        lock.unlock();
+        // A read error means the file is missing or truncated
+        const bool passed = !job.error &&
+            lt::hasher(lt::span<char const>(job.buffer.get(), static_cast<std::size_t>(job.size))).final() ==
+                ti->hash_for_piece(lt::piece_index_t(job.piece));
+        lock.lock();
+        // Under lock_, so that a duplicate alert of the piece is not taken for a reader's read before this
+        on_hashed_(job.piece, passed, job.buffer, job.size);
+        hashing_.erase(job.piece);
+        if (running_) {
+            on_hashed(job.piece, passed);
+        }
+    }
+}
+
+void file_recheck_t::on_hashed(const int piece, const bool passed) {
+    ++checked_;
+    if (!passed) {
+        ++failed_;
+        new_failed_.push_back(piece);
+    }
+    read_next();
+
+    if (reading_.empty() && hashing_.empty()) {
+        running_ = false;
+        if (failed_ > 0 && full_recheck_on_failure_) {
+            handle_.force_recheck();
+            full_recheck_started_ = true;
+        }
+        queue_progress(true);
+    } else if (!passed || checked_ - checked_at_last_progress_ >= kProgressInterval) {
+        queue_progress(false);
+    }
+}
+
+std::vector<recheck_progress_t> file_recheck_t::take_progress() {
+    std::lock_guard _(lock_);
+    std::vector<recheck_progress_t> progress;
+    progress.swap(progress_);
+    return progress;
+}
+} // namespace anilt
@@ -0,0 +1,398 @@
+#include "http_server.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <sstream>
+#include <string>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+
+#include "global_lock.h"
+#include "libtorrent/torrent_info.hpp"
+
+namespace anilt {
+namespace asio = boost::asio;
+using tcp = asio::ip::tcp;
+
+static constexpr size_t kMaxHeaderSize = 16 * 1024;
+static constexpr int kMaxConnections = 16;
+// Pieces requested ahead of the one being sent
+static constexpr int kReadAheadPieces = 4;
+static constexpr int kReadAheadDeadlineStepMillis = 100;
+// Waits for pieces are split so that `stop` does not wait for the read timeout
+static constexpr auto kWaitSlice = std::chrono::milliseconds(250);
+
+struct http_server_t::request_t {
+    std::string method{};
+    std::string path{};
+    // Empty if absent
+    std::string host{};
+    bool keep_alive = true;
+    bool has_range = false;
+    // -1 if absent: "bytes=-N" only has `last`, "bytes=N-" only has `first`
+    int64_t range_first = -1;
+    int64_t range_last = -1;
+};
+
+static std::string to_lower(std::string value) {
+    std::transform(value.begin(), value.end(), value.begin(),
+                   [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return value;
+}
+
+static std::string trim(const std::string &value) {
+    const auto first = value.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+        return {};
+    }
+    return value.substr(first, value.find_last_not_of(" \t\r") - first + 1);
+}
+
+bool http_server_t::is_loopback_host(const std::string &host) {
+    const std::string name = to_lower(host.substr(0, host[0] == '[' ? host.find(']') + 1 : host.find(':')));
+    if (name == "localhost" || name == "[::1]") {
+        return true;
+    }
+    boost::system::error_code ec;
+    const auto address = asio::ip::make_address_v4(name, ec);
+    return !ec && address.is_loopback();
+}
+
+static bool parse_int(const std::string &value, int64_t &out) {
+    if (value.empty() || value.size() > 18 || !std::all_of(value.begin(), value.end(), ::isdigit)) {
+        return false;
+    }
+    out = std::stoll(value);
+    return true;
+}
+
+bool http_server_t::parse_range(const std::string &value, int64_t &first, int64_t &last) {
+    if (to_lower(value.substr(0, 6)) != "bytes=") {
+        return false;
+    }
+    std::string range = value.substr(6);
+    range = trim(range.substr(0, range.find(',')));
+    const auto dash = range.find('-');
+    if (dash == std::string::npos) {
+        return false;
+    }
+    const std::string from = trim(range.substr(0, dash));
+    const std::string to = trim(range.substr(dash + 1));
+    if (!from.empty() && !parse_int(from, first)) {
+        return false;
+    }
+    if (!to.empty() && !parse_int(to, last)) {
+        return false;
+    }
+    return !from.empty() || !to.empty();
+}
+
+static const char *content_type(const std::string &file_name) {
+    const auto dot = file_name.rfind('.');
+    const std::string extension = dot == std::string::npos ? "" : to_lower(file_name.substr(dot + 1));
+    if (extension == "mp4" || extension == "m4v") return "video/mp4";
+    if (extension == "mkv") return "video/x-matroska";
+    if (extension == "webm") return "video/webm";
+    if (extension == "avi") return "video/x-msvideo";
+    if (extension == "ts") return "video/mp2t";
+    if (extension == "ass" || extension == "ssa" || extension == "srt") return "text/plain; charset=utf-8";
+    return "application/octet-stream";
+}
+
+static bool write_all(tcp::socket &socket, const asio::const_buffer &buffer) {
+    boost::system::error_code ec;
+    asio::write(socket, buffer, ec);
+    return !ec;
+}
+
+static bool write_status(tcp::socket &socket, const int status, const char *reason, const bool keep_alive) {
+    std::ostringstream out;
+    out << "HTTP/1.1 " << status << ' ' << reason << "\r\n"
+        << "Content-Length: 0\r\n"
+        << "Connection: " << (keep_alive ? "keep-alive" : "close") << "\r\n\r\n";
+    const std::string header = out.str();
+    return write_all(socket, asio::buffer(header)) && keep_alive;
+}
+
+http_server_t::http_server_t(context_resolver_t resolver) : resolver_(std::move(resolver)) {}
+
+http_server_t::~http_server_t() { stop(); }
+
+int http_server_t::start(const int port, const int read_timeout_millis) {
+    function_printer_t _fp("http_server_t::start");
+    if (io_thread_.joinable()) {
+        return port_;
+    }
+    read_timeout_millis_ = read_timeout_millis;
+    boost::system::error_code ec;
+    const tcp::endpoint endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port));
+    acceptor_.open(endpoint.protocol(), ec);
+    if (!ec) acceptor_.set_option(tcp::acceptor::reuse_address(true), ec);
+    if (!ec) acceptor_.bind(endpoint, ec);
+    if (!ec) acceptor_.listen(asio::socket_base::max_listen_connections, ec);
+    if (ec) {
+        acceptor_.close(ec);
+        return -1;
+    }
+    port_ = acceptor_.local_endpoint(ec).port();
+    stopping_ = false;
+    do_accept();
+    io_thread_ = std::thread([this] { io_.run(); });
+    return port_;
+}
+
+void http_server_t::stop() {
+    function_printer_t _fp("http_server_t::stop");
+    if (!io_thread_.joinable()) {
+        return;
+    }
+    stopping_ = true;
+    asio::post(io_, [this] {
+        boost::system::error_code ec;
+        acceptor_.close(ec);
+    });
+    io_thread_.join();
+
+    std::list<std::unique_ptr<connection_t>> connections;
+    {
+        std::lock_guard _(connections_lock_);
+        connections.swap(connections_);
+    }
+    for (const auto &connection: connections) {
+        // Wakes up blocking reads and writes, the thread closes the socket
+        boost::system::error_code ec;
+        connection->socket.shutdown(tcp::socket::shutdown_both, ec);
+    }
+    for (const auto &connection: connections) {
+        connection->thread.join();
+    }
+    io_.restart();
+    port_ = -1;
+}
+
+void http_server_t::do_accept() {
+    acceptor_.async_accept([this](const boost::system::error_code &ec, tcp::socket socket) {
+        if (stopping_ || ec == asio::error::operation_aborted) {
+            return;
+        }
+        if (!ec) {
+            std::lock_guard _(connections_lock_);
+            // Reaps the threads of closed connections
+            for (auto it = connections_.begin(); it != connections_.end();) {
+                if ((*it)->done) {
+                    (*it)->thread.join();
+                    it = connections_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            if (connections_.size() < kMaxConnections) {
+                auto &connection = connections_.emplace_back(std::make_unique<connection_t>(std::move(socket)));
+                connection->thread = std::thread([this, connection = connection.get()] { serve(*connection); });
+            } else {
+                // Fits in the socket's send buffer, so it does not block the accept loop. The request is not read.
+                boost::system::error_code close_ec;
+                write_status(socket, 503, "Service Unavailable", false);
+                socket.shutdown(tcp::socket::shutdown_both, close_ec);
+                socket.close(close_ec);
+            }
+        }
+        do_accept();
+    });
+}
+
+void http_server_t::serve(connection_t &connection) const {
+    auto &socket = connection.socket;
+    boost::system::error_code ec;
+    socket.set_option(tcp::no_delay(true), ec);
+    asio::streambuf buffer(kMaxHeaderSize);
+    while (!stopping_) {
+        const size_t header_size = asio::read_until(socket, buffer, "\r\n\r\n", ec);
+        if (ec) {
+            break;
+        }
+        std::string header(asio::buffers_begin(buffer.data()),
+                           asio::buffers_begin(buffer.data()) + static_cast<std::ptrdiff_t>(header_size));
+        buffer.consume(header_size);
+
+        std::istringstream in(header);
+        std::string line;
+        std::getline(in, line);
+        request_t request;
+        std::string version;
+        std::istringstream(line) >> request.method >> request.path >> version;
+        request.keep_alive = version == "HTTP/1.1";
+        bool bad_range = false;
+        while (std::getline(in, line) && line != "\r") {
+            const auto colon = line.find(':');
+            if (colon == std::string::npos) {
+                continue;
+            }
+            const std::string name = to_lower(trim(line.substr(0, colon)));
+            const std::string value = trim(line.substr(colon + 1));
+            if (name == "connection") {
+                const std::string connection_value = to_lower(value);
+                if (connection_value == "close") {
+                    request.keep_alive = false;
+                } else if (connection_value == "keep-alive") {
+                    request.keep_alive = true;
+                }
+            } else if (name == "host") {
+                request.host = value;
+            } else if (name == "range") {
+                request.has_range = true;
+                bad_range = !parse_range(value, request.range_first, request.range_last);
+            }
+        }
+        if (bad_range) {
+            request.has_range = false; // Invalid ranges are ignored, RFC 9110 14.2
+        }
+        if (!respond(socket, request)) {
+            break;
+        }
+    }
+    socket.close(ec);
+    connection.done = true;
+}
+
+bool http_server_t::wait_piece(torrent_context_t &context, const int piece,
+                               torrent_context_t::piece_data_t &out) const {
+    const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(read_timeout_millis_);
+    // Requested once: asking again would reset the deadline of the piece on every slice
+    const auto request = context.request_piece(piece, 0);
+    while (!stopping_) {
+        const auto slice_end = std::min(until, std::chrono::steady_clock::now() + kWaitSlice);
+        // The request is kept between slices, and forgotten by the last one
+        if (context.wait_piece(request, slice_end, out, slice_end < until)) {
+            return true;
+        }
+        if (out.failed || slice_end >= until) {
+            return false;
+        }
+    }
+    // Stopping, forgets the request
+    context.wait_piece(request, std::chrono::steady_clock::now(), out);
+    return false;
+}
+
+bool http_server_t::respond(tcp::socket &socket, const request_t &request) const {
+    function_printer_t _fp("http_server_t::respond");
+    // A web page can make a browser send requests here with a name it controls resolving to 127.0.0.1
+    // (DNS rebinding), those carry that name in Host
+    if (!request.host.empty() && !is_loopback_host(request.host)) {
+        return write_status(socket, 403, "Forbidden", false);
+    }
+    const bool head = request.method == "HEAD";
+    if (!head && request.method != "GET") {
+        return write_status(socket, 405, "Method Not Allowed", request.keep_alive);
+    }
+
+    // /<handle id>/<file index>[/<name>][?query]
+    const std::string path = request.path.substr(0, request.path.find('?'));
+    unsigned int handle_id = 0;
+    int file_index = -1;
+    char separator = 0;
+    std::istringstream path_in(path);
+    path_in >> separator >> handle_id >> separator >> file_index;
+    const auto context = path_in.fail() || !resolver_ ? nullptr : resolver_(handle_id);
+    if (!context || !context->handle().is_valid()) {
+        return write_status(socket, 404, "Not Found", request.keep_alive);
+    }
+    const auto ti = context->handle().torrent_file();
+    if (!ti || file_index < 0 || file_index >= ti->num_files()) {
+        return write_status(socket, 404, "Not Found", request.keep_alive);
+    }
+    const auto &files = ti->files();
+    const lt::file_index_t file(file_index);
+    const int64_t file_size = files.file_size(file);
+
+    int64_t first = 0;
+    int64_t last = file_size - 1;
+    if (request.has_range) {
+        if (request.range_first < 0) {
+            // Suffix range
+            first = std::max<int64_t>(0, file_size - request.range_last);
+        } else {
+            first = request.range_first;
+            if (request.range_last >= 0) {
+                last = std::min(last, request.range_last);
+            }
+        }
+        if (first >= file_size || first > last) {
+            std::ostringstream out;
+            out << "HTTP/1.1 416 Range Not Satisfiable\r\n"
+                << "Content-Range: bytes */" << file_size << "\r\n"
+                << "Content-Length: 0\r\n"
+                << "Connection: " << (request.keep_alive ? "keep-alive" : "close") << "\r\n\r\n";
+            const std::string header = out.str();
+            return write_all(socket, asio::buffer(header)) && request.keep_alive;
+        }
+    }
+    const int64_t length = file_size == 0 ? 0 : last - first + 1;
+
+    std::ostringstream out;
+    if (request.has_range) {
+        out << "HTTP/1.1 206 Partial Content\r\n"
+            << "Content-Range: bytes " << first << '-' << last << '/' << file_size << "\r\n";
+    } else {
+        out << "HTTP/1.1 200 OK\r\n";
+    }
+    out << "Content-Type: " << content_type(std::string(files.file_name(file))) << "\r\n"
+        << "Content-Length: " << length << "\r\n"
+        << "Accept-Ranges: bytes\r\n"
+        << "Connection: " << (request.keep_alive ? "keep-alive" : "close") << "\r\n\r\n";
+    const std::string header = out.str();
+    if (!write_all(socket, asio::buffer(header))) {
+        return false;
+    }
+    if (head || length == 0) {
+        return request.keep_alive;
+    }
+
+    const int64_t piece_length = ti->piece_length();
+    const int64_t begin = files.file_offset(file) + first;
+    const int64_t end = begin + length;
+    const auto first_piece = static_cast<int>(begin / piece_length);
+    const auto last_piece = static_cast<int>((end - 1) / piece_length);
+
+    // The player's position drives the scheduler, it keeps the window if this reads the footer. Players send a
+    // new ranged GET every few megabytes, only those leaving the window are seeks.
+    context->set_playhead(first_piece);
+    if (const auto scheduler = context->scheduler(); scheduler && !scheduler->in_window(first_piece)) {
+        scheduler->seek(first_piece);
+    }
+
+    int requested_until = first_piece;
+    for (int64_t position = begin; position < end;) {
+        const auto piece = static_cast<int>(position / piece_length);
+        if (piece != first_piece) {
+            context->set_playhead(piece);
+        }
+        // Pieces requested but not waited for still land in the piece cache
+        for (; requested_until < std::min(last_piece, piece + kReadAheadPieces); ++requested_until) {
+            const int ahead = requested_until + 1;
+            context->request_piece(ahead, (ahead - piece) * kReadAheadDeadlineStepMillis);
+        }
+
+        torrent_context_t::piece_data_t data;
+        if (!wait_piece(*context, piece, data)) {
+            // Headers are sent, the only way to report the error is to close the connection
+            return false;
+        }
+        const int64_t piece_begin = piece * piece_length;
+        const int64_t to = std::min(end, piece_begin + data.size);
+        if (to <= position) {
+            return false;
+        }
+        if (!write_all(socket, asio::buffer(data.buffer.get() + (position - piece_begin),
+                                            static_cast<size_t>(to - position)))) {
+            return false;
+        }
+        position = to;
+    }
+    return request.keep_alive;
+}
+} // namespace anilt
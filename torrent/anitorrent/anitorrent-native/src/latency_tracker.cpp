@@ -0,0 +1,159 @@
+#include "latency_tracker.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace anilt {
+static constexpr int kSubBucketBits = 2;
+static_assert(latency_histogram_t::kSubBuckets == 1 << kSubBucketBits);
+
+int latency_histogram_t::bucket_of(const int64_t micros) {
+    if (micros < kSubBuckets) {
+        return static_cast<int>(std::max<int64_t>(micros, 0));
+    }
+    int exponent = kSubBucketBits;
+    while (micros >> (exponent + 1)) {
+        ++exponent;
+    }
+    const auto sub = static_cast<int>((micros >> (exponent - kSubBucketBits)) & (kSubBuckets - 1));
+    return std::min((exponent - kSubBucketBits + 1) * kSubBuckets + sub, kBuckets - 1);
+}
+
+int64_t latency_histogram_t::lower_bound_of(const int bucket) {
+    if (bucket < kSubBuckets) {
+        return bucket;
+    }
+    const int exponent = bucket / kSubBuckets + kSubBucketBits - 1;
+    return int64_t{kSubBuckets + bucket % kSubBuckets} << (exponent - kSubBucketBits);
+}
+
+void latency_histogram_t::record(const int64_t micros) {
+    counts_[bucket_of(micros)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(micros, std::memory_order_relaxed);
+    int64_t max = max_.load(std::memory_order_relaxed);
+    while (micros > max && !max_.compare_exchange_weak(max, micros, std::memory_order_relaxed)) {
+    }
+}
+
+void latency_histogram_t::reset() {
+    for (auto &count: counts_) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+void latency_histogram_t::merge_into(std::array<uint64_t, kBuckets> &counts, int64_t &sum, int64_t &max) const {
+    for (int i = 0; i < kBuckets; ++i) {
+        counts[i] += counts_[i].load(std::memory_order_relaxed);
+    }
+    sum += sum_.load(std::memory_order_relaxed);
+    max = std::max(max, max_.load(std::memory_order_relaxed));
+}
+
+latency_summary_t latency_histogram_t::summarize(const std::array<uint64_t, kBuckets> &counts, const int64_t sum,
+                                                 const int64_t max) {
+    latency_summary_t summary;
+    uint64_t total = 0;
+    for (const auto count: counts) {
+        total += count;
+    }
+    if (total == 0) {
+        return summary;
+    }
+    // Upper bound of the bucket containing the given percentile
+    const auto percentile = [&](const double p) {
+        const auto target = static_cast<uint64_t>(std::ceil(p * static_cast<double>(total)));
+        uint64_t seen = 0;
+        for (int i = 0; i < kBuckets - 1; ++i) {
+            seen += counts[i];
+            if (seen >= target) {
+                return std::min(max, lower_bound_of(i + 1) - 1);
+            }
+        }
+        return max;
+    };
+    summary.count = static_cast<int64_t>(total);
+    summary.mean_us = sum / summary.count;
+    summary.p50_us = percentile(0.5);
+    summary.p90_us = percentile(0.9);
+    summary.p99_us = percentile(0.99);
+    summary.max_us = max;
+    return summary;
+}
+
+latency_tracker_t::latency_tracker_t() :
+    histograms_(std::make_unique<latency_histogram_t[]>(kLatencyStageCount * lt::num_alert_types)) {}
+
+void latency_tracker_t::on_notified() {
+    if (!enabled()) {
+        return;
+    }
+    lt::time_point::rep expected = 0;
+    // Keep the first notification, libtorrent only notifies when the queue becomes non-empty
+    notified_at_.compare_exchange_strong(expected, lt::clock_type::now().time_since_epoch().count(),
+                                         std::memory_order_relaxed);
+}
+
+void latency_tracker_t::on_popped(const std::vector<lt::alert *> &alerts) {
+    const auto notified_at = notified_at_.exchange(0, std::memory_order_relaxed);
+    if (!enabled() || alerts.empty()) {
+        return;
+    }
+    const auto now = lt::clock_type::now();
+    if (notified_at != 0 && alerts.front()) {
+        record(kLatencyNotified, alerts.front()->type(), alerts.front()->timestamp(),
+               lt::time_point(lt::time_duration(notified_at)));
+    }
+    for (const lt::alert *alert: alerts) {
+        if (alert) {
+            record(kLatencyPopped, alert->type(), alert->timestamp(), now);
+        }
+    }
+}
+
+void latency_tracker_t::on_delivered(const std::vector<lt::alert *> &alerts) {
+    if (!enabled()) {
+        return;
+    }
+    const auto now = lt::clock_type::now();
+    for (const lt::alert *alert: alerts) {
+        if (alert) {
+            record(kLatencyDelivered, alert->type(), alert->timestamp(), now);
+        }
+    }
+}
+
+void latency_tracker_t::record(const latency_stage_t stage, const int alert_type, const lt::time_point posted,
+                               const lt::time_point now) {
+    if (stage < 0 || stage >= kLatencyStageCount || alert_type < 0 || alert_type >= lt::num_alert_types) {
+        return;
+    }
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now - posted).count();
+    histogram(stage, alert_type).record(std::max<int64_t>(micros, 0));
+}
+
+latency_summary_t latency_tracker_t::summary(const latency_stage_t stage, const int alert_type) const {
+    if (stage < 0 || stage >= kLatencyStageCount || alert_type < -1 || alert_type >= lt::num_alert_types) {
+        return {};
+    }
+    std::array<uint64_t, latency_histogram_t::kBuckets> counts{};
+    int64_t sum = 0;
+    int64_t max = 0;
+    if (alert_type >= 0) {
+        histogram(stage, alert_type).merge_into(counts, sum, max);
+    } else {
+        for (int type = 0; type < lt::num_alert_types; ++type) {
+            histogram(stage, type).merge_into(counts, sum, max);
+        }
+    }
+    return latency_histogram_t::summarize(counts, sum, max);
+}
+
+void latency_tracker_t::reset() {
+    for (int i = 0; i < kLatencyStageCount * lt::num_alert_types; ++i) {
+        histograms_[i].reset();
+    }
+    notified_at_.store(0, std::memory_order_relaxed);
+}
+} // namespace anilt
@@ -0,0 +1,184 @@
+#include "listener_router.hpp"
+
+#include "alert_dispatcher.hpp"
+
+namespace anilt {
+void torrent_listener_table_t::set(const handle_id_t handle_id, event_listener_t *listener) {
+    std::lock_guard _(lock_);
+    auto routes = routes_ ? std::make_shared<torrent_listener_map_t>(*routes_)
+                          : std::make_shared<torrent_listener_map_t>();
+    if (listener) {
+        (*routes)[handle_id] = listener;
+        std::lock_guard tables(listener->tables_lock_);
+        listener->tables_.push_back(weak_from_this());
+    } else {
+        routes->erase(handle_id);
+    }
+    routes_ = routes->empty() ? nullptr : std::move(routes);
+    version_.fetch_add(1, std::memory_order_release);
+}
+
+void torrent_listener_table_t::remove(const event_listener_t *listener) {
+    {
+        std::lock_guard _(lock_);
+        if (!routes_) {
+            return;
+        }
+        auto routes = std::make_shared<torrent_listener_map_t>(*routes_);
+        for (auto it = routes->begin(); it != routes->end();) {
+            it = it->second == listener ? routes->erase(it) : std::next(it);
+        }
+        if (routes->size() == routes_->size()) {
+            return;
+        }
+        routes_ = routes->empty() ? nullptr : std::move(routes);
+        version_.fetch_add(1, std::memory_order_release);
+    }
+    std::lock_guard _(dispatch_lock_);
+}
+
+std::shared_ptr<const torrent_listener_map_t> torrent_listener_table_t::snapshot(uint64_t &version) const {
+    std::lock_guard _(lock_);
+    version = version_.load(std::memory_order_relaxed);
+    return routes_;
+}
+
+uint32_t torrent_listener_table_t::subscribed_events() const {
+    std::lock_guard _(lock_);
+    uint32_t events = 0;
+    if (routes_) {
+        for (const auto &[handle_id, listener]: *routes_) {
+            events |= listener->subscribed_events;
+        }
+    }
+    return events;
+}
+
+listener_router_t::listener_router_t(std::shared_ptr<torrent_listener_table_t> table, event_listener_t &fallback,
+                                     const bool drop_unrouted) :
+    table_(std::move(table)), dispatching_(table_->dispatch_lock()), fallback_(fallback),
+    drop_unrouted_(drop_unrouted) {
+    routes_ = table_->snapshot(version_);
+    subscribed_events = fallback_.subscribed_events | table_->subscribed_events();
+}
+
+event_listener_t *listener_router_t::target(const handle_id_t handle_id, const uint32_t events) const {
+    if (table_->version() != version_) {
+        routes_ = table_->snapshot(version_);
+    }
+    event_listener_t *listener = &fallback_;
+    if (routes_) {
+        if (const auto it = routes_->find(handle_id); it != routes_->end()) {
+            listener = it->second;
+        } else if (drop_unrouted_) {
+            return nullptr;
+        }
+    } else if (drop_unrouted_) {
+        return nullptr;
+    }
+    return listener->subscribed_events & events ? listener : nullptr;
+}
+
+void listener_router_t::on_checked(const handle_id_t handle_id) {
+    if (const auto listener = target(handle_id, event_bit(kEventChecked))) {
+        listener->on_checked(handle_id);
+    }
+}
+
+void listener_router_t::on_metadata_received(const handle_id_t handle_id) {
+    if (const auto listener = target(handle_id, event_bit(kEventMetadataReceived))) {
+        listener->on_metadata_received(handle_id);
+    }
+}
+
+void listener_router_t::on_torrent_added(const handle_id_t handle_id) {
+    if (const auto listener = target(handle_id, event_bit(kEventTorrentAdded))) {
+        listener->on_torrent_added(handle_id);
+    }
+}
+
+void listener_router_t::on_save_resume_data(const handle_id_t handle_id, torrent_resume_data_t &data) {
+    if (const auto listener = target(handle_id, event_bit(kEventSaveResumeData))) {
+        listener->on_save_resume_data(handle_id, data);
+    }
+}
+
+void listener_router_t::on_torrent_state_changed(const handle_id_t handle_id, const torrent_state_t state) {
+    if (const auto listener = target(handle_id, event_bit(kEventTorrentStateChanged))) {
+        listener->on_torrent_state_changed(handle_id, state);
+    }
+}
+
+void listener_router_t::on_block_downloading(const handle_id_t handle_id, const int32_t piece_index,
+                                             const int block_index) {
+    if (const auto listener = target(handle_id, event_bit(kEventBlockDownloading))) {
+        listener->on_block_downloading(handle_id, piece_index, block_index);
+    }
+}
+
+void listener_router_t::on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) {
+    if (const auto listener = target(handle_id, event_bit(kEventPieceFinished))) {
+        listener->on_piece_finished(handle_id, piece_index);
+    }
+}
+
+void listener_router_t::on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) {
+    // The default on_piece_progress falls back to on_block_downloading and on_piece_finished
+    constexpr uint32_t events =
+        event_bit(kEventPieceProgress) | event_bit(kEventBlockDownloading) | event_bit(kEventPieceFinished);
+    if (const auto listener = target(handle_id, events)) {
+        listener->on_piece_progress(handle_id, progress);
+    }
+}
+
+void listener_router_t::on_status_update(const handle_id_t handle_id, torrent_stats_t &stats) {
+    if (const auto listener = target(handle_id, event_bit(kEventStatusUpdate))) {
+        listener->on_status_update(handle_id, stats);
+    }
+}
+
+void listener_router_t::on_file_completed(const handle_id_t handle_id, const int file_index) {
+    if (const auto listener = target(handle_id, event_bit(kEventFileCompleted))) {
+        listener->on_file_completed(handle_id, file_index);
+    }
+}
+
+void listener_router_t::on_torrent_removed(const handle_id_t handle_id, const char *torrent_name) {
+    if (const auto listener = target(handle_id, event_bit(kEventTorrentRemoved))) {
+        listener->on_torrent_removed(handle_id, torrent_name);
+    }
+}
+
+void listener_router_t::on_resume_data_saved(const handle_id_t handle_id, const bool success) {
+    if (const auto listener = target(handle_id, event_bit(kEventResumeDataSaved))) {
+        listener->on_resume_data_saved(handle_id, success);
+    }
+}
+
+void listener_router_t::on_deadline_missed(const handle_id_t handle_id, deadline_miss_t &miss) {
+    if (const auto listener = target(handle_id, event_bit(kEventDeadlineMissed))) {
+        listener->on_deadline_missed(handle_id, miss);
+    }
+}
+
+void listener_router_t::on_recheck_progress(const handle_id_t handle_id, recheck_progress_t &progress) {
+    if (const auto listener = target(handle_id, event_bit(kEventRecheckProgress))) {
+        listener->on_recheck_progress(handle_id, progress);
+    }
+}
+
+// Session-wide events
+
+void listener_router_t::on_session_stats(const handle_id_t handle_id, session_stats_t &stats) {
+    if (fallback_.subscribed_events & event_bit(kEventSessionStats)) {
+        fallback_.on_session_stats(handle_id, stats);
+    }
+}
+
+void listener_router_t::on_alerts_dropped(const handle_id_t handle_id, const uint32_t dropped_events,
+                                          const uint32_t dropped_categories) {
+    if (fallback_.subscribed_events & event_bit(kEventAlertsDropped)) {
+        fallback_.on_alerts_dropped(handle_id, dropped_events, dropped_categories);
+    }
+}
+} // namespace anilt
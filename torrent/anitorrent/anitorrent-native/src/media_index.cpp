@@ -0,0 +1,615 @@
+#include "media_index.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "global_lock.h"
+
+namespace anilt {
+// moov and Cues larger than this are not parsed
+static constexpr int64_t kMaxIndexSize = 64 * 1024 * 1024;
+// Top-level boxes or elements visited before giving up
+static constexpr int kMaxTopLevelItems = 256;
+static constexpr uint64_t kMaxSamples = 16 * 1024 * 1024;
+
+static bool read_exact(const media_index_t::reader_t &read, const int64_t file_size, const int64_t offset,
+                       const int64_t size, std::vector<char> &out) {
+    if (offset < 0 || size <= 0 || offset + size > file_size) {
+        return false;
+    }
+    out.clear();
+    return read(offset, size, out) && static_cast<int64_t>(out.size()) == size;
+}
+
+static uint64_t read_be(const char *data, const size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        value = (value << 8) | static_cast<uint8_t>(data[i]);
+    }
+    return value;
+}
+
+static uint32_t fourcc(const char (&type)[5]) { return static_cast<uint32_t>(read_be(type, 4)); }
+
+int64_t media_index_t::offset_for_time(const int64_t time_millis) const {
+    if (keyframes_.empty()) {
+        return -1;
+    }
+    const auto it = std::upper_bound(keyframes_.begin(), keyframes_.end(), time_millis,
+                                     [](const int64_t time, const keyframe_t &k) { return time < k.time_millis; });
+    return it == keyframes_.begin() ? keyframes_.front().offset : std::prev(it)->offset;
+}
+
+void media_index_t::add_metadata_range(const int64_t offset, const int64_t size) {
+    if (size <= 0) {
+        return;
+    }
+    metadata_ranges_.push_back(byte_range_t{offset, size});
+    std::sort(metadata_ranges_.begin(), metadata_ranges_.end(),
+              [](const byte_range_t &a, const byte_range_t &b) { return a.offset < b.offset; });
+}
+
+std::shared_ptr<const media_index_t> media_index_t::parse(const int64_t file_size, const reader_t &read) {
+    function_printer_t _fp("media_index_t::parse");
+    std::vector<char> magic;
+    if (!read_exact(read, file_size, 0, std::min<int64_t>(file_size, 8), magic) || magic.size() < 8) {
+        return nullptr;
+    }
+    if (read_be(magic.data(), 4) == 0x1A45DFA3) {
+        return parse_mkv(file_size, read);
+    }
+    if (read_be(magic.data() + 4, 4) == fourcc("ftyp")) {
+        return parse_mp4(file_size, read);
+    }
+    return nullptr;
+}
+
+// MP4
+
+/// Calls `fn(type, body, body_size)` for each box in `data`. Stops at the first malformed box.
+template<typename Fn>
+static void for_each_box(const char *data, const size_t size, Fn &&fn) {
+    size_t pos = 0;
+    while (pos + 8 <= size) {
+        uint64_t box_size = read_be(data + pos, 4);
+        const auto type = static_cast<uint32_t>(read_be(data + pos + 4, 4));
+        size_t header = 8;
+        if (box_size == 1) {
+            if (pos + 16 > size) {
+                return;
+            }
+            box_size = read_be(data + pos + 8, 8);
+            header = 16;
+        } else if (box_size == 0) {
+            box_size = size - pos;
+        }
+        if (box_size < header || box_size > size - pos) {
+            return;
+        }
+        fn(type, data + pos + header, static_cast<size_t>(box_size - header));
+        pos += static_cast<size_t>(box_size);
+    }
+}
+
+/// Body of the first child box of `type`, or nullptr
+static const char *find_box(const char *data, const size_t size, const uint32_t type, size_t &body_size) {
+    const char *found = nullptr;
+    for_each_box(data, size, [&](const uint32_t t, const char *body, const size_t s) {
+        if (!found && t == type) {
+            found = body;
+            body_size = s;
+        }
+    });
+    return found;
+}
+
+/// Timescale and duration of a full box laid out like mvhd and mdhd
+static bool read_time_header(const char *body, const size_t size, uint32_t &timescale, uint64_t &duration) {
+    if (size < 4) {
+        return false;
+    }
+    if (body[0] == 1) {
+        if (size < 4 + 8 + 8 + 4 + 8) {
+            return false;
+        }
+        timescale = static_cast<uint32_t>(read_be(body + 20, 4));
+        duration = read_be(body + 24, 8);
+    } else {
+        if (size < 4 + 4 + 4 + 4 + 4) {
+            return false;
+        }
+        timescale = static_cast<uint32_t>(read_be(body + 12, 4));
+        duration = read_be(body + 16, 4);
+    }
+    return timescale != 0;
+}
+
+struct mp4_sample_table_t {
+    uint32_t timescale = 0;
+    // stts: (sample count, delta)
+    std::vector<std::pair<uint32_t, uint32_t>> time_to_sample{};
+    // stss: 1-based sample numbers, empty if every sample is a sync sample
+    std::vector<uint32_t> sync_samples{};
+    bool has_sync_table = false;
+    // stsc: (1-based first chunk, samples per chunk)
+    std::vector<std::pair<uint32_t, uint32_t>> sample_to_chunk{};
+    uint32_t constant_sample_size = 0;
+    std::vector<uint32_t> sample_sizes{};
+    uint64_t sample_count = 0;
+    std::vector<uint64_t> chunk_offsets{};
+};
+
+/// Reads the `count` entries of `entry_size` bytes following the version, flags (and `skip` bytes) of a full box
+static bool table_entries(const char *body, const size_t size, const size_t skip, const size_t entry_size,
+                          uint32_t &count) {
+    if (size < 8 + skip) {
+        return false;
+    }
+    count = static_cast<uint32_t>(read_be(body + 4 + skip, 4));
+    return count <= (size - 8 - skip) / entry_size;
+}
+
+static bool parse_stbl(const char *stbl, const size_t stbl_size, mp4_sample_table_t &table) {
+    bool ok = true;
+    for_each_box(stbl, stbl_size, [&](const uint32_t type, const char *body, const size_t size) {
+        uint32_t count = 0;
+        if (type == fourcc("stts")) {
+            ok &= table_entries(body, size, 0, 8, count);
+            for (uint32_t i = 0; ok && i < count; ++i) {
+                table.time_to_sample.emplace_back(read_be(body + 8 + i * 8, 4), read_be(body + 12 + i * 8, 4));
+            }
+        } else if (type == fourcc("stss")) {
+            table.has_sync_table = true;
+            ok &= table_entries(body, size, 0, 4, count);
+            for (uint32_t i = 0; ok && i < count; ++i) {
+                table.sync_samples.push_back(static_cast<uint32_t>(read_be(body + 8 + i * 4, 4)));
+            }
+        } else if (type == fourcc("stsc")) {
+            ok &= table_entries(body, size, 0, 12, count);
+            for (uint32_t i = 0; ok && i < count; ++i) {
+                table.sample_to_chunk.emplace_back(read_be(body + 8 + i * 12, 4), read_be(body + 12 + i * 12, 4));
+            }
+        } else if (type == fourcc("stsz")) {
+            if (size < 12) {
+                ok = false;
+                return;
+            }
+            table.constant_sample_size = static_cast<uint32_t>(read_be(body + 4, 4));
+            table.sample_count = read_be(body + 8, 4);
+            if (table.constant_sample_size == 0) {
+                ok &= table_entries(body, size, 4, 4, count);
+                for (uint32_t i = 0; ok && i < count; ++i) {
+                    table.sample_sizes.push_back(static_cast<uint32_t>(read_be(body + 12 + i * 4, 4)));
+                }
+                table.sample_count = table.sample_sizes.size();
+            }
+        } else if (type == fourcc("stco") || type == fourcc("co64")) {
+            const size_t entry_size = type == fourcc("stco") ? 4 : 8;
+            ok &= table_entries(body, size, 0, entry_size, count);
+            for (uint32_t i = 0; ok && i < count; ++i) {
+                table.chunk_offsets.push_back(read_be(body + 8 + i * entry_size, entry_size));
+            }
+        }
+    });
+    std::sort(table.sync_samples.begin(), table.sync_samples.end());
+    return ok && table.sample_count <= kMaxSamples && !table.chunk_offsets.empty() &&
+           !table.sample_to_chunk.empty();
+}
+
+/// Walks the samples of `table` in decoding order and returns the time and offset of its sync samples
+static std::vector<media_index_t::keyframe_t> mp4_keyframes(const mp4_sample_table_t &table) {
+    std::vector<media_index_t::keyframe_t> keyframes;
+    size_t chunk = 0;
+    size_t stsc_index = 0;
+    uint32_t samples_per_chunk = table.sample_to_chunk[0].second;
+    uint32_t sample_in_chunk = 0;
+    uint64_t offset = table.chunk_offsets[0];
+    size_t stts_index = 0;
+    uint32_t stts_remaining = table.time_to_sample.empty() ? 0 : table.time_to_sample[0].first;
+    uint64_t time = 0;
+    size_t sync_index = 0;
+
+    for (uint64_t sample = 0; sample < table.sample_count; ++sample) {
+        while (sample_in_chunk >= samples_per_chunk) {
+            if (++chunk >= table.chunk_offsets.size()) {
+                return keyframes;
+            }
+            sample_in_chunk = 0;
+            offset = table.chunk_offsets[chunk];
+            while (stsc_index + 1 < table.sample_to_chunk.size() &&
+                   chunk + 1 >= table.sample_to_chunk[stsc_index + 1].first) {
+                ++stsc_index;
+            }
+            samples_per_chunk = table.sample_to_chunk[stsc_index].second;
+        }
+
+        bool sync = !table.has_sync_table;
+        while (sync_index < table.sync_samples.size() && table.sync_samples[sync_index] < sample + 1) {
+            ++sync_index;
+        }
+        if (sync_index < table.sync_samples.size() && table.sync_samples[sync_index] == sample + 1) {
+            sync = true;
+        }
+        if (sync) {
+            keyframes.push_back(media_index_t::keyframe_t{static_cast<int64_t>(time * 1000 / table.timescale),
+                                                          static_cast<int64_t>(offset)});
+        }
+
+        offset += table.constant_sample_size != 0 ? table.constant_sample_size : table.sample_sizes[sample];
+        ++sample_in_chunk;
+        while (stts_remaining == 0 && stts_index + 1 < table.time_to_sample.size()) {
+            stts_remaining = table.time_to_sample[++stts_index].first;
+        }
+        if (stts_remaining > 0) {
+            time += table.time_to_sample[stts_index].second;
+            --stts_remaining;
+        }
+    }
+    return keyframes;
+}
+
+std::shared_ptr<media_index_t> media_index_t::parse_mp4(const int64_t file_size, const reader_t &read) {
+    auto index = std::make_shared<media_index_t>();
+    index->container_ = kMediaContainerMp4;
+
+    // Top-level boxes, until moov. It is often after mdat, so only the headers are read
+    int64_t moov_offset = -1;
+    int64_t moov_size = 0;
+    int64_t moov_header = 0;
+    std::vector<char> header;
+    int64_t offset = 0;
+    for (int i = 0; i < kMaxTopLevelItems && offset + 8 <= file_size; ++i) {
+        if (!read_exact(read, file_size, offset, std::min<int64_t>(16, file_size - offset), header)) {
+            return nullptr;
+        }
+        auto size = static_cast<int64_t>(read_be(header.data(), 4));
+        const auto type = static_cast<uint32_t>(read_be(header.data() + 4, 4));
+        int64_t header_size = 8;
+        if (size == 1) {
+            if (header.size() < 16) {
+                return nullptr;
+            }
+            size = static_cast<int64_t>(read_be(header.data() + 8, 8));
+            header_size = 16;
+        } else if (size == 0) {
+            size = file_size - offset;
+        }
+        if (size < header_size || size > file_size - offset) {
+            return nullptr;
+        }
+        if (type == fourcc("ftyp")) {
+            index->add_metadata_range(offset, size);
+        } else if (type == fourcc("moov")) {
+            moov_offset = offset;
+            moov_size = size;
+            moov_header = header_size;
+            break;
+        }
+        offset += size;
+    }
+    if (moov_offset < 0 || moov_size > kMaxIndexSize) {
+        return nullptr;
+    }
+    index->add_metadata_range(moov_offset, moov_size);
+    index->index_range_ = byte_range_t{moov_offset, moov_size};
+
+    std::vector<char> moov;
+    if (!read_exact(read, file_size, moov_offset, moov_size, moov)) {
+        return nullptr;
+    }
+    const char *moov_body = moov.data() + moov_header;
+    const auto moov_body_size = static_cast<size_t>(moov_size - moov_header);
+
+    size_t size = 0;
+    if (const char *mvhd = find_box(moov_body, moov_body_size, fourcc("mvhd"), size)) {
+        uint32_t timescale = 0;
+        uint64_t duration = 0;
+        if (read_time_header(mvhd, size, timescale, duration)) {
+            index->duration_millis_ = static_cast<int64_t>(duration * 1000 / timescale);
+        }
+    }
+
+    // The video track, or the first track with a sample table
+    mp4_sample_table_t selected;
+    bool selected_video = false;
+    for_each_box(moov_body, moov_body_size, [&](const uint32_t type, const char *trak, const size_t trak_size) {
+        if (type != fourcc("trak") || selected_video) {
+            return;
+        }
+        size_t mdia_size = 0, minf_size = 0, stbl_size = 0, hdlr_size = 0, mdhd_size = 0;
+        const char *mdia = find_box(trak, trak_size, fourcc("mdia"), mdia_size);
+        if (!mdia) {
+            return;
+        }
+        const char *hdlr = find_box(mdia, mdia_size, fourcc("hdlr"), hdlr_size);
+        const bool video = hdlr && hdlr_size >= 12 && read_be(hdlr + 8, 4) == fourcc("vide");
+        if (!selected.chunk_offsets.empty() && !video) {
+            return;
+        }
+        const char *mdhd = find_box(mdia, mdia_size, fourcc("mdhd"), mdhd_size);
+        const char *minf = find_box(mdia, mdia_size, fourcc("minf"), minf_size);
+        const char *stbl = minf ? find_box(minf, minf_size, fourcc("stbl"), stbl_size) : nullptr;
+        mp4_sample_table_t table;
+        uint64_t duration = 0;
+        if (!mdhd || !stbl || !read_time_header(mdhd, mdhd_size, table.timescale, duration) ||
+            !parse_stbl(stbl, stbl_size, table)) {
+            return;
+        }
+        selected = std::move(table);
+        selected_video = video;
+    });
+    if (!selected.chunk_offsets.empty()) {
+        index->keyframes_ = mp4_keyframes(selected);
+    }
+    return index;
+}
+
+// Matroska
+
+namespace mkv {
+constexpr uint32_t kEbml = 0x1A45DFA3;
+constexpr uint32_t kSegment = 0x18538067;
+constexpr uint32_t kSeekHead = 0x114D9B74;
+constexpr uint32_t kSeek = 0x4DBB;
+constexpr uint32_t kSeekId = 0x53AB;
+constexpr uint32_t kSeekPosition = 0x53AC;
+constexpr uint32_t kInfo = 0x1549A966;
+constexpr uint32_t kTimecodeScale = 0x2AD7B1;
+constexpr uint32_t kDuration = 0x4489;
+constexpr uint32_t kTracks = 0x1654AE6B;
+constexpr uint32_t kTrackEntry = 0xAE;
+constexpr uint32_t kTrackNumber = 0xD7;
+constexpr uint32_t kTrackType = 0x83;
+constexpr uint32_t kCues = 0x1C53BB6B;
+constexpr uint32_t kCuePoint = 0xBB;
+constexpr uint32_t kCueTime = 0xB3;
+constexpr uint32_t kCueTrackPositions = 0xB7;
+constexpr uint32_t kCueTrack = 0xF7;
+constexpr uint32_t kCueClusterPosition = 0xF1;
+constexpr uint32_t kCluster = 0x1F43B675;
+constexpr uint64_t kUnknownSize = ~uint64_t{0};
+
+struct element_header_t {
+    uint32_t id = 0;
+    uint64_t size = 0;
+    size_t header_size = 0;
+};
+
+/// Reads a variable-length integer. IDs keep their length marker, sizes do not.
+static bool read_vint(const char *data, const size_t available, const bool keep_marker, uint64_t &value,
+                      size_t &length) {
+    if (available == 0) {
+        return false;
+    }
+    const auto first = static_cast<uint8_t>(data[0]);
+    length = 1;
+    while (length <= 8 && !(first & (0x80 >> (length - 1)))) {
+        ++length;
+    }
+    if (length > 8 || length > available) {
+        return false;
+    }
+    value = keep_marker ? first : first & (0xFF >> length);
+    bool all_ones = value == (0xFFu >> length);
+    for (size_t i = 1; i < length; ++i) {
+        value = (value << 8) | static_cast<uint8_t>(data[i]);
+        all_ones &= static_cast<uint8_t>(data[i]) == 0xFF;
+    }
+    if (!keep_marker && all_ones) {
+        value = kUnknownSize;
+    }
+    return true;
+}
+
+static bool read_header(const char *data, const size_t available, element_header_t &out) {
+    uint64_t id = 0;
+    size_t id_length = 0, size_length = 0;
+    if (!read_vint(data, available, true, id, id_length) || id_length > 4 ||
+        !read_vint(data + id_length, available - id_length, false, out.size, size_length)) {
+        return false;
+    }
+    out.id = static_cast<uint32_t>(id);
+    out.header_size = id_length + size_length;
+    return true;
+}
+
+/// Calls `fn(id, body, body_size)` for each child element in `data`. Stops at the first malformed element.
+template<typename Fn>
+static void for_each_element(const char *data, const size_t size, Fn &&fn) {
+    size_t pos = 0;
+    element_header_t header;
+    while (pos < size && read_header(data + pos, size - pos, header)) {
+        const size_t available = size - pos - header.header_size;
+        const size_t body_size = header.size == kUnknownSize ? available : static_cast<size_t>(header.size);
+        if (header.size != kUnknownSize && header.size > available) {
+            return;
+        }
+        fn(header.id, data + pos + header.header_size, body_size);
+        pos += header.header_size + body_size;
+    }
+}
+
+static uint64_t read_uint(const char *data, const size_t size) { return size <= 8 ? read_be(data, size) : 0; }
+
+static double read_float(const char *data, const size_t size) {
+    if (size == 4) {
+        const auto bits = static_cast<uint32_t>(read_be(data, 4));
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    if (size == 8) {
+        const uint64_t bits = read_be(data, 8);
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+    return 0;
+}
+} // namespace mkv
+
+std::shared_ptr<media_index_t> media_index_t::parse_mkv(const int64_t file_size, const reader_t &read) {
+    using namespace mkv;
+    auto index = std::make_shared<media_index_t>();
+    index->container_ = kMediaContainerMkv;
+
+    // Reads the header of the element at `offset`
+    std::vector<char> buffer;
+    const auto header_at = [&](const int64_t offset, element_header_t &header) {
+        return read_exact(read, file_size, offset, std::min<int64_t>(12, file_size - offset), buffer) &&
+               read_header(buffer.data(), buffer.size(), header);
+    };
+
+    element_header_t header;
+    if (!header_at(0, header) || header.id != kEbml || header.size == kUnknownSize) {
+        return nullptr;
+    }
+    const auto segment_offset = static_cast<int64_t>(header.header_size + header.size);
+    if (!header_at(segment_offset, header) || header.id != kSegment) {
+        return nullptr;
+    }
+    const int64_t segment_start = segment_offset + static_cast<int64_t>(header.header_size);
+    index->add_metadata_range(0, segment_start);
+    const int64_t segment_end = header.size == kUnknownSize
+                                    ? file_size
+                                    : std::min<int64_t>(file_size, segment_start + static_cast<int64_t>(header.size));
+
+    // Elements before the first Cluster, then the ones the SeekHead points to
+    int64_t seek_head = -1, info = -1, tracks = -1, cues = -1;
+    int64_t offset = segment_start;
+    for (int i = 0; i < kMaxTopLevelItems && offset < segment_end; ++i) {
+        if (!header_at(offset, header)) {
+            return nullptr;
+        }
+        if (header.id == kCluster || header.size == kUnknownSize) {
+            break;
+        }
+        if (header.id == kSeekHead && seek_head < 0) {
+            seek_head = offset;
+        } else if (header.id == kInfo) {
+            info = offset;
+        } else if (header.id == kTracks) {
+            tracks = offset;
+        } else if (header.id == kCues) {
+            cues = offset;
+        }
+        offset += static_cast<int64_t>(header.header_size + header.size);
+    }
+
+    // Reads the whole element at `offset`, checking its id
+    std::vector<char> element;
+    const auto read_element = [&](const int64_t element_offset, const uint32_t id) -> bool {
+        if (element_offset < 0 || !header_at(element_offset, header) || header.id != id ||
+            header.size == kUnknownSize || static_cast<int64_t>(header.size) > kMaxIndexSize) {
+            return false;
+        }
+        const auto size = static_cast<int64_t>(header.header_size + header.size);
+        if (!read_exact(read, file_size, element_offset, size, element)) {
+            return false;
+        }
+        index->add_metadata_range(element_offset, size);
+        return true;
+    };
+    const auto body = [&] { return element.data() + header.header_size; };
+
+    if (read_element(seek_head, kSeekHead)) {
+        for_each_element(body(), header.size, [&](const uint32_t id, const char *seek, const size_t seek_size) {
+            if (id != kSeek) {
+                return;
+            }
+            uint64_t target_id = 0;
+            int64_t position = -1;
+            for_each_element(seek, seek_size, [&](const uint32_t child, const char *data, const size_t size) {
+                if (child == kSeekId) {
+                    target_id = read_uint(data, size);
+                } else if (child == kSeekPosition) {
+                    position = segment_start + static_cast<int64_t>(read_uint(data, size));
+                }
+            });
+            if (position < segment_start || position >= segment_end) {
+                return;
+            }
+            if (target_id == kInfo && info < 0) {
+                info = position;
+            } else if (target_id == kTracks && tracks < 0) {
+                tracks = position;
+            } else if (target_id == kCues && cues < 0) {
+                cues = position;
+            }
+        });
+    }
+
+    uint64_t timecode_scale = 1000000; // ns
+    if (read_element(info, kInfo)) {
+        double duration = 0;
+        for_each_element(body(), header.size, [&](const uint32_t id, const char *data, const size_t size) {
+            if (id == kTimecodeScale) {
+                timecode_scale = read_uint(data, size);
+            } else if (id == kDuration) {
+                duration = read_float(data, size);
+            }
+        });
+        if (timecode_scale == 0) {
+            timecode_scale = 1000000;
+        }
+        index->duration_millis_ = static_cast<int64_t>(duration * static_cast<double>(timecode_scale) / 1e6);
+    }
+
+    uint64_t video_track = 0;
+    if (read_element(tracks, kTracks)) {
+        for_each_element(body(), header.size, [&](const uint32_t id, const char *entry, const size_t entry_size) {
+            if (id != kTrackEntry || video_track != 0) {
+                return;
+            }
+            uint64_t number = 0, type = 0;
+            for_each_element(entry, entry_size, [&](const uint32_t child, const char *data, const size_t size) {
+                if (child == kTrackNumber) {
+                    number = read_uint(data, size);
+                } else if (child == kTrackType) {
+                    type = read_uint(data, size);
+                }
+            });
+            if (type == 1) {
+                video_track = number;
+            }
+        });
+    }
+
+    if (read_element(cues, kCues)) {
+        index->index_range_ = byte_range_t{cues, static_cast<int64_t>(header.header_size + header.size)};
+        for_each_element(body(), header.size, [&](const uint32_t id, const char *point, const size_t point_size) {
+            if (id != kCuePoint) {
+                return;
+            }
+            uint64_t time = 0;
+            int64_t position = -1;
+            for_each_element(point, point_size, [&](const uint32_t child, const char *data, const size_t size) {
+                if (child == kCueTime) {
+                    time = read_uint(data, size);
+                } else if (child == kCueTrackPositions && position < 0) {
+                    uint64_t track = 0;
+                    int64_t cluster = -1;
+                    for_each_element(data, size, [&](const uint32_t field, const char *value, const size_t n) {
+                        if (field == kCueTrack) {
+                            track = read_uint(value, n);
+                        } else if (field == kCueClusterPosition) {
+                            cluster = static_cast<int64_t>(read_uint(value, n));
+                        }
+                    });
+                    if (cluster >= 0 && (video_track == 0 || track == video_track)) {
+                        position = segment_start + cluster;
+                    }
+                }
+            });
+            if (position >= segment_start && position < segment_end) {
+                index->keyframes_.push_back(keyframe_t{
+                    static_cast<int64_t>(static_cast<double>(time) * static_cast<double>(timecode_scale) / 1e6),
+                    position});
+            }
+        });
+        std::stable_sort(index->keyframes_.begin(), index->keyframes_.end(),
+                         [](const keyframe_t &a, const keyframe_t &b) { return a.time_millis < b.time_millis; });
+    }
+    return index;
+}
+} // namespace anilt
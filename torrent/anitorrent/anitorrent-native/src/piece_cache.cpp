@@ -0,0 +1,81 @@
+#include "piece_cache.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iterator>
+
+namespace anilt {
+void piece_cache_t::set_capacity(const int64_t capacity_bytes) {
+    capacity_bytes_ = std::max<int64_t>(0, capacity_bytes);
+    evict(0);
+}
+
+bool piece_cache_t::find(const int piece, boost::shared_array<char> &buffer, int &size) {
+    const auto it = index_.find(piece);
+    if (it == index_.end()) {
+        ++misses_;
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    buffer = it->second->buffer;
+    size = it->second->size;
+    ++hits_;
+    return true;
+}
+
+void piece_cache_t::insert(const int piece, boost::shared_array<char> buffer, const int size) {
+    if (!buffer || size <= 0 || size > capacity_bytes_) {
+        return;
+    }
+    if (const auto it = index_.find(piece); it != index_.end()) {
+        size_bytes_ -= it->second->size;
+        entries_.erase(it->second);
+        index_.erase(it);
+    }
+    evict(size);
+    entries_.push_front(entry_t{piece, std::move(buffer), size});
+    index_.emplace(piece, entries_.begin());
+    size_bytes_ += size;
+}
+
+void piece_cache_t::clear() {
+    entries_.clear();
+    index_.clear();
+    size_bytes_ = 0;
+}
+
+int64_t piece_cache_t::distance(const int piece) const {
+    if (playhead_ < 0) {
+        return 0;
+    }
+    return std::abs(static_cast<int64_t>(piece) - playhead_);
+}
+
+void piece_cache_t::evict(const int64_t needed_bytes) {
+    while (!entries_.empty() && size_bytes_ + needed_bytes > capacity_bytes_) {
+        // From the least recently used, so that it wins ties
+        auto victim = std::prev(entries_.end());
+        for (auto it = victim; it != entries_.begin();) {
+            --it;
+            if (distance(it->piece) > distance(victim->piece)) {
+                victim = it;
+            }
+        }
+        size_bytes_ -= victim->size;
+        index_.erase(victim->piece);
+        entries_.erase(victim);
+        ++evictions_;
+    }
+}
+
+piece_cache_stats_t piece_cache_t::stats() const {
+    piece_cache_stats_t stats;
+    stats.capacity_bytes = capacity_bytes_;
+    stats.size_bytes = size_bytes_;
+    stats.num_pieces = static_cast<int32_t>(entries_.size());
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    return stats;
+}
+} // namespace anilt
@@ -0,0 +1,43 @@
+#include "piece_deadlines.hpp"
+
+#include <algorithm>
+
+namespace anilt {
+void set_piece_deadlines(const lt::torrent_handle &handle, const std::vector<std::pair<int, int>> &deadlines,
+                         plugin::endgame_state_t *endgame) {
+    if (deadlines.empty()) {
+        return;
+    }
+    std::vector<std::pair<lt::piece_index_t, lt::download_priority_t>> priorities;
+    priorities.reserve(deadlines.size());
+    for (const auto &[piece, deadline]: deadlines) {
+        const lt::piece_index_t index(piece);
+        handle.set_piece_deadline(index, deadline);
+        priorities.emplace_back(index, lt::default_priority);
+        if (endgame) {
+            endgame->set_deadline(piece, deadline);
+        }
+    }
+    handle.prioritize_pieces(priorities);
+}
+
+void reset_piece_deadlines(const lt::torrent_handle &handle, const std::vector<int> &pieces,
+                           plugin::endgame_state_t *endgame) {
+    for (const int piece: pieces) {
+        handle.reset_piece_deadline(lt::piece_index_t(piece));
+        if (endgame) {
+            endgame->reset_deadline(piece);
+        }
+    }
+}
+
+std::vector<int> pieces_not_in(const std::vector<int> &before, const std::vector<int> &after) {
+    std::vector<int> pieces;
+    for (const int piece: before) {
+        if (std::find(after.begin(), after.end(), piece) == after.end()) {
+            pieces.push_back(piece);
+        }
+    }
+    return pieces;
+}
+} // namespace anilt
@@ -0,0 +1,69 @@
+#include "piece_progress.hpp"
+
+#include <algorithm>
+
+#include "global_lock.h"
+
+namespace anilt {
+piece_progress_t &piece_progress_coalescer_t::progress_of(const handle_id_t handle_id) {
+    const auto [it, inserted] = pending_.try_emplace(handle_id);
+    if (inserted) {
+        order_.push_back(handle_id);
+    }
+    return it->second;
+}
+
+void piece_progress_coalescer_t::on_block_downloading(const handle_id_t handle_id, const int32_t piece_index,
+                                                      [[maybe_unused]] const int block_index) {
+    auto &progress = progress_of(handle_id);
+    // Blocks of one piece usually arrive together, so this keeps the vector almost duplicate-free before flush
+    if (progress.downloading_pieces.empty() || progress.downloading_pieces.back() != piece_index) {
+        progress.downloading_pieces.push_back(piece_index);
+    }
+    ++progress.blocks_downloading;
+}
+
+void piece_progress_coalescer_t::on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) {
+    progress_of(handle_id).finished_pieces.push_back(piece_index);
+}
+
+void piece_progress_coalescer_t::on_piece_progress(const handle_id_t handle_id, piece_progress_t &progress) {
+    auto &pending = progress_of(handle_id);
+    pending.downloading_pieces.insert(pending.downloading_pieces.end(), progress.downloading_pieces.begin(),
+                                      progress.downloading_pieces.end());
+    pending.finished_pieces.insert(pending.finished_pieces.end(), progress.finished_pieces.begin(),
+                                   progress.finished_pieces.end());
+    pending.blocks_downloading += progress.blocks_downloading;
+}
+
+static void sort_unique(std::vector<int32_t> &pieces) {
+    std::sort(pieces.begin(), pieces.end());
+    pieces.erase(std::unique(pieces.begin(), pieces.end()), pieces.end());
+}
+
+void piece_progress_coalescer_t::deliver(const handle_id_t handle_id, piece_progress_t &progress) {
+    sort_unique(progress.downloading_pieces);
+    sort_unique(progress.finished_pieces);
+    downstream_.on_piece_progress(handle_id, progress);
+}
+
+void piece_progress_coalescer_t::before_forward(const handle_id_t handle_id) {
+    const auto it = pending_.find(handle_id);
+    if (it == pending_.end()) {
+        return;
+    }
+    auto progress = std::move(it->second);
+    pending_.erase(it);
+    order_.erase(std::find(order_.begin(), order_.end(), handle_id));
+    deliver(handle_id, progress);
+}
+
+void piece_progress_coalescer_t::flush() {
+    function_printer_t _fp("piece_progress_coalescer_t::flush");
+    for (const auto handle_id: order_) {
+        deliver(handle_id, pending_[handle_id]);
+    }
+    pending_.clear();
+    order_.clear();
+}
+} // namespace anilt
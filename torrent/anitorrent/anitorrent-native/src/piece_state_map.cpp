@@ -0,0 +1,160 @@
+#include "piece_state_map.hpp"
+
+namespace anilt {
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && std::atomic<uint32_t>::is_always_lock_free,
+              "piece states are shared with Kotlin as plain memory");
+
+/// Shift of the byte at `index` inside its 32-bit word, so that bytes are laid out in memory order
+static constexpr uint32_t byte_shift(const size_t index) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return 8 * (3 - static_cast<uint32_t>(index % 4));
+#else
+    return 8 * static_cast<uint32_t>(index % 4);
+#endif
+}
+
+bool piece_state_map_t::init(const std::vector<uint8_t> &states) {
+    std::lock_guard _(lock_);
+    if (words_) {
+        return false;
+    }
+    num_pieces_ = states.size();
+    const size_t words = kHeaderWords + (num_pieces_ + 3) / 4;
+    words_ = std::make_unique<std::atomic<uint32_t>[]>(words);
+    for (size_t i = 0; i < words; ++i) {
+        words_[i].store(0, std::memory_order_relaxed);
+    }
+    words_[1].store(static_cast<uint32_t>(num_pieces_), std::memory_order_relaxed);
+    words_[2].store(kVersion, std::memory_order_relaxed);
+    for (size_t piece = 0; piece < num_pieces_; ++piece) {
+        words_[kHeaderWords + piece / 4].fetch_or(static_cast<uint32_t>(states[piece] & kPieceStateMask)
+                                                      << byte_shift(piece),
+                                                  std::memory_order_relaxed);
+    }
+    initialized_.store(true, std::memory_order_release);
+    return true;
+}
+
+void piece_state_map_t::begin_write() {
+    words_[0].fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void piece_state_map_t::end_write() { words_[0].fetch_add(1, std::memory_order_release); }
+
+template<typename Fn>
+void piece_state_map_t::update(const int piece, Fn &&update) {
+    if (piece < 0 || static_cast<size_t>(piece) >= num_pieces_) {
+        return;
+    }
+    auto &word = words_[kHeaderWords + piece / 4];
+    const uint32_t shift = byte_shift(piece);
+    uint32_t current = word.load(std::memory_order_relaxed);
+    while (true) {
+        const auto byte = static_cast<uint8_t>(current >> shift);
+        const uint8_t updated = update(byte);
+        if (updated == byte) {
+            return;
+        }
+        const uint32_t next = (current & ~(0xFFu << shift)) | (static_cast<uint32_t>(updated) << shift);
+        if (word.compare_exchange_weak(current, next, std::memory_order_release, std::memory_order_relaxed)) {
+            return;
+        }
+    }
+}
+
+void piece_state_map_t::sync(const std::vector<uint8_t> &states) {
+    std::lock_guard _(lock_);
+    if (!words_ || states.size() != num_pieces_) {
+        return;
+    }
+    begin_write();
+    for (size_t piece = 0; piece < num_pieces_; ++piece) {
+        update(static_cast<int>(piece), [state = states[piece] & kPieceStateMask](const uint8_t byte) {
+            return static_cast<uint8_t>((byte & ~kPieceStateMask) | state);
+        });
+    }
+    end_write();
+}
+
+piece_state_map_t::piece_state_t piece_state_map_t::state(const int piece) const {
+    if (!initialized() || piece < 0 || static_cast<size_t>(piece) >= num_pieces_) {
+        return kPieceNone;
+    }
+    const uint32_t word = words_[kHeaderWords + piece / 4].load(std::memory_order_relaxed);
+    return static_cast<piece_state_t>(static_cast<uint8_t>(word >> byte_shift(piece)) & kPieceStateMask);
+}
+
+void piece_state_map_t::set_finished(const int piece) {
+    std::lock_guard _(lock_);
+    if (!words_) {
+        return;
+    }
+    // A finished piece has no deadline anymore
+    update(piece, [](uint8_t) { return static_cast<uint8_t>(kPieceFinished); });
+}
+
+void piece_state_map_t::set_downloading(const int piece) {
+    std::lock_guard _(lock_);
+    if (!words_) {
+        return;
+    }
+    update(piece, [](const uint8_t byte) {
+        return (byte & kPieceStateMask) == kPieceNone ? static_cast<uint8_t>(byte | kPieceDownloading) : byte;
+    });
+}
+
+void piece_state_map_t::sync_downloading(const std::vector<int> &downloading) {
+    std::lock_guard _(lock_);
+    if (!words_) {
+        return;
+    }
+    std::vector<bool> in_queue(num_pieces_);
+    for (const int piece: downloading) {
+        if (piece >= 0 && static_cast<size_t>(piece) < num_pieces_) {
+            in_queue[piece] = true;
+        }
+    }
+    begin_write();
+    for (size_t piece = 0; piece < num_pieces_; ++piece) {
+        update(static_cast<int>(piece), [queued = in_queue[piece]](const uint8_t byte) {
+            const uint8_t state = byte & kPieceStateMask;
+            if (state == kPieceFinished) {
+                return byte;
+            }
+            return static_cast<uint8_t>((byte & ~kPieceStateMask) | (queued ? kPieceDownloading : kPieceNone));
+        });
+    }
+    end_write();
+}
+
+void piece_state_map_t::set_deadline(const int piece, const bool deadline) {
+    std::lock_guard _(lock_);
+    if (!words_) {
+        return;
+    }
+    update(piece, [deadline](const uint8_t byte) {
+        if (deadline && (byte & kPieceStateMask) == kPieceFinished) {
+            return byte;
+        }
+        return static_cast<uint8_t>(deadline ? byte | kPieceDeadline : byte & ~kPieceDeadline);
+    });
+}
+
+void piece_state_map_t::clear_deadlines() {
+    std::lock_guard _(lock_);
+    if (!words_) {
+        return;
+    }
+    begin_write();
+    for (size_t piece = 0; piece < num_pieces_; ++piece) {
+        update(static_cast<int>(piece),
+               [](const uint8_t byte) { return static_cast<uint8_t>(byte & ~kPieceDeadline); });
+    }
+    end_write();
+}
+
+char *piece_state_map_t::data() const {
+    return initialized() ? reinterpret_cast<char *>(words_.get()) : nullptr;
+}
+} // namespace anilt
@@ -0,0 +1,410 @@
+#include <algorithm>
+#include <unordered_set>
+#include <boost/asio/error.hpp>
+#include <libtorrent/extensions.hpp>
+#include <libtorrent/peer_connection.hpp>
+#include <libtorrent/peer_connection_handle.hpp>
+#include <libtorrent/piece_block.hpp>
+#include "plugin/streaming_plugin.h"
+
+namespace anilt::plugin {
+    void endgame_state_t::set_enabled(const bool enabled) {
+        std::lock_guard _(lock_);
+        enabled_ = enabled;
+    }
+
+    bool endgame_state_t::enabled() const {
+        std::lock_guard _(lock_);
+        return enabled_;
+    }
+
+    void endgame_state_t::configure(const int threshold_millis, const int min_request_age_millis,
+                                    const int max_extra_peers) {
+        std::lock_guard _(lock_);
+        threshold_ = std::chrono::milliseconds(threshold_millis);
+        min_request_age_ = std::chrono::milliseconds(std::max(0, min_request_age_millis));
+        max_extra_peers_ = std::max(0, max_extra_peers);
+    }
+
+    void endgame_state_t::set_asap_grace(const int grace_millis) {
+        std::lock_guard _(lock_);
+        asap_grace_ = std::chrono::milliseconds(std::max(0, grace_millis));
+    }
+
+    void endgame_state_t::set_deadline(const int piece, const int deadline_millis) {
+        // libtorrent ignores deadlines of pieces it has, they would never finish
+        if (piece_states_ && piece_states_->state(piece) == piece_state_map_t::kPieceFinished) {
+            return;
+        }
+        const auto now = steady_clock::now();
+        std::lock_guard _(lock_);
+        auto &deadline = deadlines_[piece];
+        if (deadline_millis > 0) {
+            deadline = deadline_t{now + std::chrono::milliseconds(deadline_millis), now, false};
+        } else if (!deadline.asap) {
+            deadline = deadline_t{now + asap_grace_, now, true};
+        } else {
+            // Keeps waiting since the first time, re-prioritizing does not make a piece less urgent
+            return;
+        }
+        if (tracker_) {
+            tracker_->on_deadline(piece, deadline.due, now);
+        }
+        if (piece_states_) {
+            piece_states_->set_deadline(piece, true);
+        }
+    }
+
+    void endgame_state_t::reset_deadline(const int piece) {
+        std::lock_guard _(lock_);
+        deadlines_.erase(piece);
+        if (piece_states_) {
+            piece_states_->set_deadline(piece, false);
+        }
+        if (tracker_) {
+            tracker_->forget(piece);
+        }
+    }
+
+    void endgame_state_t::clear() {
+        std::lock_guard _(lock_);
+        deadlines_.clear();
+        if (piece_states_) {
+            piece_states_->clear_deadlines();
+        }
+        if (tracker_) {
+            tracker_->forget_all();
+        }
+    }
+
+    void endgame_state_t::on_piece_passed(const int piece) {
+        std::lock_guard _(lock_);
+        deadlines_.erase(piece);
+        if (piece_states_) {
+            piece_states_->set_deadline(piece, false);
+        }
+        if (tracker_) {
+            tracker_->on_finished(piece, steady_clock::now());
+        }
+    }
+
+    std::vector<int> endgame_state_t::urgent_pieces(const steady_clock::time_point now) const {
+        std::vector<std::pair<steady_clock::time_point, int>> urgent;
+        {
+            std::lock_guard _(lock_);
+            if (!enabled_) {
+                return {};
+            }
+            for (const auto &[piece, deadline]: deadlines_) {
+                // A negative deadline is always less than the threshold away, so those count from when they were set
+                if (deadline.asap ? now - deadline.since >= threshold_ : deadline.due - now <= threshold_) {
+                    urgent.emplace_back(deadline.asap ? deadline.since + threshold_ : deadline.due, piece);
+                }
+            }
+        }
+        std::sort(urgent.begin(), urgent.end());
+        std::vector<int> pieces;
+        pieces.reserve(urgent.size());
+        for (const auto &[deadline, piece]: urgent) {
+            pieces.push_back(piece);
+        }
+        return pieces;
+    }
+
+    steady_clock::duration endgame_state_t::min_request_age() const {
+        std::lock_guard _(lock_);
+        return min_request_age_;
+    }
+
+    int endgame_state_t::max_extra_peers() const {
+        std::lock_guard _(lock_);
+        return max_extra_peers_;
+    }
+
+    std::vector<int> endgame_state_t::deadline_pieces() const {
+        std::lock_guard _(lock_);
+        std::vector<int> pieces;
+        pieces.reserve(deadlines_.size());
+        for (const auto &[piece, deadline]: deadlines_) {
+            pieces.push_back(piece);
+        }
+        return pieces;
+    }
+
+    void endgame_state_t::update_quality_stats(const int median_rtt_millis, const int slow_peers, const int reassigned,
+                                               const int disconnected) {
+        std::lock_guard _(lock_);
+        quality_stats_.median_rtt_millis = median_rtt_millis;
+        quality_stats_.slow_peers = slow_peers;
+        quality_stats_.reassigned_requests += reassigned;
+        quality_stats_.disconnected_peers += disconnected;
+    }
+
+    streaming_quality_stats_t endgame_state_t::quality_stats() const {
+        std::lock_guard _(lock_);
+        return quality_stats_;
+    }
+
+    // Peers need this many RTT samples before being compared
+    static constexpr int kMinRttSamples = 4;
+    // A peer is slow when its RTT (or its oldest outstanding request) exceeds the median RTT by this factor...
+    static constexpr double kSlowRttFactor = 3;
+    // ...and this many milliseconds, so that a swarm of fast peers does not produce laggards
+    static constexpr double kMinSlowRttMillis = 800;
+    // Ticks (seconds) a peer must stay slow before its deadline requests are moved
+    static constexpr int kSlowTicksToReassign = 2;
+    // Ticks a peer must stay slow before kStreamingQualityAggressive disconnects it
+    static constexpr int kSlowTicksToDisconnect = 20;
+    // kStreamingQualityAggressive keeps slow peers when fewer fast peers are unchoked
+    static constexpr size_t kMinFastPeersToDisconnect = 4;
+    // Outstanding requests above which a fast peer does not take more
+    static constexpr size_t kMaxFastPeerRequests = 32;
+
+    static int block_of(lt::peer_request const &r) { return r.start / lt::default_block_size; }
+
+    void streaming_peer_plugin::sent_request(lt::peer_request const &r) {
+        requests_.push_back({static_cast<int>(r.piece), block_of(r), steady_clock::now()});
+    }
+
+    void streaming_peer_plugin::sent_cancel(lt::peer_request const &r) {
+        // Cancelled by libtorrent (e.g. the piece was received from another peer in endgame), the peer owes nothing
+        erase_request(static_cast<int>(r.piece), block_of(r));
+    }
+
+    bool streaming_peer_plugin::on_piece(lt::peer_request const &r, lt::span<char const> buf) {
+        bytes_since_tick_ += r.length;
+        const int piece = static_cast<int>(r.piece);
+        const int block = block_of(r);
+        const auto it = std::find_if(requests_.begin(), requests_.end(), [&](const request_t &request) {
+            return request.piece == piece && request.block == block;
+        });
+        if (it != requests_.end()) {
+            const double rtt = std::chrono::duration<double, std::milli>(steady_clock::now() - it->sent).count();
+            rtt_millis_ = rtt_samples_ == 0 ? rtt : rtt_millis_ * 0.8 + rtt * 0.2;
+            ++rtt_samples_;
+        }
+        erase_request(piece, block);
+        return lt::peer_plugin::on_piece(r, buf);
+    }
+
+    bool streaming_peer_plugin::on_reject(lt::peer_request const &r) {
+        erase_request(static_cast<int>(r.piece), block_of(r));
+        return lt::peer_plugin::on_reject(r);
+    }
+
+    bool streaming_peer_plugin::on_choke() {
+        // Outstanding requests are dropped by a choking peer
+        requests_.clear();
+        return lt::peer_plugin::on_choke();
+    }
+
+    void streaming_peer_plugin::tick() {
+        rate_ = rate_ * 0.7 + static_cast<double>(bytes_since_tick_) * 0.3;
+        bytes_since_tick_ = 0;
+    }
+
+    bool streaming_peer_plugin::has_request(const int piece, const int block) const {
+        return std::any_of(requests_.begin(), requests_.end(), [&](const request_t &request) {
+            return request.piece == piece && request.block == block;
+        });
+    }
+
+    void streaming_peer_plugin::erase_request(const int piece, const int block) {
+        const auto it = std::find_if(requests_.begin(), requests_.end(), [&](const request_t &request) {
+            return request.piece == piece && request.block == block;
+        });
+        if (it != requests_.end()) {
+            requests_.erase(it);
+        }
+    }
+
+    steady_clock::duration streaming_peer_plugin::oldest_request_age(const steady_clock::time_point now) const {
+        steady_clock::duration oldest{0};
+        for (const auto &request: requests_) {
+            oldest = std::max(oldest, now - request.sent);
+        }
+        return oldest;
+    }
+
+    void streaming_peer_plugin::erase_piece(const int piece) {
+        requests_.erase(std::remove_if(requests_.begin(), requests_.end(),
+                                       [piece](const request_t &request) { return request.piece == piece; }),
+                        requests_.end());
+    }
+
+    std::shared_ptr<lt::peer_plugin>
+    streaming_torrent_plugin::new_connection(lt::peer_connection_handle const &handle) {
+        auto peer = std::make_shared<streaming_peer_plugin>(handle);
+        peers_.push_back(peer);
+        return peer;
+    }
+
+    void streaming_torrent_plugin::on_piece_pass(const lt::piece_index_t piece) {
+        state_->on_piece_passed(static_cast<int>(piece));
+        for (const auto &peer: live_peers()) {
+            peer->erase_piece(static_cast<int>(piece));
+        }
+    }
+
+    void streaming_torrent_plugin::on_piece_failed(const lt::piece_index_t piece) {
+        for (const auto &peer: live_peers()) {
+            peer->erase_piece(static_cast<int>(piece));
+        }
+    }
+
+    streaming_torrent_plugin::peer_list_t streaming_torrent_plugin::live_peers() {
+        peer_list_t live;
+        live.reserve(peers_.size());
+        peers_.erase(std::remove_if(peers_.begin(), peers_.end(),
+                                    [&live](const std::weak_ptr<streaming_peer_plugin> &weak) {
+                                        auto peer = weak.lock();
+                                        if (!peer) {
+                                            return true;
+                                        }
+                                        live.push_back(std::move(peer));
+                                        return false;
+                                    }),
+                     peers_.end());
+        std::sort(live.begin(), live.end(), [](const auto &a, const auto &b) { return a->rate_ > b->rate_; });
+        return live;
+    }
+
+    void streaming_torrent_plugin::tick() {
+        const auto now = steady_clock::now();
+        const auto peers = live_peers();
+        apply_quality_mode(peers, now);
+        run_endgame(peers, now);
+    }
+
+    void streaming_torrent_plugin::apply_quality_mode(const peer_list_t &peers, const steady_clock::time_point now) {
+        std::vector<double> rtts;
+        for (const auto &peer: peers) {
+            if (peer->rtt_samples_ >= kMinRttSamples) {
+                rtts.push_back(peer->rtt_millis_);
+            }
+        }
+        if (rtts.size() < 2) {
+            state_->update_quality_stats(-1, 0, 0, 0);
+            return;
+        }
+        const auto middle = rtts.begin() + static_cast<std::ptrdiff_t>(rtts.size() / 2);
+        std::nth_element(rtts.begin(), middle, rtts.end());
+        const double median = *middle;
+        const double slow_rtt = std::max(median * kSlowRttFactor, median + kMinSlowRttMillis);
+
+        // Peers stay sorted by throughput, so the first fast ones are the best
+        peer_list_t fast;
+        peer_list_t laggards;
+        int slow_peers = 0;
+        for (const auto &peer: peers) {
+            const double oldest = std::chrono::duration<double, std::milli>(peer->oldest_request_age(now)).count();
+            const bool slow = (peer->rtt_samples_ >= kMinRttSamples && peer->rtt_millis_ > slow_rtt) ||
+                              oldest > slow_rtt;
+            peer->slow_ticks_ = slow ? peer->slow_ticks_ + 1 : 0;
+            const auto &connection = peer->peer_connection_;
+            if (slow) {
+                ++slow_peers;
+                if (peer->slow_ticks_ >= kSlowTicksToReassign) {
+                    laggards.push_back(peer);
+                }
+            } else if (peer->rtt_samples_ >= kMinRttSamples && peer->rtt_millis_ <= median &&
+                       !connection.is_disconnecting() && !connection.has_peer_choked()) {
+                fast.push_back(peer);
+            }
+        }
+
+        const auto mode = state_->quality_mode();
+        int reassigned = 0;
+        int disconnected = 0;
+        if (mode != kStreamingQualityOff && !laggards.empty() && !fast.empty()) {
+            const auto deadline_pieces = state_->deadline_pieces();
+            const std::unordered_set<int> deadlines(deadline_pieces.begin(), deadline_pieces.end());
+            for (const auto &laggard: laggards) {
+                const auto slow_native = laggard->peer_connection_.native_handle();
+                if (!slow_native) {
+                    continue;
+                }
+                // Copied, cancelled requests are erased below
+                const auto requests = laggard->requests_;
+                for (const auto &request: requests) {
+                    if (!deadlines.count(request.piece)) {
+                        continue;
+                    }
+                    const lt::piece_block block(lt::piece_index_t(request.piece), request.block);
+                    for (const auto &peer: fast) {
+                        if (peer->requests_.size() >= kMaxFastPeerRequests ||
+                            peer->has_request(request.piece, request.block) ||
+                            !peer->peer_connection_.has_piece(block.piece_index)) {
+                            continue;
+                        }
+                        const auto native = peer->peer_connection_.native_handle();
+                        // busy: the laggard still holds the block until it honours the cancel
+                        if (native && native->add_request(block, lt::peer_connection::busy |
+                                                                     lt::peer_connection::time_critical)) {
+                            native->send_block_requests();
+                            slow_native->cancel_request(block);
+                            laggard->erase_request(request.piece, request.block);
+                            ++reassigned;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        if (mode == kStreamingQualityAggressive && fast.size() >= kMinFastPeersToDisconnect) {
+            for (const auto &laggard: laggards) {
+                if (laggard->slow_ticks_ >= kSlowTicksToDisconnect && !laggard->peer_connection_.is_disconnecting()) {
+                    laggard->peer_connection_.disconnect(boost::asio::error::timed_out, lt::operation_t::bittorrent,
+                                                         lt::disconnect_severity_t{0});
+                    ++disconnected;
+                }
+            }
+        }
+        state_->update_quality_stats(static_cast<int>(median), slow_peers, reassigned, disconnected);
+    }
+
+    void streaming_torrent_plugin::run_endgame(const peer_list_t &peers, const steady_clock::time_point now) {
+        const auto urgent = state_->urgent_pieces(now);
+        if (urgent.empty()) {
+            return;
+        }
+        const auto min_age = state_->min_request_age();
+        const int max_extra_peers = state_->max_extra_peers();
+
+        // Collect first: sending requests updates the request lists of the peers
+        std::vector<std::pair<int, int>> stalled_blocks;
+        for (const int piece: urgent) {
+            for (const auto &peer: peers) {
+                for (const auto &request: peer->requests_) {
+                    if (request.piece == piece && now - request.sent >= min_age) {
+                        stalled_blocks.emplace_back(piece, request.block);
+                    }
+                }
+            }
+        }
+
+        for (const auto &[piece, block]: stalled_blocks) {
+            const int requested_by = static_cast<int>(std::count_if(peers.begin(), peers.end(), [&](const auto &peer) {
+                return peer->has_request(piece, block);
+            }));
+            int extra = requested_by - 1;
+            for (const auto &peer: peers) {
+                if (extra >= max_extra_peers) {
+                    break;
+                }
+                const auto &connection = peer->peer_connection_;
+                if (peer->has_request(piece, block) || connection.is_disconnecting() ||
+                    connection.has_peer_choked() || !connection.has_piece(lt::piece_index_t(piece))) {
+                    continue;
+                }
+                const auto native = connection.native_handle();
+                if (native && native->add_request(lt::piece_block(lt::piece_index_t(piece), block),
+                                                  lt::peer_connection::busy)) {
+                    native->send_block_requests();
+                    state_->count_duplicated_request();
+                    ++extra;
+                }
+            }
+        }
+    }
+} // namespace anilt::plugin
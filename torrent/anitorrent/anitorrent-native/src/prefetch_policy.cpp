@@ -0,0 +1,130 @@
+#include "prefetch_policy.hpp"
+
+#include <algorithm>
+
+#include "global_lock.h"
+#include "libtorrent/torrent_info.hpp"
+
+namespace anilt {
+void prefetch_policy_t::set_size(const int64_t bytes) {
+    function_printer_t _fp("prefetch_policy_t::set_size");
+    std::lock_guard _(lock_);
+    size_ = std::max<int64_t>(bytes, 0);
+    retarget();
+}
+
+void prefetch_policy_t::start(const streaming_config_t &config) {
+    function_printer_t _fp("prefetch_policy_t::start");
+    std::lock_guard _(lock_);
+    const bool same_file = streaming_ && config_.file_index == config.file_index;
+    streaming_ = true;
+    config_ = config;
+    if (!same_file) {
+        retarget();
+    }
+}
+
+void prefetch_policy_t::stop() {
+    function_printer_t _fp("prefetch_policy_t::stop");
+    std::lock_guard _(lock_);
+    streaming_ = false;
+    retarget();
+}
+
+int prefetch_policy_t::target_file() const {
+    std::lock_guard _(lock_);
+    return target_file_;
+}
+
+void prefetch_policy_t::retarget() {
+    const auto ti = handle_.torrent_file();
+    int target = -1;
+    if (streaming_ && size_ > 0 && ti) {
+        const auto &files = ti->files();
+        for (int file = config_.file_index + 1; file < ti->num_files(); ++file) {
+            if (!files.pad_file_at(lt::file_index_t(file)) && files.file_size(lt::file_index_t(file)) > 0) {
+                target = file;
+                break;
+            }
+        }
+    }
+    if (target == target_file_) {
+        return;
+    }
+    // Playback moved to the file being prefetched: its pieces now belong to the scheduler
+    if (target_file_ != config_.file_index || !streaming_) {
+        release();
+    }
+    pieces_.clear();
+    applied_ = lt::dont_download;
+    target_file_ = target;
+    yielding_ = false;
+    if (target < 0) {
+        return;
+    }
+
+    const auto &files = ti->files();
+    const lt::file_index_t file(target);
+    const int64_t begin = files.file_offset(file);
+    const int64_t end = begin + files.file_size(file);
+    const int64_t piece_length = ti->piece_length();
+    const auto add_range = [&](const int64_t from, const int64_t to) {
+        if (to <= from) {
+            return;
+        }
+        for (auto piece = static_cast<int>(from / piece_length); piece <= static_cast<int>((to - 1) / piece_length);
+             ++piece) {
+            if (std::find(pieces_.begin(), pieces_.end(), piece) == pieces_.end()) {
+                pieces_.push_back(piece);
+            }
+        }
+    };
+    add_range(begin, std::min(end, begin + std::max(size_, config_.header_size)));
+    add_range(std::max(begin, end - config_.footer_size), end);
+
+    // Pieces that are wanted anyway are not at priority 0 and are left alone
+    apply(lt::low_priority);
+}
+
+void prefetch_policy_t::apply(const lt::download_priority_t priority) {
+    if (pieces_.empty()) {
+        return;
+    }
+    // A piece whose priority changed since it was last set belongs to the scheduler, a reader or the user
+    const auto current = handle_.get_piece_priorities();
+    pieces_.erase(std::remove_if(pieces_.begin(), pieces_.end(),
+                                 [&](const int piece) {
+                                     return piece >= static_cast<int>(current.size()) || current[piece] != applied_;
+                                 }),
+                  pieces_.end());
+    applied_ = priority;
+    if (pieces_.empty()) {
+        return;
+    }
+    std::vector<std::pair<lt::piece_index_t, lt::download_priority_t>> priorities;
+    priorities.reserve(pieces_.size());
+    for (const int piece: pieces_) {
+        priorities.emplace_back(lt::piece_index_t(piece), priority);
+    }
+    handle_.prioritize_pieces(priorities);
+}
+
+void prefetch_policy_t::release() {
+    // Finished pieces keep their data whatever their priority
+    apply(lt::dont_download);
+}
+
+void prefetch_policy_t::update(const int buffered_pieces) {
+    std::lock_guard _(lock_);
+    if (target_file_ < 0 || pieces_.empty()) {
+        return;
+    }
+    if (!yielding_ && buffered_pieces < std::max(config_.window_size / 2, 1)) {
+        yielding_ = true;
+        apply(lt::dont_download);
+    } else if (yielding_ && buffered_pieces >= config_.window_size) {
+        yielding_ = false;
+        apply(lt::low_priority);
+    }
+}
+} // namespace anilt
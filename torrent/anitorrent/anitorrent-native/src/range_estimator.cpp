@@ -0,0 +1,133 @@
+#include "range_estimator.hpp"
+
+#include <algorithm>
+
+#include "libtorrent/peer_info.hpp"
+#include "libtorrent/torrent_info.hpp"
+#include "libtorrent/torrent_status.hpp"
+
+namespace anilt {
+// Bounds memory when pieces are small and the swarm is fast
+static constexpr size_t kMaxCompletions = 1024;
+// libtorrent requests blocks of this size
+static constexpr int64_t kBlockSize = 16 * 1024;
+// Completions needed in the window for full confidence in the completion rate
+static constexpr double kFullConfidenceSamples = 16;
+// The confidence halves for an estimate this far away
+static constexpr double kConfidenceHorizonSeconds = 300;
+
+void range_estimator_t::on_piece_finished(const clock::time_point now) {
+    std::lock_guard _(lock_);
+    completions_.push_back(now);
+    while (completions_.size() > kMaxCompletions || (!completions_.empty() && now - completions_.front() > kWindow)) {
+        completions_.pop_front();
+    }
+}
+
+double range_estimator_t::completion_rate(const clock::time_point now, int &samples) const {
+    std::lock_guard _(lock_);
+    const auto first = std::find_if(completions_.begin(), completions_.end(),
+                                    [now](const clock::time_point time) { return now - time <= kWindow; });
+    samples = static_cast<int>(std::distance(first, completions_.end()));
+    if (samples < 2) {
+        return 0;
+    }
+    // Measured from the first completion, so that a burst right after a seek is not averaged over the window
+    const double seconds = std::max(1.0, std::chrono::duration<double>(now - *first).count());
+    return samples / seconds;
+}
+
+range_eta_t range_estimator_t::estimate(const lt::torrent_handle &handle, const int file_index, const int64_t offset,
+                                        const int64_t length, const clock::time_point now) const {
+    range_eta_t eta;
+    const auto ti = handle.torrent_file();
+    if (!ti || file_index < 0 || file_index >= ti->num_files() || offset < 0 || length <= 0) {
+        return eta;
+    }
+    const auto &files = ti->files();
+    const lt::file_index_t file(file_index);
+    const int64_t file_size = files.file_size(file);
+    if (offset >= file_size) {
+        return eta;
+    }
+    const int64_t begin = files.file_offset(file) + offset;
+    const int64_t end = begin + std::min(length, file_size - offset);
+    const int64_t piece_length = ti->piece_length();
+    const auto first_piece = static_cast<int>(begin / piece_length);
+    const auto last_piece = static_cast<int>((end - 1) / piece_length);
+
+    const lt::torrent_status status = handle.status(lt::torrent_handle::query_pieces);
+    std::vector<int> missing;
+    for (int piece = first_piece; piece <= last_piece; ++piece) {
+        if (piece >= status.pieces.size() || !status.pieces[lt::piece_index_t(piece)]) {
+            missing.push_back(piece);
+            eta.remaining_bytes += ti->piece_size(lt::piece_index_t(piece));
+        }
+    }
+    eta.missing_pieces = static_cast<int32_t>(missing.size());
+    if (missing.empty()) {
+        eta.eta_millis = 0;
+        eta.confidence = 1;
+        return eta;
+    }
+
+    std::vector<lt::partial_piece_info> queue;
+    handle.get_download_queue(queue);
+    for (const auto &partial: queue) {
+        const int piece = static_cast<int>(partial.piece_index);
+        if (!std::binary_search(missing.begin(), missing.end(), piece)) {
+            continue;
+        }
+        eta.remaining_bytes -= std::min<int64_t>(ti->piece_size(partial.piece_index) - 1,
+                                                 int64_t{partial.finished + partial.writing} * kBlockSize);
+        if (partial.finished + partial.writing + partial.requested > 0) {
+            ++eta.in_flight_pieces;
+        }
+    }
+
+    std::vector<int> availability;
+    handle.piece_availability(availability);
+    for (const int piece: missing) {
+        if (piece < static_cast<int>(availability.size()) && availability[piece] == 0) {
+            // Nobody to download it from, any estimate would be made up
+            return eta;
+        }
+    }
+
+    // Rate of the peers that can serve the range
+    std::vector<lt::peer_info> peers;
+    handle.get_peer_info(peers);
+    int64_t peer_rate = 0;
+    for (const auto &peer: peers) {
+        const bool useful = static_cast<bool>(peer.flags & lt::peer_info::seed) ||
+            std::any_of(missing.begin(), missing.end(), [&peer](const int piece) {
+                return piece < peer.pieces.size() && peer.pieces[lt::piece_index_t(piece)];
+            });
+        if (useful) {
+            peer_rate += peer.payload_down_speed;
+        }
+    }
+
+    int samples = 0;
+    const double completion_rate = this->completion_rate(now, samples) * static_cast<double>(piece_length);
+    double rate;
+    double agreement = 0;
+    if (completion_rate > 0 && peer_rate > 0) {
+        rate = (completion_rate + static_cast<double>(peer_rate)) / 2;
+        agreement = std::min<double>(completion_rate, peer_rate) / std::max<double>(completion_rate, peer_rate);
+    } else {
+        rate = std::max<double>(completion_rate, peer_rate);
+    }
+    eta.rate_bytes_per_second = static_cast<int64_t>(rate);
+    if (rate <= 0) {
+        return eta;
+    }
+    const double seconds = static_cast<double>(eta.remaining_bytes) / rate;
+    eta.eta_millis = static_cast<int64_t>(seconds * 1000);
+
+    const double sample_factor = std::min(1.0, samples / kFullConfidenceSamples);
+    const double horizon_factor = 1 / (1 + seconds / kConfidenceHorizonSeconds);
+    eta.confidence = static_cast<float>((sample_factor + agreement) / 2 * horizon_factor);
+    return eta;
+}
+} // namespace anilt
@@ -0,0 +1,237 @@
+#include "resume_data_writer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "alert_dispatcher.hpp"
+#include "global_lock.h"
+
+namespace anilt {
+static bool sync_file(std::FILE *file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return ::fsync(fileno(file)) == 0;
+#endif
+}
+
+// Makes the renames in directories durable. Each directory is opened once, when its first file is added, and
+// synced once by `sync`. Not needed (and not possible) on Windows.
+class directory_syncer_t final {
+  public:
+    directory_syncer_t() = default;
+    directory_syncer_t(const directory_syncer_t &) = delete;
+    directory_syncer_t &operator=(const directory_syncer_t &) = delete;
+    ~directory_syncer_t() { sync(); }
+
+    void add(const std::string &file_path) {
+#ifndef _WIN32
+        auto directory = std::filesystem::path(file_path).parent_path();
+        for (const auto &entry: directories_) {
+            if (entry.first == directory) {
+                return;
+            }
+        }
+        const int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY);
+        directories_.emplace_back(std::move(directory), fd);
+#endif
+    }
+
+    void sync() {
+#ifndef _WIN32
+        for (const auto &[directory, fd]: directories_) {
+            if (fd >= 0) {
+                ::fsync(fd);
+                ::close(fd);
+            }
+        }
+        directories_.clear();
+#endif
+    }
+
+  private:
+    std::vector<std::pair<std::filesystem::path, int>> directories_{};
+};
+
+static std::string temp_path_for(const std::string &path) { return path + ".tmp"; }
+
+// Writes `data` to the temporary file of `path`. The file is left open so that it can be synced later.
+static std::FILE *write_temp_file(const std::vector<char> &data, const std::string &path) {
+    std::FILE *file = std::fopen(temp_path_for(path).c_str(), "wb");
+    if (!file) {
+        std::cerr << "Error opening file for writing: " << temp_path_for(path) << std::endl;
+        return nullptr;
+    }
+    if (!data.empty() && std::fwrite(data.data(), 1, data.size(), file) != data.size()) {
+        std::cerr << "Error writing file: " << temp_path_for(path) << std::endl;
+        std::fclose(file);
+        return nullptr;
+    }
+    return file;
+}
+
+// Closes `file` (syncing it first if requested) and renames it over `path`
+static bool commit_temp_file(std::FILE *file, const std::string &path, const bool fsync) {
+    bool ok = fsync ? sync_file(file) : std::fflush(file) == 0;
+    ok = std::fclose(file) == 0 && ok;
+    std::error_code ec;
+    if (ok) {
+        std::filesystem::rename(temp_path_for(path), path, ec);
+        ok = !ec;
+    }
+    if (!ok) {
+        std::cerr << "Error saving file: " << path << std::endl;
+        std::filesystem::remove(temp_path_for(path), ec);
+    }
+    return ok;
+}
+
+bool resume_data_writer_t::write_atomically(const std::vector<char> &data, const std::string &path,
+                                            const bool fsync) {
+    std::FILE *file = write_temp_file(data, path);
+    if (!file) {
+        return false;
+    }
+    const bool ok = commit_temp_file(file, path, fsync);
+    if (ok && fsync) {
+        directory_syncer_t directories;
+        directories.add(path);
+    }
+    return ok;
+}
+
+resume_data_writer_t::resume_data_writer_t(std::function<void()> notify) : notify_(std::move(notify)) {
+    thread_ = std::thread([this] { run(); });
+}
+
+resume_data_writer_t::~resume_data_writer_t() {
+    {
+        std::lock_guard _(lock_);
+        stopping_ = true;
+    }
+    jobs_changed_.notify_all();
+    if (thread_.joinable()) {
+        // Pending jobs are still written before the thread exits
+        thread_.join();
+    }
+}
+
+void resume_data_writer_t::enqueue(const handle_id_t handle_id, std::vector<char> &&data, std::string path) {
+    {
+        std::lock_guard _(lock_);
+        auto [it, inserted] = pending_.try_emplace(path);
+        if (inserted) {
+            order_.push_back(path);
+        }
+        // A newer save to the same path supersedes the pending one, and completes it
+        auto &job = it->second;
+        job.data = std::move(data);
+        job.path = std::move(path);
+        if (std::find(job.handle_ids.begin(), job.handle_ids.end(), handle_id) == job.handle_ids.end()) {
+            job.handle_ids.push_back(handle_id);
+        }
+        ++enqueued_;
+    }
+    jobs_changed_.notify_all();
+}
+
+bool resume_data_writer_t::flush(const std::chrono::milliseconds timeout) {
+    function_printer_t _fp("resume_data_writer_t::flush");
+    std::unique_lock lock(lock_);
+    const uint64_t target = enqueued_;
+    return jobs_changed_.wait_for(lock, timeout, [this, target] { return done_ >= target; });
+}
+
+void resume_data_writer_t::set_fsync(const bool enabled) {
+    std::lock_guard _(lock_);
+    fsync_ = enabled;
+}
+
+void resume_data_writer_t::deliver_completions(event_listener_t &listener) {
+    std::vector<completion_t> completions;
+    {
+        std::lock_guard _(completions_lock_);
+        if (completions_.empty()) {
+            return;
+        }
+        completions.swap(completions_);
+    }
+    if (!(listener.subscribed_events & event_bit(kEventResumeDataSaved))) {
+        return;
+    }
+    for (const auto &completion: completions) {
+        listener.on_resume_data_saved(completion.handle_id, completion.success);
+    }
+}
+
+void resume_data_writer_t::run() {
+    struct batch_entry_t {
+        job_t job;
+        std::FILE *file = nullptr;
+    };
+
+    std::vector<batch_entry_t> batch;
+    std::unique_lock lock(lock_);
+    while (true) {
+        jobs_changed_.wait(lock, [this] { return stopping_ || !order_.empty(); });
+        if (order_.empty()) {
+            return; // stopping and nothing left to write
+        }
+
+        batch.clear();
+        for (const auto &path: order_) {
+            batch.push_back({std::move(pending_[path])});
+        }
+        pending_.clear();
+        order_.clear();
+        const uint64_t batch_end = enqueued_;
+        const bool fsync = fsync_;
+        lock.unlock();
+
+        // Write everything first, then sync and rename, so that the disk can merge the flushes
+        for (auto &entry: batch) {
+            entry.file = write_temp_file(entry.job.data, entry.job.path);
+        }
+        std::vector<completion_t> completions;
+        completions.reserve(batch.size());
+        directory_syncer_t directories;
+        for (auto &entry: batch) {
+            bool ok = false;
+            if (entry.file) {
+                ok = commit_temp_file(entry.file, entry.job.path, fsync);
+            }
+            if (ok && fsync) {
+                directories.add(entry.job.path);
+            }
+            for (const auto handle_id: entry.job.handle_ids) {
+                completions.push_back({handle_id, ok});
+            }
+        }
+        directories.sync();
+
+        {
+            std::lock_guard _(completions_lock_);
+            completions_.insert(completions_.end(), completions.begin(), completions.end());
+        }
+        if (notify_) {
+            notify_();
+        }
+
+        lock.lock();
+        done_ = batch_end;
+        jobs_changed_.notify_all();
+    }
+}
+} // namespace anilt
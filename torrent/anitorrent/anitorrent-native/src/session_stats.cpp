@@ -0,0 +1,73 @@
+#include "session_stats.hpp"
+
+#include "global_lock.h"
+#include "libtorrent/session_stats.hpp"
+
+namespace anilt {
+session_stats_collector_t::session_stats_collector_t() {
+    function_printer_t _fp("session_stats_collector_t::session_stats_collector_t");
+    // -1 if the metric does not exist in this version of libtorrent
+    indices_[kRecvPayloadBytes] = lt::find_metric_idx("net.recv_payload_bytes");
+    indices_[kSentPayloadBytes] = lt::find_metric_idx("net.sent_payload_bytes");
+    indices_[kRecvBytes] = lt::find_metric_idx("net.recv_bytes");
+    indices_[kSentBytes] = lt::find_metric_idx("net.sent_bytes");
+    indices_[kRecvIpOverheadBytes] = lt::find_metric_idx("net.recv_ip_overhead_bytes");
+    indices_[kSentIpOverheadBytes] = lt::find_metric_idx("net.sent_ip_overhead_bytes");
+    indices_[kRecvRedundantBytes] = lt::find_metric_idx("net.recv_redundant_bytes");
+    indices_[kRecvFailedBytes] = lt::find_metric_idx("net.recv_failed_bytes");
+    indices_[kQueuedDiskJobs] = lt::find_metric_idx("disk.queued_disk_jobs");
+    indices_[kQueuedWriteBytes] = lt::find_metric_idx("disk.queued_write_bytes");
+    indices_[kBlocksRead] = lt::find_metric_idx("disk.num_blocks_read");
+    indices_[kBlocksCacheHits] = lt::find_metric_idx("disk.num_blocks_cache_hits");
+    indices_[kPeersConnected] = lt::find_metric_idx("peer.num_peers_connected");
+    indices_[kDhtNodes] = lt::find_metric_idx("dht.dht_nodes");
+}
+
+int64_t session_stats_collector_t::value(const lt::span<const int64_t> counters, const metric_t metric) const {
+    const int index = indices_[metric];
+    if (index < 0 || static_cast<size_t>(index) >= counters.size()) {
+        return 0;
+    }
+    return counters[index];
+}
+
+void session_stats_collector_t::update(const lt::session_stats_alert &alert, session_stats_t &stats) {
+    function_printer_t _fp("session_stats_collector_t::update");
+    const auto counters = alert.counters();
+    std::array<int64_t, kMetricCount> current{};
+    for (int i = 0; i < kMetricCount; ++i) {
+        current[i] = value(counters, static_cast<metric_t>(i));
+    }
+    const auto now = alert.timestamp();
+
+    stats.total_downloaded_bytes = current[kRecvPayloadBytes];
+    stats.total_uploaded_bytes = current[kSentPayloadBytes];
+    stats.total_download_bytes = current[kRecvBytes] + current[kRecvIpOverheadBytes];
+    stats.total_upload_bytes = current[kSentBytes] + current[kSentIpOverheadBytes];
+    stats.total_wasted_bytes = current[kRecvRedundantBytes] + current[kRecvFailedBytes];
+    stats.disk_queue_depth = current[kQueuedDiskJobs];
+    stats.disk_queued_write_bytes = current[kQueuedWriteBytes];
+    stats.num_peers = current[kPeersConnected];
+    stats.dht_nodes = current[kDhtNodes];
+
+    if (has_previous_ && now > previous_time_) {
+        const auto delta = [&](const metric_t metric) { return current[metric] - previous_[metric]; };
+        const int64_t interval_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - previous_time_).count();
+        const auto rate = [&](const int64_t bytes) { return interval_ms > 0 ? bytes * 1000 / interval_ms : 0; };
+
+        stats.interval_ms = interval_ms;
+        stats.download_payload_rate = rate(delta(kRecvPayloadBytes));
+        stats.upload_payload_rate = rate(delta(kSentPayloadBytes));
+        stats.download_rate = rate(delta(kRecvBytes) + delta(kRecvIpOverheadBytes));
+        stats.upload_rate = rate(delta(kSentBytes) + delta(kSentIpOverheadBytes));
+        stats.wasted_bytes = delta(kRecvRedundantBytes) + delta(kRecvFailedBytes);
+        stats.blocks_read = delta(kBlocksRead);
+        stats.blocks_cache_hits = delta(kBlocksCacheHits);
+    }
+
+    previous_ = current;
+    previous_time_ = now;
+    has_previous_ = true;
+}
+} // namespace anilt
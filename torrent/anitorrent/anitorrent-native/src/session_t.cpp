@@ -90,7 +90,8 @@ static std::vector<char> load_file_to_vector(const std::string &filePath) {
 #define START_LOG(log) (void *) 0
 #endif
 
-static void apply_settings_to_pack(libtorrent::settings_pack &s, const session_settings_t &settings) {
+static void apply_settings_to_pack(libtorrent::settings_pack &s, const session_settings_t &settings,
+                                   const lt::alert_category_t alert_mask) {
     using libtorrent::settings_pack;
 
     s.set_bool(settings_pack::enable_dht,
@@ -126,7 +127,6 @@ static void apply_settings_to_pack(libtorrent::settings_pack &s, const session_s
     s.set_str(settings_pack::user_agent, settings.user_agent);
     s.set_str(settings_pack::peer_fingerprint, settings.peer_fingerprint);
     s.set_str(settings_pack::handshake_client_version, settings.handshake_client_version);
-    s.set_int(settings_pack::alert_queue_size, 10000);
 
     // seeding
     s.set_int(settings_pack::max_allowed_in_request_queue, 100);
@@ -149,11 +149,15 @@ static void apply_settings_to_pack(libtorrent::settings_pack &s, const session_s
     }
     START_LOG("set dht_bootstrap_nodes_extra ok");
 
-    s.set_int(settings_pack::alert_mask,
-              libtorrent::alert_category::status | libtorrent::alert_category::piece_progress |
-              libtorrent::alert_category::block_progress |
-              libtorrent::alert_category::file_progress |
-              libtorrent::alert_category::upload);
+    s.set_int(settings_pack::alert_mask, alert_mask);
+}
+
+session_t::~session_t() {
+    // Its connections wait for pieces delivered by the alert pump
+    stop_http_server();
+    stop_alert_pump();
+    // Writes the pending resume data before returning
+    resume_writer_.reset();
 }
 
 void session_t::start(const session_settings_t &settings) {
@@ -169,11 +173,24 @@ void session_t::start(const session_settings_t &settings) {
     settings_pack s{};
     START_LOG("Pack initialied");
 
-    apply_settings_to_pack(s, settings);
+    dispatcher_ = std::make_shared<alert_dispatcher_t>();
+    resume_writer_ = std::make_shared<resume_data_writer_t>([this] {
+        if (const auto listener = new_event_listener_.load(std::memory_order_acquire)) {
+            listener->on_new_events();
+        }
+    });
+    // Keeps subscriptions made before the session started
+    alert_mask_ = dispatcher_->alert_mask_for(subscribed_events_.load(std::memory_order_relaxed) |
+                                              torrent_listeners_->subscribed_events());
+    apply_settings_to_pack(s, settings, alert_mask_);
+    dispatcher_->set_alert_queue_bounds(settings.alert_queue_size_min, settings.alert_queue_size_max);
+    dispatcher_->torrents().set_piece_cache_capacity(settings.piece_cache_size);
+    s.set_int(settings_pack::alert_queue_size, dispatcher_->alert_queue_size());
 
     START_LOG("create session");
 
     session_ = std::make_shared<libtorrent::session>(s);
+    dispatcher_->attach(session_);
     
     // peer connection filter
     session_->add_extension([this](lt::torrent_handle const& handle, lt::client_data_t) -> std::shared_ptr<lt::torrent_plugin> {
@@ -183,6 +200,12 @@ void session_t::start(const session_settings_t &settings) {
         });
     });
     
+    // streaming endgame, see torrent_handle_t::set_peer_endgame
+    session_->add_extension([dispatcher = dispatcher_](lt::torrent_handle const &handle, lt::client_data_t)
+                                -> std::shared_ptr<lt::torrent_plugin> {
+        return std::make_shared<plugin::streaming_torrent_plugin>(dispatcher->torrents().attach(handle)->endgame());
+    });
+
     START_LOG("session created");
 }
 
@@ -192,7 +215,8 @@ void session_t::apply_settings(const session_settings_t &settings) {
     
     using libtorrent::settings_pack;
     settings_pack s = session_->get_settings();
-    apply_settings_to_pack(s, settings);
+    apply_settings_to_pack(s, settings, alert_mask_);
+    dispatcher_->torrents().set_piece_cache_capacity(settings.piece_cache_size);
 }
 
 void session_t::resume() const {
@@ -285,6 +309,7 @@ bool session_t::start_download(torrent_handle_t &handle, const torrent_add_info_
 
     handle.id = torrent_handle.id();
     handle.handle_ = std::make_shared<libtorrent::torrent_handle>(torrent_handle);
+    handle.context_ = dispatcher_->torrents().attach(torrent_handle);
     return true;
 }
 
@@ -301,12 +326,29 @@ bool session_t::set_new_event_listener(new_event_listener_t *listener) const {
     function_printer_t _fp("session_t::set_new_event_listener");
     guard_global_lock;
     if (const auto session = session_; session && session->is_valid() && listener) {
-        session->set_alert_notify([this, listener] { listener->on_new_events(); });
+        alert_notify_listener_ = listener;
+        if (const auto alert_pump = pump(); alert_pump && alert_pump->running()) {
+            // Installed again by stop_alert_pump
+            return true;
+        }
+        install_alert_notify(*session, listener);
         return true;
     }
     return false;
 }
 
+void session_t::install_alert_notify(lt::session &session, new_event_listener_t *listener) const {
+    if (!listener) {
+        session.set_alert_notify({});
+    } else {
+        session.set_alert_notify([dispatcher = dispatcher_, listener] {
+            dispatcher->latency().on_notified();
+            listener->on_new_events();
+        });
+    }
+    new_event_listener_.store(listener, std::memory_order_release);
+}
+
 #if ENABLE_TRACE_LOGGING
 static std::ofstream alerts_log("alerts.log", std::ios::app);
 #define ALERTS_LOG(log) alerts_log << log
@@ -317,6 +359,11 @@ static std::ofstream alerts_log("alerts.log", std::ios::app);
 void session_t::process_events(event_listener_t *listener) const {
     function_printer_t _fp("session_t::process_events");
     guard_global_lock;
+    const auto alert_pump = pump();
+    if (alert_pump && alert_pump->running()) {
+        // Alerts are popped by the pump thread
+        return;
+    }
     if (const auto session = session_; session && session->is_valid() && listener) {
         ALERTS_LOG("Alerts processing... " << std::flush);
         ALERTS_LOG("listener: " << listener << std::flush);
@@ -327,30 +374,200 @@ void session_t::process_events(event_listener_t *listener) const {
         if (session->is_valid()) {
             ALERTS_LOG("Pop alerts" << std::flush);
             session->pop_alerts(&alerts);
+            dispatcher_->latency().on_popped(alerts);
         } else {
             ALERTS_LOG("session invalid" << std::flush);
             return;
         }
         ALERTS_LOG("Poped " << std::flush);
-        for (lt::alert *alert: alerts) {
-            if (alert) {
-                ALERTS_LOG("call " << alert->what() << ".." << std::flush);
-                call_listener(alert, *session, *listener);
-                ALERTS_LOG("ok " << std::flush);
-            }
+        if (last_listener_.exchange(listener, std::memory_order_relaxed) != listener) {
+            dispatcher_->reset_status_updates();
         }
+        listener_router_t router = make_router(*listener);
+        if (alert_pump) {
+            // Events queued before stop_alert_pump come before the alerts popped since
+            alert_pump->drain(router, SIZE_MAX);
+            release_stopped_pump(alert_pump);
+        }
+        dispatcher_->dispatch_all(alerts, router, coalesce_piece_progress_.load(std::memory_order_relaxed));
+        resume_writer_->deliver_completions(router);
+        dispatcher_->latency().on_delivered(alerts);
         ALERTS_LOG("done" << std::endl << std::flush);
     }
 }
 
+size_t session_t::process_events_batched(event_buffer_t *buffer) const {
+    function_printer_t _fp("session_t::process_events_batched");
+    if (!buffer) {
+        return 0;
+    }
+    process_events(buffer);
+    return buffer->remaining();
+}
+
 void session_t::remove_listener() const {
     function_printer_t _fp("session_t::remove_listener");
     guard_global_lock;
+    alert_notify_listener_ = nullptr;
+    new_event_listener_.store(nullptr, std::memory_order_release);
     if (const auto session = session_; session && session->is_valid()) {
         session->set_alert_notify({});
     }
 }
 
+void session_t::set_torrent_listener(const handle_id_t handle_id, event_listener_t *listener) const {
+    function_printer_t _fp("session_t::set_torrent_listener");
+    torrent_listeners_->set(handle_id, listener);
+    update_subscriptions();
+}
+
+void session_t::set_drop_unrouted_events(const bool enabled) const {
+    function_printer_t _fp("session_t::set_drop_unrouted_events");
+    drop_unrouted_events_.store(enabled, std::memory_order_relaxed);
+}
+
+listener_router_t session_t::make_router(event_listener_t &fallback) const {
+    return listener_router_t(torrent_listeners_, fallback, drop_unrouted_events_.load(std::memory_order_relaxed));
+}
+
+std::shared_ptr<alert_pump_t> session_t::pump() const {
+    std::lock_guard _(alert_pump_lock_);
+    return alert_pump_;
+}
+
+void session_t::release_stopped_pump(const std::shared_ptr<alert_pump_t> &alert_pump) const {
+    std::lock_guard _(alert_pump_lock_);
+    if (alert_pump_ == alert_pump && !alert_pump->running() && !alert_pump->has_events()) {
+        alert_pump_.reset();
+    }
+}
+
+void session_t::subscribe(const event_listener_t *listener) {
+    function_printer_t _fp("session_t::subscribe");
+    guard_global_lock;
+    if (!listener) {
+        return;
+    }
+    subscribed_events_.store(listener->subscribed_events, std::memory_order_relaxed);
+    update_subscriptions();
+}
+
+void session_t::update_subscriptions() const {
+    std::lock_guard _(subscriptions_lock_);
+    const uint32_t events =
+        subscribed_events_.load(std::memory_order_relaxed) | torrent_listeners_->subscribed_events();
+    if (const auto alert_pump = pump()) {
+        alert_pump->set_subscribed_events(events);
+    }
+    // Not started yet, `start` applies the subscriptions
+    const auto dispatcher = dispatcher_;
+    if (!dispatcher) {
+        return;
+    }
+    dispatcher->reset_status_updates();
+    const auto session = session_;
+    const auto mask = dispatcher->alert_mask_for(events);
+    if (!session || !session->is_valid() || mask == alert_mask_) {
+        return;
+    }
+    alert_mask_ = mask;
+    lt::settings_pack pack;
+    pack.set_int(lt::settings_pack::alert_mask, alert_mask_);
+    session->apply_settings(std::move(pack));
+}
+
+void session_t::set_coalesce_piece_progress(const bool enabled) {
+    function_printer_t _fp("session_t::set_coalesce_piece_progress");
+    guard_global_lock;
+    coalesce_piece_progress_.store(enabled, std::memory_order_relaxed);
+    if (const auto alert_pump = pump()) {
+        alert_pump->set_coalesce_piece_progress(enabled);
+    }
+}
+
+bool session_t::start_alert_pump(new_event_listener_t *listener, const int capacity) {
+    function_printer_t _fp("session_t::start_alert_pump");
+    guard_global_lock;
+    const auto session = session_;
+    if (!session || !session->is_valid() || capacity <= 0) {
+        return false;
+    }
+    std::shared_ptr<alert_pump_t> alert_pump;
+    {
+        std::lock_guard _(alert_pump_lock_);
+        if (alert_pump_ && alert_pump_->running()) {
+            return true;
+        }
+        // A pump stopped before its events were delivered is started again, so that they stay first
+        if (!alert_pump_) {
+            alert_pump_ = std::make_shared<alert_pump_t>(session, dispatcher_, static_cast<size_t>(capacity));
+            alert_pump_->set_coalesce_piece_progress(coalesce_piece_progress_.load(std::memory_order_relaxed));
+        }
+        alert_pump = alert_pump_;
+    }
+    // Only one thread may pop alerts, the pump wakes itself up with wait_for_alert
+    session->set_alert_notify({});
+    new_event_listener_.store(listener, std::memory_order_release);
+    update_subscriptions();
+    {
+        // drain_events releases a stopped pump once it is empty
+        std::lock_guard _(alert_pump_lock_);
+        alert_pump_ = alert_pump;
+        alert_pump->start(listener);
+    }
+    return true;
+}
+
+void session_t::stop_alert_pump() {
+    function_printer_t _fp("session_t::stop_alert_pump");
+    guard_global_lock;
+    std::shared_ptr<alert_pump_t> alert_pump;
+    {
+        std::lock_guard _(alert_pump_lock_);
+        alert_pump = std::move(alert_pump_);
+    }
+    if (!alert_pump) {
+        return;
+    }
+    alert_pump->stop();
+    if (alert_pump->has_events()) {
+        // Delivered by the next process_events or drain_events
+        std::lock_guard _(alert_pump_lock_);
+        alert_pump_ = alert_pump;
+    }
+    // process_events pops alerts again
+    if (const auto session = session_; session && session->is_valid()) {
+        install_alert_notify(*session, alert_notify_listener_);
+        if (alert_notify_listener_ && alert_pump->has_events()) {
+            alert_notify_listener_->on_new_events();
+        }
+    }
+}
+
+int session_t::drain_events(event_listener_t *listener) const {
+    function_printer_t _fp("session_t::drain_events");
+    if (const auto alert_pump = pump(); alert_pump && listener) {
+        if (last_listener_.exchange(listener, std::memory_order_relaxed) != listener) {
+            dispatcher_->reset_status_updates();
+        }
+        listener_router_t router = make_router(*listener);
+        const auto count = static_cast<int>(alert_pump->drain(router, SIZE_MAX));
+        release_stopped_pump(alert_pump);
+        resume_writer_->deliver_completions(router);
+        return count;
+    }
+    return 0;
+}
+
+size_t session_t::drain_events_batched(event_buffer_t *buffer) const {
+    function_printer_t _fp("session_t::drain_events_batched");
+    if (!buffer) {
+        return 0;
+    }
+    drain_events(buffer);
+    return buffer->remaining();
+}
+
 void session_t::set_peer_filter(peer_filter_t *filter) {
     function_printer_t _fp("session_t::set_peer_filter");
     guard_global_lock;
@@ -364,6 +581,15 @@ void session_t::wait_for_alert(const int timeout_seconds) const {
         session->wait_for_alert(std::chrono::seconds(timeout_seconds));
     }
 }
+void session_t::post_torrent_updates() const {
+    function_printer_t _fp("session_t::post_torrent_updates");
+    guard_global_lock;
+    if (const auto session = session_; session && session->is_valid()) {
+        // Only the basic fields are used by torrent_stats_t, skip the expensive queries
+        session->post_torrent_updates(lt::status_flags_t{});
+    }
+}
+
 void session_t::post_session_stats() const {
     function_printer_t _fp("session_t::post_session_stats");
     guard_global_lock;
@@ -372,4 +598,93 @@ void session_t::post_session_stats() const {
     }
 }
 
+void session_t::release_piece_state_buffer(const handle_id_t handle_id) const {
+    function_printer_t _fp("session_t::release_piece_state_buffer");
+    if (const auto dispatcher = dispatcher_) {
+        dispatcher->torrents().release_piece_states(handle_id);
+    }
+}
+
+void session_t::set_latency_tracking(const bool enabled) const {
+    function_printer_t _fp("session_t::set_latency_tracking");
+    if (const auto dispatcher = dispatcher_) {
+        dispatcher->latency().set_enabled(enabled);
+    }
+}
+
+latency_summary_t session_t::latency_summary(const int stage, const int alert_type) const {
+    function_printer_t _fp("session_t::latency_summary");
+    if (const auto dispatcher = dispatcher_) {
+        return dispatcher->latency().summary(static_cast<latency_stage_t>(stage), alert_type);
+    }
+    return {};
+}
+
+void session_t::reset_latency_stats() const {
+    function_printer_t _fp("session_t::reset_latency_stats");
+    if (const auto dispatcher = dispatcher_) {
+        dispatcher->latency().reset();
+    }
+}
+
+int session_t::alert_queue_size() const {
+    function_printer_t _fp("session_t::alert_queue_size");
+    if (const auto dispatcher = dispatcher_) {
+        return dispatcher->alert_queue_size();
+    }
+    return 0;
+}
+
+bool session_t::save_resume_data(const handle_id_t handle_id, torrent_resume_data_t &data,
+                                 const std::string &path) const {
+    function_printer_t _fp("session_t::save_resume_data");
+    const auto writer = resume_writer_;
+    if (!writer || path.empty()) {
+        return false;
+    }
+    writer->enqueue(handle_id, std::move(data.data_), path);
+    data.data_.clear();
+    return true;
+}
+
+bool session_t::flush_resume_data(const int timeout_millis) const {
+    function_printer_t _fp("session_t::flush_resume_data");
+    if (const auto writer = resume_writer_) {
+        return writer->flush(std::chrono::milliseconds(timeout_millis));
+    }
+    return true;
+}
+
+void session_t::set_resume_data_fsync(const bool enabled) const {
+    function_printer_t _fp("session_t::set_resume_data_fsync");
+    if (const auto writer = resume_writer_) {
+        writer->set_fsync(enabled);
+    }
+}
+
+int session_t::start_http_server(const int port, const int read_timeout_millis) {
+    function_printer_t _fp("session_t::start_http_server");
+    if (!dispatcher_) {
+        return -1;
+    }
+    if (!http_server_) {
+        http_server_ = std::make_shared<http_server_t>(
+            [dispatcher = dispatcher_](const handle_id_t handle_id) { return dispatcher->torrents().find(handle_id); });
+    }
+    return http_server_->start(port, read_timeout_millis);
+}
+
+void session_t::stop_http_server() {
+    function_printer_t _fp("session_t::stop_http_server");
+    if (const auto server = http_server_) {
+        server->stop();
+    }
+}
+
+int session_t::http_server_port() const {
+    if (const auto server = http_server_) {
+        return server->port();
+    }
+    return -1;
+}
 } // namespace anilt
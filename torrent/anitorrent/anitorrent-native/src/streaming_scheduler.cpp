@@ -0,0 +1,276 @@
+#include "streaming_scheduler.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "global_lock.h"
+#include "libtorrent/torrent_info.hpp"
+#include "libtorrent/torrent_status.hpp"
+#include "piece_deadlines.hpp"
+
+namespace anilt {
+streaming_scheduler_t::streaming_scheduler_t(lt::torrent_handle handle, const streaming_config_t &config,
+                                             std::shared_ptr<plugin::endgame_state_t> endgame) :
+    handle_(std::move(handle)), config_(config), endgame_(std::move(endgame)) {
+    const auto ti = handle_.torrent_file();
+    if (!ti || config.file_index < 0 || config.file_index >= ti->num_files() || config.window_size <= 0) {
+        return;
+    }
+    const auto &files = ti->files();
+    const lt::file_index_t file(config.file_index);
+    file_begin_ = files.file_offset(file);
+    file_end_ = file_begin_ + files.file_size(file);
+    piece_length_ = ti->piece_length();
+    if (file_end_ <= file_begin_) {
+        return;
+    }
+    const int64_t file_begin = file_begin_;
+    const int64_t file_end = file_end_;
+
+    first_piece_ = piece_at(file_begin);
+    last_piece_ = piece_at(file_end - 1);
+    for (int piece = first_piece_; piece <= piece_at(file_begin + config.header_size - 1); ++piece) {
+        header_pieces_.push_back(piece);
+    }
+    const int first_footer = piece_at(file_end - config.footer_size);
+    for (int piece = first_footer; piece <= last_piece_; ++piece) {
+        footer_pieces_.push_back(piece);
+    }
+    last_index_ = first_footer - 1;
+    possible_footer_first_ = piece_at(file_end - config.possible_footer_size);
+    possible_footer_last_ = last_piece_;
+
+    const auto status = handle_.status(lt::torrent_handle::query_pieces);
+    finished_.resize(ti->num_pieces());
+    for (int piece = 0; piece < ti->num_pieces() && piece < status.pieces.size(); ++piece) {
+        finished_[piece] = status.pieces[lt::piece_index_t(piece)];
+    }
+}
+
+int streaming_scheduler_t::piece_at(const int64_t offset) const {
+    return static_cast<int>(std::clamp(offset, file_begin_, file_end_ - 1) / piece_length_);
+}
+
+void streaming_scheduler_t::use_media_index(const media_index_t &index) {
+    if (!valid() || index.metadata_ranges().empty()) {
+        return;
+    }
+    std::lock_guard _(lock_);
+    header_pieces_.clear();
+    footer_pieces_.clear();
+    const int middle = first_piece_ + (last_piece_ - first_piece_) / 2;
+    for (const auto &range: index.metadata_ranges()) {
+        const int last = piece_at(file_begin_ + range.offset + range.size - 1);
+        for (int piece = piece_at(file_begin_ + range.offset); piece <= last; ++piece) {
+            auto &pieces = piece <= middle ? header_pieces_ : footer_pieces_;
+            if (std::find(pieces.begin(), pieces.end(), piece) == pieces.end()) {
+                pieces.push_back(piece);
+            }
+        }
+    }
+    if (footer_pieces_.empty()) {
+        last_index_ = last_piece_;
+    } else {
+        last_index_ = footer_pieces_.front() - 1;
+        possible_footer_first_ = std::min(possible_footer_first_, footer_pieces_.front());
+    }
+}
+
+bool streaming_scheduler_t::in_possible_footer(const int piece_index) const {
+    return piece_index >= possible_footer_first_ && piece_index <= possible_footer_last_;
+}
+
+void streaming_scheduler_t::seek(int piece_index) {
+    function_printer_t _fp("streaming_scheduler_t::seek");
+    if (!valid()) {
+        return;
+    }
+    piece_index = std::clamp(piece_index, first_piece_, last_piece_);
+    std::lock_guard _(lock_);
+    if (in_possible_footer(piece_index)) {
+        // Players seek to the footer to read metadata, keep the window where it is
+        if (std::find(downloading_.begin(), downloading_.end(), piece_index) == downloading_.end()) {
+            downloading_.insert(downloading_.begin(), piece_index);
+        }
+        apply_deadlines();
+        return;
+    }
+    // Only the deadlines of this window are dropped, those set by reads and torrent_handle_t are kept
+    const auto previous = std::move(downloading_);
+    downloading_.clear();
+    window_start_ = piece_index;
+    window_end_ = piece_index - 1;
+    fill_window(piece_index);
+    reset_piece_deadlines(handle_, pieces_not_in(previous, downloading_), endgame_.get());
+    apply_deadlines();
+}
+
+void streaming_scheduler_t::stop() {
+    function_printer_t _fp("streaming_scheduler_t::stop");
+    std::lock_guard _(lock_);
+    reset_piece_deadlines(handle_, downloading_, endgame_.get());
+    downloading_.clear();
+    window_end_ = -1;
+}
+
+void streaming_scheduler_t::fill_window(const int piece_index) {
+    // Unlike a fixed index range, finished pieces are skipped so that the window never waits for them
+    for (int piece = piece_index; piece <= last_index_ && static_cast<int>(downloading_.size()) < config_.window_size;
+         ++piece) {
+        if (!finished_[piece]) {
+            downloading_.push_back(piece);
+        }
+        window_end_ = piece;
+    }
+    if (piece_index - first_piece_ <= 1) {
+        // Playback is starting, the player needs the metadata at both ends of the file
+        const auto add_unfinished = [this](const std::vector<int> &pieces) {
+            for (const int piece: pieces) {
+                if (!finished_[piece] &&
+                    std::find(downloading_.begin(), downloading_.end(), piece) == downloading_.end()) {
+                    downloading_.push_back(piece);
+                }
+            }
+        };
+        add_unfinished(header_pieces_);
+        add_unfinished(footer_pieces_);
+    }
+}
+
+int streaming_scheduler_t::find_next_downloading_piece(const int start) const {
+    for (int piece = std::max(start + 1, first_piece_); piece <= last_index_; ++piece) {
+        if (!finished_[piece]) {
+            return piece;
+        }
+    }
+    return start;
+}
+
+void streaming_scheduler_t::on_piece_finished(const int piece_index) {
+    if (!valid() || piece_index < 0 || piece_index >= static_cast<int>(finished_.size())) {
+        return;
+    }
+    std::lock_guard _(lock_);
+    finished_[piece_index] = true;
+    const auto it = std::find(downloading_.begin(), downloading_.end(), piece_index);
+    if (it == downloading_.end()) {
+        return;
+    }
+    downloading_.erase(it);
+
+    // Header, footer and possible footer pieces are requested on top of the window, it keeps its size without them
+    if (piece_index < window_start_ || piece_index > window_end_) {
+        apply_deadlines();
+        return;
+    }
+    if (const int new_end = find_next_downloading_piece(window_end_); new_end != window_end_) {
+        downloading_.push_back(new_end);
+        window_end_ = new_end;
+    }
+    apply_deadlines();
+}
+
+void streaming_scheduler_t::sync_finished(const std::vector<bool> &finished) {
+    function_printer_t _fp("streaming_scheduler_t::sync_finished");
+    if (!valid() || finished.size() != finished_.size()) {
+        return;
+    }
+    std::lock_guard _(lock_);
+    finished_ = finished;
+    if (window_end_ < 0) {
+        // Stopped or not started yet
+        return;
+    }
+    const auto previous = std::move(downloading_);
+    downloading_.clear();
+    window_end_ = window_start_ - 1;
+    fill_window(window_start_);
+    reset_piece_deadlines(handle_, pieces_not_in(previous, downloading_), endgame_.get());
+    apply_deadlines();
+}
+
+void streaming_scheduler_t::update_playback(const int64_t position, const int64_t bytes_per_second,
+                                            const float speed) {
+    function_printer_t _fp("streaming_scheduler_t::update_playback");
+    if (!valid()) {
+        return;
+    }
+    std::lock_guard _(lock_);
+    playback_position_ = std::clamp<int64_t>(position, 0, file_end_ - file_begin_);
+    playback_bytes_per_second_ = std::max<int64_t>(bytes_per_second, 0);
+    playback_speed_ = speed > 0 ? speed : 1;
+    playback_updated_ = std::chrono::steady_clock::now();
+    apply_deadlines();
+}
+
+int streaming_scheduler_t::piece_of(const int64_t position) const {
+    return valid() ? piece_at(file_begin_ + position) : -1;
+}
+
+int streaming_scheduler_t::playback_deadline(const int piece, const std::chrono::steady_clock::time_point now) const {
+    const double bytes_per_second = static_cast<double>(playback_bytes_per_second_) * playback_speed_;
+    const double elapsed = std::chrono::duration<double>(now - playback_updated_).count();
+    const double position = static_cast<double>(file_begin_ + playback_position_) + elapsed * bytes_per_second;
+    const double ahead = static_cast<double>(std::max(file_begin_, piece * piece_length_)) - position;
+    if (ahead <= 0) {
+        return config_.first_deadline_millis;
+    }
+    const double millis = ahead * 1000 / bytes_per_second - config_.safety_margin_millis;
+    return static_cast<int>(std::clamp<double>(millis, config_.first_deadline_millis, 24 * 3600 * 1000));
+}
+
+bool streaming_scheduler_t::is_downloading(const int piece_index) const {
+    std::lock_guard _(lock_);
+    return std::find(downloading_.begin(), downloading_.end(), piece_index) != downloading_.end();
+}
+
+bool streaming_scheduler_t::in_window(const int piece_index) const {
+    std::lock_guard _(lock_);
+    return (piece_index >= window_start_ && piece_index <= window_end_) ||
+           std::find(downloading_.begin(), downloading_.end(), piece_index) != downloading_.end();
+}
+
+int streaming_scheduler_t::buffered_pieces(const int piece_index) const {
+    if (!valid() || piece_index < first_piece_ || piece_index > last_piece_) {
+        return 0;
+    }
+    std::lock_guard _(lock_);
+    for (int piece = piece_index; piece <= last_piece_; ++piece) {
+        if (!finished_[piece]) {
+            return piece - piece_index;
+        }
+    }
+    return std::numeric_limits<int>::max();
+}
+
+void streaming_scheduler_t::apply_deadlines() const {
+    if (downloading_.empty()) {
+        return;
+    }
+    const int smallest = *std::min_element(downloading_.begin(), downloading_.end());
+    const bool by_bitrate = playback_bytes_per_second_ > 0;
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::pair<int, int>> deadlines;
+    deadlines.reserve(downloading_.size());
+    for (size_t i = 0; i < downloading_.size(); ++i) {
+        const int piece = downloading_[i];
+        int deadline;
+        if (by_bitrate) {
+            // Metadata is read before playback gets there, like the first piece
+            const bool metadata = in_possible_footer(piece) ||
+                std::find(header_pieces_.begin(), header_pieces_.end(), piece) != header_pieces_.end();
+            deadline = metadata ? config_.first_deadline_millis : playback_deadline(piece, now);
+        } else if (i == 0) {
+            // The first piece (possibly just seeked to) is the most urgent, otherwise libtorrent keeps requesting
+            // the following ones as the window grows
+            deadline = config_.first_deadline_millis;
+        } else if (in_possible_footer(piece)) {
+            deadline = config_.deadline_base_millis + (possible_footer_last_ - piece) * config_.deadline_step_millis;
+        } else {
+            deadline = config_.deadline_base_millis + (piece - smallest) * config_.deadline_step_millis;
+        }
+        deadlines.emplace_back(piece, deadline);
+    }
+    set_piece_deadlines(handle_, deadlines, endgame_.get());
+}
+} // namespace anilt
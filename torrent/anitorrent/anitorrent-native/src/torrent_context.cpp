@@ -0,0 +1,504 @@
+#include "torrent_context.hpp"
+
+#include <utility>
+
+#include "global_lock.h"
+#include "libtorrent/torrent_status.hpp"
+
+namespace anilt {
+// Download queue queries of refresh_downloading
+static constexpr auto kDownloadingRefreshInterval = std::chrono::seconds(1);
+
+std::shared_ptr<torrent_context_t::piece_request_t> torrent_context_t::request_piece(const int piece,
+                                                                                  const int deadline_ms) {
+    function_printer_t _fp("torrent_context_t::request_piece");
+    std::shared_ptr<piece_request_t> request;
+    {
+        std::lock_guard _(lock_);
+        if (const auto it = pending_reads_.find(piece); it != pending_reads_.end()) {
+            return it->second;
+        }
+        request = std::shared_ptr<piece_request_t>(new piece_request_t(piece));
+        if (closed_) {
+            request->done_ = true;
+            request->data_.failed = true;
+            return request;
+        }
+        if (cache_.find(piece, request->data_.buffer, request->data_.size)) {
+            request->done_ = true;
+            return request;
+        }
+        pending_reads_.emplace(piece, request);
+    }
+
+    // Registered before asking libtorrent, so that on_piece_finished reads the piece if it finishes from now on.
+    // The deadline has no alert_when_available: on_piece_finished is the only other read, so each piece is read once.
+    const lt::piece_index_t index(piece);
+    if (handle_.have_piece(index)) {
+        if (issue_read(request)) {
+            handle_.read_piece(index);
+        }
+    } else {
+        handle_.set_piece_deadline(index, deadline_ms);
+        handle_.piece_priority(index, lt::default_priority);
+        endgame_->set_deadline(piece, deadline_ms);
+    }
+    return request;
+}
+
+bool torrent_context_t::wait_piece(const std::shared_ptr<piece_request_t> &request,
+                                   const std::chrono::steady_clock::time_point until, piece_data_t &out,
+                                   const bool keep_on_timeout) {
+    std::unique_lock lock(lock_);
+    if (!piece_done_.wait_until(lock, until, [&request] { return request->done_; })) {
+        // Forget the request if nobody else waits for it, so that the next read asks libtorrent again
+        if (const auto it = pending_reads_.find(request->piece());
+            !keep_on_timeout && it != pending_reads_.end() && it->second == request && request.use_count() <= 2) {
+            pending_reads_.erase(it);
+        }
+        return false;
+    }
+    out = request->data_;
+    return !out.failed;
+}
+
+bool torrent_context_t::issue_read(const std::shared_ptr<piece_request_t> &request) {
+    std::lock_guard _(lock_);
+    return !request->done_ && !std::exchange(request->read_issued_, true);
+}
+
+void torrent_context_t::retry_pending_reads() {
+    function_printer_t _fp("torrent_context_t::retry_pending_reads");
+    std::vector<int> pieces;
+    {
+        std::lock_guard _(lock_);
+        for (const auto &[piece, request]: pending_reads_) {
+            if (request->read_issued_) {
+                pieces.push_back(piece);
+            }
+        }
+    }
+    // A read_piece_alert that was not lost after all completes the request, the other one is then ignored
+    for (const int piece: pieces) {
+        handle_.read_piece(lt::piece_index_t(piece));
+    }
+}
+
+void torrent_context_t::read_finished_pending(const std::vector<uint8_t> &states) {
+    std::vector<int> pieces;
+    {
+        std::lock_guard _(lock_);
+        for (const auto &[piece, request]: pending_reads_) {
+            if (!request->read_issued_ && piece < static_cast<int>(states.size()) &&
+                states[piece] == piece_state_map_t::kPieceFinished) {
+                request->read_issued_ = true;
+                pieces.push_back(piece);
+            }
+        }
+    }
+    for (const int piece: pieces) {
+        handle_.read_piece(lt::piece_index_t(piece));
+    }
+}
+
+void torrent_context_t::complete(const std::shared_ptr<piece_request_t> &request, piece_data_t &&data) {
+    request->done_ = true;
+    request->data_ = std::move(data);
+}
+
+void torrent_context_t::on_read_piece(const lt::read_piece_alert &alert) {
+    if (recheck_.on_read_piece(alert)) {
+        return;
+    }
+    complete_read(static_cast<int>(alert.piece), !alert.error, alert.buffer, alert.size);
+}
+
+void torrent_context_t::complete_read(const int piece, const bool ok, const boost::shared_array<char> &buffer,
+                                      const int size) {
+    {
+        std::lock_guard _(lock_);
+        // Only reads requested by a reader are cached: recheck reads and duplicate alerts would evict pieces
+        // around the playhead
+        const auto it = pending_reads_.find(piece);
+        if (it == pending_reads_.end()) {
+            return;
+        }
+        piece_data_t data;
+        // Data read from a modified file must not be cached nor returned
+        if (!ok) {
+            data.failed = true;
+        } else {
+            data.buffer = buffer;
+            data.size = size;
+            cache_.insert(piece, buffer, size);
+        }
+        complete(it->second, std::move(data));
+        pending_reads_.erase(it);
+    }
+    piece_done_.notify_all();
+}
+
+static std::vector<uint8_t> finished_piece_states(const lt::torrent_status &status) {
+    std::vector<uint8_t> states(status.pieces.size(), piece_state_map_t::kPieceNone);
+    for (int piece = 0; piece < status.pieces.size(); ++piece) {
+        if (status.pieces[lt::piece_index_t(piece)]) {
+            states[piece] = piece_state_map_t::kPieceFinished;
+        }
+    }
+    return states;
+}
+
+static void mark_downloading(std::vector<uint8_t> &states, const std::vector<lt::partial_piece_info> &queue) {
+    for (const auto &partial: queue) {
+        if (const auto piece = static_cast<size_t>(static_cast<int>(partial.piece_index)); piece < states.size()) {
+            states[piece] = piece_state_map_t::kPieceDownloading;
+        }
+    }
+}
+
+std::vector<uint8_t> torrent_context_t::current_piece_states() const {
+    const lt::torrent_status status = handle_.status(lt::torrent_handle::query_pieces);
+    if (!status.has_metadata) {
+        return {};
+    }
+    auto states = finished_piece_states(status);
+    std::vector<lt::partial_piece_info> queue;
+    handle_.get_download_queue(queue);
+    mark_downloading(states, queue);
+    return states;
+}
+
+std::shared_ptr<piece_state_map_t> torrent_context_t::piece_states() {
+    function_printer_t _fp("torrent_context_t::piece_states");
+    if (piece_states_->initialized()) {
+        return piece_states_;
+    }
+    const auto states = current_piece_states();
+    if (states.empty()) {
+        return nullptr;
+    }
+    if (piece_states_->init(states)) {
+        for (const int piece: endgame_->deadline_pieces()) {
+            piece_states_->set_deadline(piece, true);
+        }
+    }
+    return piece_states_;
+}
+
+std::shared_ptr<piece_state_map_t> torrent_context_t::export_piece_states() {
+    auto states = piece_states();
+    if (states) {
+        piece_states_exported_.store(true, std::memory_order_relaxed);
+    }
+    return states;
+}
+
+std::shared_ptr<piece_state_map_t> torrent_context_t::exported_piece_states() const {
+    return piece_states_exported_.load(std::memory_order_relaxed) ? piece_states_ : nullptr;
+}
+
+void torrent_context_t::request_piece_resync(const bool report) {
+    function_printer_t _fp("torrent_context_t::request_piece_resync");
+    resync_report_ = resync_report_ || report;
+    // A download queue refresh in flight does not answer a resync, its piece_info_alert is ignored
+    if (resync_step_ != resync_step_t::kIdle && resync_step_ != resync_step_t::kWaitingDownloadQueue) {
+        // Answered by the queries already in flight
+        return;
+    }
+    resync_step_ = resync_step_t::kWaitingStatus;
+    // Both are queued on the network thread, so their alerts arrive in this order
+    handle_.post_status(lt::torrent_handle::query_pieces);
+    handle_.post_download_queue();
+}
+
+void torrent_context_t::on_resync_status(const lt::torrent_status &status) {
+    if (resync_step_ != resync_step_t::kWaitingStatus) {
+        // Status updates are posted periodically, which keeps the downloading pieces fresh while none finishes
+        refresh_downloading(std::chrono::steady_clock::now());
+        return;
+    }
+    // Status updates without query_pieces (e.g. post_torrent_updates) have no piece bitfield
+    if (status.has_metadata && status.pieces.size() == 0) {
+        return;
+    }
+    resync_states_ = status.has_metadata ? finished_piece_states(status) : std::vector<uint8_t>{};
+    resync_step_ = resync_step_t::kWaitingQueue;
+}
+
+bool torrent_context_t::on_resync_queue(const std::vector<lt::partial_piece_info> &queue,
+                                        piece_progress_t &progress) {
+    if (resync_step_ == resync_step_t::kWaitingDownloadQueue) {
+        resync_step_ = resync_step_t::kIdle;
+        std::vector<int> downloading;
+        downloading.reserve(queue.size());
+        for (const auto &partial: queue) {
+            downloading.push_back(static_cast<int>(partial.piece_index));
+        }
+        piece_states_->sync_downloading(downloading);
+        return false;
+    }
+    if (resync_step_ != resync_step_t::kWaitingQueue) {
+        return false;
+    }
+    resync_step_ = resync_step_t::kIdle;
+    auto states = std::move(resync_states_);
+    const bool report = std::exchange(resync_report_, false);
+    if (std::exchange(resync_again_, false)) {
+        request_piece_resync(false);
+    }
+    if (states.empty()) {
+        return false;
+    }
+    // Requests whose piece_finished_alert was dropped
+    read_finished_pending(states);
+    mark_downloading(states, queue);
+    if (piece_states_->initialized()) {
+        piece_states_->sync(states);
+    }
+    if (const auto scheduler = this->scheduler()) {
+        std::vector<bool> finished(states.size());
+        for (size_t piece = 0; piece < states.size(); ++piece) {
+            finished[piece] = states[piece] == piece_state_map_t::kPieceFinished;
+        }
+        scheduler->sync_finished(finished);
+    }
+    if (!report) {
+        return false;
+    }
+    for (int piece = 0; piece < static_cast<int>(states.size()); ++piece) {
+        if (states[piece] == piece_state_map_t::kPieceFinished) {
+            progress.finished_pieces.push_back(piece);
+        } else if (states[piece] == piece_state_map_t::kPieceDownloading) {
+            progress.downloading_pieces.push_back(piece);
+        }
+    }
+    return true;
+}
+
+void torrent_context_t::on_torrent_checked() {
+    {
+        std::lock_guard _(lock_);
+        // Cached pieces may have failed the check
+        cache_.clear();
+    }
+    if (resync_step_ == resync_step_t::kWaitingStatus || resync_step_ == resync_step_t::kWaitingQueue) {
+        resync_again_ = true;
+    }
+    request_piece_resync(false);
+}
+
+void torrent_context_t::refresh_downloading(const std::chrono::steady_clock::time_point now) {
+    if (resync_step_ != resync_step_t::kIdle || !piece_states_->initialized() ||
+        now - last_downloading_refresh_ < kDownloadingRefreshInterval) {
+        return;
+    }
+    last_downloading_refresh_ = now;
+    resync_step_ = resync_step_t::kWaitingDownloadQueue;
+    handle_.post_download_queue();
+}
+
+void torrent_context_t::on_block_downloading(const int piece_index) { piece_states_->set_downloading(piece_index); }
+
+void torrent_context_t::on_piece_finished(const int piece_index) {
+    // Pending reads ask for the piece here rather than through the deadline, which a seek may reset or clear
+    std::shared_ptr<piece_request_t> request;
+    {
+        std::lock_guard _(lock_);
+        if (const auto it = pending_reads_.find(piece_index); it != pending_reads_.end()) {
+            request = it->second;
+        }
+    }
+    if (request && issue_read(request)) {
+        handle_.read_piece(lt::piece_index_t(piece_index));
+    }
+    // Normally done earlier by streaming_torrent_plugin::on_piece_pass, on the network thread
+    endgame_->on_piece_passed(piece_index);
+    piece_states_->set_finished(piece_index);
+    if (const auto scheduler = this->scheduler()) {
+        scheduler->on_piece_finished(piece_index);
+    }
+    const auto now = std::chrono::steady_clock::now();
+    range_estimator_.on_piece_finished(now);
+    update_prefetch();
+    refresh_downloading(now);
+}
+
+bool torrent_context_t::has_pending_read(const int piece) const {
+    std::lock_guard _(lock_);
+    return pending_reads_.count(piece) != 0;
+}
+
+void torrent_context_t::set_playhead(const int piece) {
+    {
+        std::lock_guard _(lock_);
+        cache_.set_playhead(piece);
+    }
+    update_prefetch();
+}
+
+void torrent_context_t::update_prefetch() {
+    const auto scheduler = this->scheduler();
+    if (!scheduler) {
+        return;
+    }
+    int playhead;
+    {
+        std::lock_guard _(lock_);
+        playhead = cache_.playhead();
+    }
+    prefetch_.update(scheduler->buffered_pieces(playhead));
+}
+
+void torrent_context_t::set_cache_capacity(const int64_t capacity_bytes) {
+    std::lock_guard _(lock_);
+    cache_.set_capacity(capacity_bytes);
+}
+
+piece_cache_stats_t torrent_context_t::cache_stats() const {
+    std::lock_guard _(lock_);
+    return cache_.stats();
+}
+
+std::vector<int> torrent_context_t::query_piece_availability() const {
+    std::vector<int> availability;
+    handle_.piece_availability(availability);
+    // libtorrent has no piece picker, hence no availability, once the torrent is a seed
+    if (availability.empty()) {
+        if (const auto ti = handle_.torrent_file()) {
+            availability.assign(static_cast<size_t>(ti->num_pieces()), 0);
+        }
+    }
+    return availability;
+}
+
+std::vector<int> torrent_context_t::piece_availability() {
+    const std::vector<int> availability = query_piece_availability();
+    if (!availability.empty()) {
+        std::lock_guard _(lock_);
+        availability_baseline_ = availability;
+    }
+    return availability;
+}
+
+std::vector<std::pair<int, int>> torrent_context_t::piece_availability_changes(const size_t max_changes) {
+    const std::vector<int> availability = query_piece_availability();
+    std::vector<std::pair<int, int>> changes;
+    std::lock_guard _(lock_);
+    // The piece count only changes when metadata arrives
+    availability_baseline_.resize(availability.size(), 0);
+    for (size_t piece = 0; piece < availability.size() && changes.size() < max_changes; ++piece) {
+        if (availability[piece] != availability_baseline_[piece]) {
+            availability_baseline_[piece] = availability[piece];
+            changes.emplace_back(static_cast<int>(piece), availability[piece]);
+        }
+    }
+    return changes;
+}
+
+void torrent_context_t::set_media_index(const int file_index, std::shared_ptr<const media_index_t> index) {
+    std::lock_guard _(lock_);
+    media_indexes_[file_index] = std::move(index);
+}
+
+std::shared_ptr<const media_index_t> torrent_context_t::media_index(const int file_index) const {
+    std::lock_guard _(lock_);
+    if (const auto it = media_indexes_.find(file_index); it != media_indexes_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+void torrent_context_t::set_scheduler(std::shared_ptr<streaming_scheduler_t> scheduler) {
+    std::lock_guard _(lock_);
+    scheduler_ = std::move(scheduler);
+}
+
+std::shared_ptr<streaming_scheduler_t> torrent_context_t::scheduler() const {
+    std::lock_guard _(lock_);
+    return scheduler_;
+}
+
+void torrent_context_t::close() {
+    recheck_.cancel();
+    {
+        std::lock_guard _(lock_);
+        closed_ = true;
+        scheduler_.reset();
+        cache_.clear();
+        media_indexes_.clear();
+        for (auto &[piece, request]: pending_reads_) {
+            piece_data_t data;
+            data.failed = true;
+            complete(request, std::move(data));
+        }
+        pending_reads_.clear();
+    }
+    piece_done_.notify_all();
+}
+
+std::shared_ptr<torrent_context_t> torrent_registry_t::attach(const lt::torrent_handle &handle) {
+    std::lock_guard _(lock_);
+    auto &context = contexts_[handle.id()];
+    if (!context) {
+        context = std::make_shared<torrent_context_t>(handle, piece_cache_capacity_);
+    }
+    return context;
+}
+
+void torrent_registry_t::set_piece_cache_capacity(const int64_t capacity_bytes) {
+    std::lock_guard _(lock_);
+    piece_cache_capacity_ = capacity_bytes;
+    for (const auto &[id, context]: contexts_) {
+        context->set_cache_capacity(capacity_bytes);
+    }
+}
+
+std::vector<std::shared_ptr<torrent_context_t>> torrent_registry_t::all() const {
+    std::lock_guard _(lock_);
+    std::vector<std::shared_ptr<torrent_context_t>> contexts;
+    contexts.reserve(contexts_.size());
+    for (const auto &[id, context]: contexts_) {
+        contexts.push_back(context);
+    }
+    return contexts;
+}
+
+std::shared_ptr<torrent_context_t> torrent_registry_t::find(const handle_id_t handle_id) const {
+    std::lock_guard _(lock_);
+    if (const auto it = contexts_.find(handle_id); it != contexts_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+void torrent_registry_t::remove(const handle_id_t handle_id) {
+    std::shared_ptr<torrent_context_t> context;
+    {
+        // In one step, so that release_piece_states finds the map either in its context or here
+        std::lock_guard _(lock_);
+        if (const auto it = contexts_.find(handle_id); it != contexts_.end()) {
+            context = std::move(it->second);
+            contexts_.erase(it);
+            if (auto states = context->exported_piece_states()) {
+                exported_piece_states_[handle_id] = std::move(states);
+            }
+        }
+    }
+    if (context) {
+        context->close();
+    }
+}
+
+void torrent_registry_t::release_piece_states(const handle_id_t handle_id) {
+    // Freed after the lock is released
+    std::shared_ptr<piece_state_map_t> states;
+    std::lock_guard _(lock_);
+    if (const auto it = contexts_.find(handle_id); it != contexts_.end()) {
+        it->second->release_piece_states();
+    }
+    if (const auto it = exported_piece_states_.find(handle_id); it != exported_piece_states_.end()) {
+        states = std::move(it->second);
+        exported_piece_states_.erase(it);
+    }
+}
+} // namespace anilt
@@ -1,10 +1,20 @@
 
 #include "torrent_handle_t.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include "global_lock.h"
 #include "libtorrent/magnet_uri.hpp"
+#include "media_index.hpp"
+#include "piece_deadlines.hpp"
+#include "streaming_scheduler.hpp"
+#include "torrent_context.hpp"
 
 namespace anilt {
+// libtorrent::top_priority
+static constexpr uint8_t kMaxPiecePriority = 7;
+
 torrent_handle_t::reload_file_result_t torrent_handle_t::reload_file() {
     function_printer_t _fp("torrent_handle_t::reload_file");
     const auto handle = handle_;
@@ -36,6 +46,9 @@ void torrent_handle_t::post_status_updates() const {
     function_printer_t _fp("torrent_handle_t::post_status_updates");
     guard_global_lock;
     if (const auto handle = handle_; handle && handle->is_valid()) {
+        if (const auto context = context_) {
+            context->request_status();
+        }
         handle->post_status();
     }
 }
@@ -61,6 +74,9 @@ void torrent_handle_t::reset_piece_deadline(const int32_t index) const {
     if (const auto handle = handle_; handle && handle->is_valid()) {
         handle->reset_piece_deadline(static_cast<libtorrent::piece_index_t>(index));
     }
+    if (const auto context = context_) {
+        context->endgame()->reset_deadline(index);
+    }
 }
 void torrent_handle_t::clear_piece_deadlines() const {
     function_printer_t _fp("torrent_handle_t::clear_piece_deadlines");
@@ -68,6 +84,9 @@ void torrent_handle_t::clear_piece_deadlines() const {
     if (const auto handle = handle_; handle && handle->is_valid()) {
         handle->clear_piece_deadlines();
     }
+    if (const auto context = context_) {
+        context->endgame()->clear();
+    }
 }
 
 void torrent_handle_t::set_piece_deadline(const int32_t index, const int deadline) const {
@@ -77,21 +96,145 @@ void torrent_handle_t::set_piece_deadline(const int32_t index, const int deadlin
         handle->set_piece_deadline(libtorrent::piece_index_t(index), deadline);
         handle->piece_priority(libtorrent::piece_index_t(index), libtorrent::default_priority);
     }
+    if (const auto context = context_) {
+        // Lets the endgame and deadline tracking skip pieces we already have
+        context->piece_states();
+        context->endgame()->set_deadline(index, deadline);
+    }
 }
 
-void torrent_handle_t::set_peer_endgame(const bool endgame) const {
-    function_printer_t _fp("torrent_handle_t::set_peer_endgame");
+void torrent_handle_t::set_piece_deadlines(const int32_t first_piece, const int count, const int base_deadline,
+                                           const int step_deadline, const bool clear_others) const {
+    function_printer_t _fp("torrent_handle_t::set_piece_deadlines");
     guard_global_lock;
     if (const auto handle = handle_; handle && handle->is_valid()) {
-        std::vector<lt::peer_info> peers;
-        handle->get_peer_info(peers);
-        for (auto &peer: peers) {
-            if (endgame) {
-                peer.flags |= libtorrent::peer_info::endgame_mode; // don't know if it works
-            } else {
-                peer.flags &= ~libtorrent::peer_info::endgame_mode;
+        const auto context = context_;
+        if (context) {
+            context->piece_states();
+        }
+        const auto ti = handle->torrent_file();
+        const int num_pieces = ti ? ti->num_pieces() : 0;
+        std::vector<std::pair<int, int>> deadlines;
+        std::vector<int> pieces;
+        for (int i = 0; i < count && first_piece + i < num_pieces; ++i) {
+            if (first_piece + i >= 0) {
+                deadlines.emplace_back(first_piece + i, base_deadline + i * step_deadline);
+                pieces.push_back(first_piece + i);
             }
         }
+        if (clear_others && context) {
+            // Only the deadlines outside the new set are reset. Those of pending reads are kept, or the read
+            // would wait for a piece nobody downloads anymore.
+            auto stale = pieces_not_in(context->endgame()->deadline_pieces(), pieces);
+            stale.erase(std::remove_if(stale.begin(), stale.end(),
+                                       [&](const int piece) { return context->has_pending_read(piece); }),
+                        stale.end());
+            reset_piece_deadlines(*handle, stale, context->endgame().get());
+        } else if (clear_others) {
+            handle->clear_piece_deadlines();
+        }
+        anilt::set_piece_deadlines(*handle, deadlines, context ? context->endgame().get() : nullptr);
+    }
+}
+
+void torrent_handle_t::prioritize_pieces(char *buffer, const int num_pieces) const {
+    function_printer_t _fp("torrent_handle_t::prioritize_pieces");
+    guard_global_lock;
+    if (const auto handle = handle_; handle && handle->is_valid() && buffer && num_pieces > 0) {
+        const auto ti = handle->torrent_file();
+        if (!ti || num_pieces > ti->num_pieces()) {
+            return;
+        }
+        std::vector<std::pair<lt::piece_index_t, lt::download_priority_t>> priorities;
+        priorities.reserve(num_pieces);
+        for (int i = 0; i < num_pieces; ++i) {
+            const auto priority = std::min(static_cast<uint8_t>(buffer[i]), kMaxPiecePriority);
+            priorities.emplace_back(lt::piece_index_t(i), static_cast<lt::download_priority_t>(priority));
+        }
+        handle->prioritize_pieces(priorities);
+    }
+}
+
+void torrent_handle_t::prioritize_pieces_bitmap(char *buffer, const int num_pieces, const uint8_t set_priority,
+                                                const uint8_t unset_priority) const {
+    function_printer_t _fp("torrent_handle_t::prioritize_pieces_bitmap");
+    guard_global_lock;
+    if (const auto handle = handle_; handle && handle->is_valid() && buffer && num_pieces > 0) {
+        // The bitmap must cover every piece
+        const auto ti = handle->torrent_file();
+        if (!ti || num_pieces != ti->num_pieces()) {
+            return;
+        }
+        const auto set = static_cast<lt::download_priority_t>(std::min(set_priority, kMaxPiecePriority));
+        const auto unset = static_cast<lt::download_priority_t>(std::min(unset_priority, kMaxPiecePriority));
+        std::vector<std::pair<lt::piece_index_t, lt::download_priority_t>> priorities;
+        priorities.reserve(num_pieces);
+        for (int i = 0; i < num_pieces; ++i) {
+            const bool bit = static_cast<uint8_t>(buffer[i / 8]) >> (i % 8) & 1;
+            priorities.emplace_back(lt::piece_index_t(i), bit ? set : unset);
+        }
+        handle->prioritize_pieces(priorities);
+    }
+}
+
+void torrent_handle_t::set_peer_endgame(const bool endgame) const {
+    function_printer_t _fp("torrent_handle_t::set_peer_endgame");
+    guard_global_lock;
+    if (const auto context = context_) {
+        context->endgame()->set_enabled(endgame);
+    }
+}
+
+void torrent_handle_t::configure_peer_endgame(const int threshold_millis, const int min_request_age_millis,
+                                              const int max_extra_peers) const {
+    function_printer_t _fp("torrent_handle_t::configure_peer_endgame");
+    if (const auto context = context_) {
+        context->endgame()->configure(threshold_millis, min_request_age_millis, max_extra_peers);
+    }
+}
+
+void torrent_handle_t::set_asap_deadline_grace(const int grace_millis) const {
+    function_printer_t _fp("torrent_handle_t::set_asap_deadline_grace");
+    if (const auto context = context_) {
+        context->endgame()->set_asap_grace(grace_millis);
+    }
+}
+
+int64_t torrent_handle_t::get_endgame_duplicated_requests() const {
+    if (const auto context = context_) {
+        return static_cast<int64_t>(context->endgame()->duplicated_requests());
+    }
+    return 0;
+}
+
+void torrent_handle_t::set_streaming_quality_mode(const int mode) const {
+    function_printer_t _fp("torrent_handle_t::set_streaming_quality_mode");
+    if (mode < kStreamingQualityOff || mode > kStreamingQualityAggressive) {
+        return;
+    }
+    if (const auto context = context_) {
+        context->endgame()->set_quality_mode(static_cast<streaming_quality_mode_t>(mode));
+    }
+}
+
+streaming_quality_stats_t torrent_handle_t::get_streaming_quality_stats() const {
+    if (const auto context = context_) {
+        return context->endgame()->quality_stats();
+    }
+    return {};
+}
+
+deadline_stats_t torrent_handle_t::get_deadline_stats() const {
+    if (const auto context = context_) {
+        return context->deadlines().stats(std::chrono::steady_clock::now());
+    }
+    return {};
+}
+
+void torrent_handle_t::reset_deadline_stats() const {
+    function_printer_t _fp("torrent_handle_t::reset_deadline_stats");
+    if (const auto context = context_) {
+        context->deadlines().reset_stats();
     }
 }
 
@@ -163,4 +306,330 @@ void torrent_handle_t::get_peers(std::vector<anilt::peer_info_t> &peers) const {
         }
         return -1;
     }
+
+    // Deadline of the first piece of a range, and increment for each following piece
+    static constexpr int kReadDeadlineStepMillis = 100;
+
+    int torrent_handle_t::read_range(const int file_index, const int64_t offset, char *buffer, const int length,
+                                     const int timeout_millis) const {
+        function_printer_t _fp("torrent_handle_t::read_range");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return kReadRangeInvalidHandle;
+        }
+        const auto &handle = context->handle();
+        const auto ti = handle.torrent_file();
+        if (!ti || !buffer || length < 0 || offset < 0 || file_index < 0 || file_index >= ti->num_files()) {
+            return kReadRangeInvalidArgument;
+        }
+        const auto &files = ti->files();
+        const lt::file_index_t file(file_index);
+        const int64_t file_size = files.file_size(file);
+        if (offset >= file_size || length == 0) {
+            return 0;
+        }
+
+        // Absolute range in the torrent
+        const int64_t begin = files.file_offset(file) + offset;
+        const int64_t end = begin + std::min<int64_t>(length, file_size - offset);
+        const int64_t piece_length = ti->piece_length();
+        const auto first_piece = static_cast<int>(begin / piece_length);
+        const auto last_piece = static_cast<int>((end - 1) / piece_length);
+
+        context->set_playhead(first_piece);
+
+        // Request all pieces first so that they download in parallel
+        std::vector<std::shared_ptr<torrent_context_t::piece_request_t>> requests;
+        requests.reserve(last_piece - first_piece + 1);
+        for (int piece = first_piece; piece <= last_piece; ++piece) {
+            requests.push_back(context->request_piece(piece, (piece - first_piece) * kReadDeadlineStepMillis));
+        }
+
+        const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_millis);
+        int copied = 0;
+        for (const auto &request: requests) {
+            torrent_context_t::piece_data_t data;
+            if (!context->wait_piece(request, until, data)) {
+                if (copied > 0) {
+                    return copied;
+                }
+                return data.failed ? kReadRangeFailed : kReadRangeTimeout;
+            }
+            const int64_t piece_begin = request->piece() * piece_length;
+            const int64_t from = std::max(begin, piece_begin);
+            const int64_t to = std::min(end, piece_begin + data.size);
+            if (to <= from) {
+                return copied > 0 ? copied : kReadRangeFailed;
+            }
+            std::memcpy(buffer + copied, data.buffer.get() + (from - piece_begin), static_cast<size_t>(to - from));
+            copied += static_cast<int>(to - from);
+        }
+        return copied;
+    }
+
+    bool torrent_handle_t::start_streaming(const streaming_config_t &config) const {
+        function_printer_t _fp("torrent_handle_t::start_streaming");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return false;
+        }
+        auto scheduler = std::make_shared<streaming_scheduler_t>(context->handle(), config, context->endgame());
+        if (!scheduler->valid()) {
+            return false;
+        }
+        if (const auto index = context->media_index(config.file_index)) {
+            scheduler->use_media_index(*index);
+        }
+        if (const auto previous = context->scheduler()) {
+            previous->stop();
+        }
+        context->set_scheduler(scheduler);
+        context->set_playhead(0);
+        scheduler->seek(0);
+        context->prefetch().start(config);
+        return true;
+    }
+
+    void torrent_handle_t::seek_streaming(const int piece_index) const {
+        function_printer_t _fp("torrent_handle_t::seek_streaming");
+        if (const auto context = context_) {
+            context->set_playhead(piece_index);
+            if (const auto scheduler = context->scheduler()) {
+                scheduler->seek(piece_index);
+            }
+        }
+    }
+
+    void torrent_handle_t::stop_streaming() const {
+        function_printer_t _fp("torrent_handle_t::stop_streaming");
+        if (const auto context = context_) {
+            if (const auto scheduler = context->scheduler()) {
+                scheduler->stop();
+            }
+            context->set_scheduler(nullptr);
+            context->prefetch().stop();
+        }
+    }
+
+    void torrent_handle_t::update_streaming_playback(const int64_t position, const int64_t bytes_per_second,
+                                                     const float speed) const {
+        function_printer_t _fp("torrent_handle_t::update_streaming_playback");
+        if (const auto context = context_) {
+            if (const auto scheduler = context->scheduler()) {
+                context->set_playhead(scheduler->piece_of(position));
+                scheduler->update_playback(position, bytes_per_second, speed);
+                context->update_prefetch();
+            }
+        }
+    }
+
+    range_eta_t torrent_handle_t::estimate_range_ready(const int file_index, const int64_t offset,
+                                                       const int64_t length) const {
+        function_printer_t _fp("torrent_handle_t::estimate_range_ready");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return {};
+        }
+        return context->range_estimator().estimate(context->handle(), file_index, offset, length,
+                                                   std::chrono::steady_clock::now());
+    }
+
+    void torrent_handle_t::set_next_file_prefetch(const int64_t bytes) const {
+        function_printer_t _fp("torrent_handle_t::set_next_file_prefetch");
+        if (const auto context = context_; context && context->handle().is_valid()) {
+            context->prefetch().set_size(bytes);
+        }
+    }
+
+    int torrent_handle_t::get_prefetch_file() const {
+        if (const auto context = context_) {
+            return context->prefetch().target_file();
+        }
+        return -1;
+    }
+
+    bool torrent_handle_t::is_streaming_piece(const int piece_index) const {
+        if (const auto context = context_) {
+            if (const auto scheduler = context->scheduler()) {
+                return scheduler->is_downloading(piece_index);
+            }
+        }
+        return false;
+    }
+
+    void torrent_handle_t::set_piece_cache_size(const int64_t capacity_bytes) const {
+        function_printer_t _fp("torrent_handle_t::set_piece_cache_size");
+        if (const auto context = context_) {
+            context->set_cache_capacity(capacity_bytes);
+        }
+    }
+
+    piece_cache_stats_t torrent_handle_t::get_piece_cache_stats() const {
+        if (const auto context = context_) {
+            return context->cache_stats();
+        }
+        return {};
+    }
+
+    int torrent_handle_t::get_piece_availability(char *buffer, const int size) const {
+        function_printer_t _fp("torrent_handle_t::get_piece_availability");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return -1;
+        }
+        const std::vector<int> availability = context->piece_availability();
+        if (availability.empty()) {
+            return -1;
+        }
+        const int count = buffer ? std::min(std::max(size, 0), static_cast<int>(availability.size())) : 0;
+        for (int piece = 0; piece < count; ++piece) {
+            buffer[piece] = static_cast<char>(std::clamp(availability[piece], 0, 255));
+        }
+        return static_cast<int>(availability.size());
+    }
+
+    int torrent_handle_t::get_piece_availability_changes(char *buffer, const int size) const {
+        function_printer_t _fp("torrent_handle_t::get_piece_availability_changes");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid() || !context->handle().torrent_file()) {
+            return -1;
+        }
+        constexpr size_t kRecordSize = 2 * sizeof(int32_t);
+        const size_t max_changes = buffer && size > 0 ? static_cast<size_t>(size) / kRecordSize : 0;
+        const auto changes = context->piece_availability_changes(max_changes);
+        for (size_t i = 0; i < changes.size(); ++i) {
+            const int32_t record[2] = {changes[i].first, changes[i].second};
+            std::memcpy(buffer + i * kRecordSize, record, kRecordSize);
+        }
+        return static_cast<int>(changes.size());
+    }
+
+    piece_state_buffer_t torrent_handle_t::get_piece_state_buffer() const {
+        function_printer_t _fp("torrent_handle_t::get_piece_state_buffer");
+        piece_state_buffer_t buffer;
+        if (const auto context = context_) {
+            if (const auto states = context->export_piece_states()) {
+                buffer.data = states->data();
+                buffer.size = static_cast<int64_t>(states->size());
+            }
+        }
+        return buffer;
+    }
+
+    int torrent_handle_t::recheck_file(const int file_index, const bool full_recheck_on_failure) const {
+        function_printer_t _fp("torrent_handle_t::recheck_file");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return kRecheckInvalidHandle;
+        }
+        switch (context->recheck().start(context->handle(), file_index, full_recheck_on_failure)) {
+            case file_recheck_t::kStarted:
+                return kRecheckStarted;
+            case file_recheck_t::kNothingToCheck:
+                return kRecheckNothingToCheck;
+            case file_recheck_t::kBusy:
+                return kRecheckBusy;
+            case file_recheck_t::kUnsupported:
+                return kRecheckUnsupported;
+            default:
+                return kRecheckInvalidArgument;
+        }
+    }
+
+    void torrent_handle_t::cancel_recheck_file() const {
+        function_printer_t _fp("torrent_handle_t::cancel_recheck_file");
+        if (const auto context = context_) {
+            context->recheck().cancel();
+        }
+    }
+
+    int torrent_handle_t::load_media_index(const int file_index, const int timeout_millis) const {
+        function_printer_t _fp("torrent_handle_t::load_media_index");
+        const auto context = context_;
+        if (!context || !context->handle().is_valid()) {
+            return kMediaIndexInvalidHandle;
+        }
+        const auto ti = context->handle().torrent_file();
+        if (!ti || file_index < 0 || file_index >= ti->num_files()) {
+            return kMediaIndexInvalidArgument;
+        }
+        const int64_t file_size = ti->files().file_size(lt::file_index_t(file_index));
+        const auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_millis);
+
+        // Every read gets the remaining time, so that the whole parse respects the timeout
+        int read_error = 0;
+        const auto read = [&](const int64_t offset, const int64_t size, std::vector<char> &out) {
+            static constexpr int64_t kMaxReadSize = 4 * 1024 * 1024;
+            out.resize(static_cast<size_t>(size));
+            int64_t done = 0;
+            while (done < size) {
+                const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    until - std::chrono::steady_clock::now()).count();
+                if (remaining <= 0) {
+                    read_error = kReadRangeTimeout;
+                    return false;
+                }
+                const int result = read_range(file_index, offset + done, out.data() + done,
+                                              static_cast<int>(std::min(kMaxReadSize, size - done)),
+                                              static_cast<int>(remaining));
+                if (result <= 0) {
+                    read_error = result < 0 ? result : kReadRangeFailed;
+                    return false;
+                }
+                done += result;
+            }
+            return true;
+        };
+
+        auto index = media_index_t::parse(file_size, read);
+        if (!index) {
+            switch (read_error) {
+                case 0:
+                    return kMediaIndexUnsupported;
+                case kReadRangeTimeout:
+                    return kMediaIndexTimeout;
+                default:
+                    return kMediaIndexFailed;
+            }
+        }
+        context->set_media_index(file_index, std::move(index));
+        return kMediaIndexReady;
+    }
+
+    media_index_info_t torrent_handle_t::get_media_index_info(const int file_index) const {
+        media_index_info_t info;
+        if (const auto context = context_) {
+            if (const auto index = context->media_index(file_index)) {
+                info.container = index->container();
+                info.duration_millis = index->duration_millis();
+                info.num_keyframes = static_cast<int32_t>(index->keyframes().size());
+                info.index_offset = index->index_range().offset;
+                info.index_size = index->index_range().size;
+            }
+        }
+        return info;
+    }
+
+    int64_t torrent_handle_t::media_offset_for_time(const int file_index, const int64_t time_millis) const {
+        if (const auto context = context_) {
+            if (const auto index = context->media_index(file_index)) {
+                return index->offset_for_time(time_millis);
+            }
+        }
+        return -1;
+    }
+
+    int torrent_handle_t::media_piece_for_time(const int file_index, const int64_t time_millis) const {
+        const int64_t offset = media_offset_for_time(file_index, time_millis);
+        const auto context = context_;
+        if (offset < 0 || !context) {
+            return -1;
+        }
+        const auto ti = context->handle().torrent_file();
+        if (!ti || file_index < 0 || file_index >= ti->num_files()) {
+            return -1;
+        }
+        const int64_t absolute = ti->files().file_offset(lt::file_index_t(file_index)) + offset;
+        return static_cast<int>(absolute / ti->piece_length());
+    }
 } // namespace anilt
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "alert_pump.hpp"
+#include "test_harness.hpp"
+#include "test_torrent.hpp"
+
+using namespace anilt;
+
+struct added_listener_t final : event_listener_t {
+    std::vector<handle_id_t> added{};
+
+    void on_torrent_added(const handle_id_t handle_id) override { added.push_back(handle_id); }
+};
+
+static std::shared_ptr<lt::session> make_session() {
+    lt::settings_pack pack = test::test_torrent_t::settings();
+    pack.set_int(lt::settings_pack::alert_mask, lt::alert_category::status);
+    return std::make_shared<lt::session>(pack);
+}
+
+// Adds `count` paused torrents without metadata and returns their handle ids in order
+static std::vector<handle_id_t> add_torrents(lt::session &session, const int count) {
+    std::vector<handle_id_t> ids;
+    for (int i = 0; i < count; ++i) {
+        lt::add_torrent_params params;
+        params.info_hashes.v1 = lt::hasher(reinterpret_cast<const char *>(&i), sizeof i).final();
+        params.save_path = (std::filesystem::temp_directory_path() / "anitorrent_pump_test").string();
+        params.flags = lt::torrent_flags::paused;
+        ids.push_back(session.add_torrent(std::move(params)).id());
+    }
+    return ids;
+}
+
+TEST_CASE(drain_delivers_events_in_order) {
+    const auto session = make_session();
+    alert_pump_t pump(session, std::make_shared<alert_dispatcher_t>(), 64);
+    pump.start(nullptr);
+    const auto ids = add_torrents(*session, 4);
+
+    added_listener_t listener;
+    const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (listener.added.size() < ids.size() && std::chrono::steady_clock::now() < until) {
+        pump.drain(listener, SIZE_MAX);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    pump.stop();
+    CHECK(listener.added == ids);
+    CHECK(!pump.has_events());
+}
+
+TEST_CASE(stopped_pump_keeps_blocked_events) {
+    const auto session = make_session();
+    // Two events fit, the pump blocks on the third
+    alert_pump_t pump(session, std::make_shared<alert_dispatcher_t>(), 2);
+    pump.start(nullptr);
+    const auto ids = add_torrents(*session, 8);
+    const auto until = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (pump.blocked_count() == 0 && std::chrono::steady_clock::now() < until) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    CHECK(pump.blocked_count() > 0);
+    pump.stop();
+    CHECK(pump.has_events());
+
+    added_listener_t listener;
+    pump.drain(listener, SIZE_MAX);
+    CHECK(listener.added.size() > 2);
+    CHECK(std::equal(listener.added.begin(), listener.added.end(), ids.begin()));
+    CHECK(!pump.has_events());
+
+    // Started again, the pump delivers the alerts it did not pop before stopping
+    pump.start(nullptr);
+    const auto restart_until = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (listener.added.size() < ids.size() && std::chrono::steady_clock::now() < restart_until) {
+        pump.drain(listener, SIZE_MAX);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    pump.stop();
+    CHECK(listener.added == ids);
+}
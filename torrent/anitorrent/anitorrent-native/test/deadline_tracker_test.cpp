@@ -0,0 +1,119 @@
+#include <limits>
+
+#include "deadline_tracker.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+using namespace std::chrono_literals;
+
+static const deadline_tracker_t::clock::time_point kStart{};
+
+TEST_CASE(piece_in_time_is_not_missed) {
+    deadline_tracker_t tracker;
+    tracker.on_deadline(1, kStart + 1s, kStart);
+    tracker.on_finished(1, kStart + 500ms);
+
+    CHECK(tracker.take_misses().empty());
+    const auto stats = tracker.stats(kStart + 500ms);
+    CHECK_EQ(stats.finished_pieces, 1);
+    CHECK_EQ(stats.missed_pieces, 0);
+    CHECK_EQ(stats.pending_pieces, 0);
+    CHECK_EQ(stats.on_time_percent, 100);
+}
+
+TEST_CASE(late_piece_is_reported_once) {
+    deadline_tracker_t tracker;
+    tracker.on_deadline(1, kStart + 1s, kStart);
+    tracker.on_deadline(2, kStart + 3s, kStart);
+    tracker.on_finished(1, kStart + 1500ms);
+
+    const auto misses = tracker.take_misses();
+    CHECK_EQ(misses.size(), 1u);
+    if (misses.size() == 1) {
+        CHECK_EQ(misses[0].piece_index, 1);
+        CHECK_EQ(misses[0].lateness_millis, 500);
+        CHECK_EQ(misses[0].wait_millis, 1500);
+        // Piece 2 is due in 1.5 s
+        CHECK_EQ(misses[0].buffer_health_millis, 1500);
+        CHECK_EQ(misses[0].on_time_percent, 0);
+    }
+    CHECK(tracker.take_misses().empty());
+
+    // A piece finishing again is not counted twice
+    tracker.on_finished(1, kStart + 2s);
+    CHECK_EQ(tracker.stats(kStart + 2s).finished_pieces, 1);
+}
+
+TEST_CASE(forgotten_pieces_are_not_counted) {
+    deadline_tracker_t tracker;
+    tracker.on_deadline(1, kStart + 1s, kStart);
+    tracker.on_deadline(2, kStart + 1s, kStart);
+    tracker.forget(1);
+    tracker.on_finished(1, kStart + 2s);
+    CHECK_EQ(tracker.stats(kStart + 2s).finished_pieces, 0);
+
+    tracker.forget_all();
+    tracker.on_finished(2, kStart + 2s);
+    CHECK_EQ(tracker.stats(kStart + 2s).finished_pieces, 0);
+    CHECK(tracker.take_misses().empty());
+}
+
+TEST_CASE(stats_count_overdue_and_on_time_share) {
+    deadline_tracker_t tracker;
+    for (int piece = 0; piece < 4; ++piece) {
+        tracker.on_deadline(piece, kStart + 1s, kStart);
+    }
+    tracker.on_finished(0, kStart + 500ms);
+    tracker.on_finished(1, kStart + 2s);
+    tracker.on_deadline(4, kStart + 5s, kStart);
+
+    const auto stats = tracker.stats(kStart + 2s);
+    CHECK_EQ(stats.finished_pieces, 2);
+    CHECK_EQ(stats.missed_pieces, 1);
+    CHECK(stats.miss_ratio == 0.5f);
+    CHECK_EQ(stats.pending_pieces, 3);
+    CHECK_EQ(stats.overdue_pieces, 2);
+    CHECK_EQ(stats.buffer_health_millis, -1000);
+    CHECK_EQ(stats.on_time_percent, 50);
+    CHECK(stats.lateness_max_millis > 0);
+
+    tracker.reset_stats();
+    const auto reset = tracker.stats(kStart + 2s);
+    CHECK_EQ(reset.finished_pieces, 0);
+    CHECK_EQ(reset.pending_pieces, 3);
+    CHECK_EQ(reset.on_time_percent, 100);
+}
+
+TEST_CASE(earliest_deadline_is_kept) {
+    deadline_tracker_t tracker;
+    tracker.on_deadline(1, kStart + 1s, kStart);
+    // Asked again while waiting, e.g. by a reader retrying
+    tracker.on_deadline(1, kStart + 3s, kStart + 2s);
+    tracker.on_finished(1, kStart + 2500ms);
+
+    const auto misses = tracker.take_misses();
+    CHECK_EQ(misses.size(), 1u);
+    if (misses.size() == 1) {
+        CHECK_EQ(misses[0].lateness_millis, 1500);
+        CHECK_EQ(misses[0].wait_millis, 2500);
+    }
+}
+
+TEST_CASE(past_deadlines_are_missed) {
+    deadline_tracker_t tracker;
+    tracker.on_deadline(1, kStart - 10s, kStart);
+    tracker.on_finished(1, kStart + 1s);
+
+    const auto misses = tracker.take_misses();
+    CHECK_EQ(misses.size(), 1u);
+    if (misses.size() == 1) {
+        CHECK_EQ(misses[0].lateness_millis, 11000);
+        CHECK_EQ(misses[0].wait_millis, 1000);
+    }
+    CHECK_EQ(tracker.stats(kStart + 1s).missed_pieces, 1);
+}
+
+TEST_CASE(buffer_health_without_deadlines_is_max) {
+    deadline_tracker_t tracker;
+    CHECK_EQ(tracker.buffer_health_millis(kStart), std::numeric_limits<int32_t>::max());
+}
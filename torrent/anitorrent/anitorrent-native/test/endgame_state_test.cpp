@@ -0,0 +1,56 @@
+#include "plugin/streaming_plugin.h"
+#include "test_harness.hpp"
+
+using namespace anilt;
+using namespace std::chrono_literals;
+
+TEST_CASE(negative_deadlines_wait_the_threshold) {
+    plugin::endgame_state_t endgame;
+    endgame.set_enabled(true);
+    endgame.configure(1500, 500, 2);
+    const auto now = plugin::steady_clock::now();
+    endgame.set_deadline(1, -10000);
+    endgame.set_deadline(2, -5000);
+    CHECK(endgame.urgent_pieces(now + 1s).empty());
+
+    // Setting it again does not restart the wait
+    endgame.set_deadline(1, -10000);
+    CHECK(endgame.urgent_pieces(now + 2s) == (std::vector<int>{1, 2}));
+}
+
+TEST_CASE(positive_deadlines_are_urgent_near_due_time) {
+    plugin::endgame_state_t endgame;
+    endgame.set_enabled(true);
+    endgame.configure(1500, 500, 2);
+    const auto now = plugin::steady_clock::now();
+    endgame.set_deadline(1, 10000);
+    endgame.set_deadline(2, 1000);
+    CHECK(endgame.urgent_pieces(now) == std::vector<int>{2});
+    CHECK(endgame.urgent_pieces(now + 9s) == (std::vector<int>{2, 1}));
+
+    endgame.set_enabled(false);
+    CHECK(endgame.urgent_pieces(now + 9s).empty());
+}
+
+TEST_CASE(tracker_gives_negative_deadlines_the_grace) {
+    const auto tracker = std::make_shared<deadline_tracker_t>();
+    plugin::endgame_state_t endgame(nullptr, tracker);
+    endgame.set_asap_grace(60000);
+    endgame.set_deadline(1, -10000);
+    endgame.set_deadline(2, 60000);
+    const auto now = plugin::steady_clock::now();
+    CHECK_EQ(tracker->stats(now).pending_pieces, 2);
+    CHECK(tracker->buffer_health_millis(now) > 50000);
+    endgame.on_piece_passed(1);
+    endgame.on_piece_passed(2);
+    auto stats = tracker->stats(plugin::steady_clock::now());
+    CHECK_EQ(stats.finished_pieces, 2);
+    CHECK_EQ(stats.missed_pieces, 0);
+
+    endgame.set_asap_grace(0);
+    endgame.set_deadline(3, 0);
+    endgame.on_piece_passed(3);
+    stats = tracker->stats(plugin::steady_clock::now());
+    CHECK_EQ(stats.finished_pieces, 3);
+    CHECK_EQ(stats.missed_pieces, 1);
+}
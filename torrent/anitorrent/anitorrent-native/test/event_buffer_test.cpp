@@ -0,0 +1,153 @@
+#include <cstring>
+#include <string>
+
+#include "event_buffer.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+template<typename T>
+static T get(const std::vector<char> &data, const size_t offset) {
+    T value;
+    std::memcpy(&value, data.data() + offset, sizeof(T));
+    return value;
+}
+
+static std::vector<char> read_all(event_buffer_t &buffer, const size_t capacity) {
+    std::vector<char> out(capacity);
+    out.resize(buffer.read(out.data(), capacity));
+    return out;
+}
+
+TEST_CASE(batch_header_and_records) {
+    event_buffer_t buffer;
+    buffer.on_torrent_added(7);
+    buffer.on_block_downloading(7, 3, 5);
+    buffer.on_torrent_removed(8, "name");
+    constexpr size_t kRecords = 3 * event_buffer_t::kRecordHeaderSize + 8 + 4;
+    CHECK_EQ(buffer.remaining(), kRecords);
+
+    const auto data = read_all(buffer, 1024);
+    CHECK_EQ(data.size(), event_buffer_t::kBatchHeaderSize + kRecords);
+    CHECK_EQ(get<uint32_t>(data, 0), event_buffer_t::kMagic);
+    CHECK_EQ(get<uint16_t>(data, 4), event_buffer_t::kVersion);
+    CHECK_EQ(get<uint32_t>(data, 8), 3u);
+    CHECK_EQ(get<uint32_t>(data, 12), kRecords);
+
+    size_t pos = event_buffer_t::kBatchHeaderSize;
+    CHECK_EQ(get<uint16_t>(data, pos), kEventTorrentAdded);
+    CHECK_EQ(get<uint32_t>(data, pos + 4), 7u);
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 0u);
+    pos += event_buffer_t::kRecordHeaderSize;
+
+    CHECK_EQ(get<uint16_t>(data, pos), kEventBlockDownloading);
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 8u);
+    CHECK_EQ(get<int32_t>(data, pos + 12), 3);
+    CHECK_EQ(get<int32_t>(data, pos + 16), 5);
+    pos += event_buffer_t::kRecordHeaderSize + 8;
+
+    // The name is not null-terminated
+    CHECK_EQ(get<uint16_t>(data, pos), kEventTorrentRemoved);
+    CHECK_EQ(get<uint32_t>(data, pos + 4), 8u);
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 4u);
+    CHECK_EQ(std::string(data.data() + pos + 12, 4), "name");
+
+    CHECK_EQ(buffer.remaining(), 0u);
+    CHECK_EQ(buffer.next_read_size(), 0u);
+}
+
+TEST_CASE(variable_size_payloads) {
+    event_buffer_t buffer;
+    piece_progress_t progress;
+    progress.blocks_downloading = 9;
+    progress.downloading_pieces = {1, 2};
+    progress.finished_pieces = {4};
+    buffer.on_piece_progress(1, progress);
+    recheck_progress_t recheck;
+    recheck.file_index = 2;
+    recheck.checked_pieces = 10;
+    recheck.total_pieces = 20;
+    recheck.failed_pieces = 1;
+    recheck.new_failed_pieces = {6};
+    recheck.done = true;
+    recheck.full_recheck_started = true;
+    buffer.on_recheck_progress(1, recheck);
+
+    const auto data = read_all(buffer, 1024);
+    size_t pos = event_buffer_t::kBatchHeaderSize;
+    CHECK_EQ(get<uint16_t>(data, pos), kEventPieceProgress);
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 4u * 6);
+    pos += event_buffer_t::kRecordHeaderSize;
+    for (const int32_t expected: {9, 2, 1, 2, 1, 4}) {
+        CHECK_EQ(get<int32_t>(data, pos), expected);
+        pos += 4;
+    }
+
+    CHECK_EQ(get<uint16_t>(data, pos), kEventRecheckProgress);
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 4u * 7);
+    pos += event_buffer_t::kRecordHeaderSize;
+    for (const int32_t expected: {2, 10, 20, 1, 3, 1, 6}) {
+        CHECK_EQ(get<int32_t>(data, pos), expected);
+        pos += 4;
+    }
+    CHECK_EQ(pos, data.size());
+}
+
+TEST_CASE(fixed_size_payloads) {
+    event_buffer_t buffer;
+    torrent_stats_t stats;
+    stats.total = 100;
+    stats.progress = 0.5f;
+    stats.changed_fields = kStatsTotal | kStatsProgress;
+    buffer.on_status_update(1, stats);
+    session_stats_t session_stats;
+    session_stats.interval_ms = 1000;
+    buffer.on_session_stats(0, session_stats);
+    deadline_miss_t miss;
+    miss.piece_index = 3;
+    miss.on_time_percent = 75;
+    buffer.on_deadline_missed(1, miss);
+
+    const auto data = read_all(buffer, 1024);
+    size_t pos = event_buffer_t::kBatchHeaderSize;
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 72u);
+    CHECK_EQ(get<int64_t>(data, pos + 12), 100);
+    CHECK(get<float>(data, pos + 12 + 64) == 0.5f);
+    CHECK_EQ(get<uint32_t>(data, pos + 12 + 68), kStatsTotal | kStatsProgress);
+    pos += event_buffer_t::kRecordHeaderSize + 72;
+
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 17u * 8);
+    CHECK_EQ(get<int64_t>(data, pos + 12 + 16 * 8), 1000);
+    pos += event_buffer_t::kRecordHeaderSize + 17 * 8;
+
+    CHECK_EQ(get<uint32_t>(data, pos + 8), 20u);
+    CHECK_EQ(get<int32_t>(data, pos + 12), 3);
+    CHECK_EQ(get<int32_t>(data, pos + 12 + 16), 75);
+}
+
+TEST_CASE(read_splits_batches_at_whole_records) {
+    event_buffer_t buffer;
+    for (int piece = 0; piece < 3; ++piece) {
+        buffer.on_piece_finished(1, piece);
+    }
+    constexpr size_t kRecordSize = event_buffer_t::kRecordHeaderSize + 4;
+    CHECK_EQ(buffer.next_read_size(), event_buffer_t::kBatchHeaderSize + kRecordSize);
+
+    // Too small for the next record: nothing is consumed
+    std::vector<char> small(event_buffer_t::kBatchHeaderSize + kRecordSize - 1);
+    CHECK_EQ(buffer.read(small.data(), small.size()), 0u);
+    CHECK_EQ(buffer.remaining(), 3 * kRecordSize);
+
+    const auto first = read_all(buffer, event_buffer_t::kBatchHeaderSize + 2 * kRecordSize + 1);
+    CHECK_EQ(get<uint32_t>(first, 8), 2u);
+    CHECK_EQ(buffer.remaining(), kRecordSize);
+
+    const auto second = read_all(buffer, 1024);
+    CHECK_EQ(get<uint32_t>(second, 8), 1u);
+    CHECK_EQ(get<int32_t>(second, event_buffer_t::kBatchHeaderSize + event_buffer_t::kRecordHeaderSize), 2);
+    CHECK_EQ(buffer.read(nullptr, 1024), 0u);
+
+    buffer.on_checked(1);
+    buffer.clear();
+    CHECK_EQ(buffer.remaining(), 0u);
+}
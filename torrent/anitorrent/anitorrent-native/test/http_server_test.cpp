@@ -0,0 +1,125 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include "http_server.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+namespace asio = boost::asio;
+
+static bool parse(const std::string &value, int64_t &first, int64_t &last) {
+    first = -1;
+    last = -1;
+    return http_server_t::parse_range(value, first, last);
+}
+
+TEST_CASE(parse_closed_and_open_ranges) {
+    int64_t first, last;
+    CHECK(parse("bytes=0-499", first, last));
+    CHECK_EQ(first, 0);
+    CHECK_EQ(last, 499);
+
+    CHECK(parse("bytes=500-", first, last));
+    CHECK_EQ(first, 500);
+    CHECK_EQ(last, -1);
+
+    // Suffix range: the last 200 bytes
+    CHECK(parse("bytes=-200", first, last));
+    CHECK_EQ(first, -1);
+    CHECK_EQ(last, 200);
+
+    CHECK(parse("Bytes= 10 - 20 ", first, last));
+    CHECK_EQ(first, 10);
+    CHECK_EQ(last, 20);
+}
+
+TEST_CASE(parse_keeps_first_of_multiple_ranges) {
+    int64_t first, last;
+    CHECK(parse("bytes=0-99, 200-299", first, last));
+    CHECK_EQ(first, 0);
+    CHECK_EQ(last, 99);
+}
+
+TEST_CASE(parse_rejects_invalid_ranges) {
+    int64_t first, last;
+    CHECK(!parse("bytes=-", first, last));
+    CHECK(!parse("bytes=abc-10", first, last));
+    CHECK(!parse("bytes=10", first, last));
+    CHECK(!parse("items=0-10", first, last));
+    CHECK(!parse("bytes=+1-2", first, last));
+    CHECK(!parse("bytes=0-9999999999999999999999", first, last));
+    CHECK(!parse("", first, last));
+}
+
+TEST_CASE(loopback_hosts) {
+    CHECK(http_server_t::is_loopback_host("127.0.0.1"));
+    CHECK(http_server_t::is_loopback_host("127.0.0.1:8080"));
+    CHECK(http_server_t::is_loopback_host("127.1.2.3"));
+    CHECK(http_server_t::is_loopback_host("localhost"));
+    CHECK(http_server_t::is_loopback_host("LocalHost:80"));
+    CHECK(http_server_t::is_loopback_host("[::1]"));
+    CHECK(http_server_t::is_loopback_host("[::1]:8080"));
+}
+
+TEST_CASE(other_hosts_are_refused) {
+    // DNS rebinding: a name controlled by a web page that resolves to 127.0.0.1
+    CHECK(!http_server_t::is_loopback_host("evil.example"));
+    CHECK(!http_server_t::is_loopback_host("localhost.evil.example"));
+    CHECK(!http_server_t::is_loopback_host("127.0.0.1.evil.example"));
+    CHECK(!http_server_t::is_loopback_host("192.168.1.1"));
+    CHECK(!http_server_t::is_loopback_host("[::2]"));
+    CHECK(!http_server_t::is_loopback_host("[::1"));
+    CHECK(!http_server_t::is_loopback_host(":80"));
+}
+
+static std::string read_response(asio::ip::tcp::socket &socket) {
+    std::string response;
+    boost::system::error_code ec;
+    asio::read(socket, asio::dynamic_buffer(response), ec);
+    return response;
+}
+
+TEST_CASE(forbidden_host_is_refused) {
+    http_server_t server([](handle_id_t) { return nullptr; });
+    const int port = server.start(0, 1000);
+    CHECK(port > 0);
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    socket.connect({asio::ip::address_v4::loopback(), static_cast<unsigned short>(port)});
+    const std::string request = "GET /1/0 HTTP/1.1\r\nHost: evil.example\r\n\r\n";
+    asio::write(socket, asio::buffer(request));
+    CHECK_EQ(read_response(socket).rfind("HTTP/1.1 403 Forbidden\r\n", 0), 0u);
+    server.stop();
+}
+
+TEST_CASE(connections_past_the_limit_get_503) {
+    http_server_t server([](handle_id_t) { return nullptr; });
+    const int port = server.start(0, 1000);
+    const asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), static_cast<unsigned short>(port));
+
+    asio::io_context io;
+    std::vector<std::unique_ptr<asio::ip::tcp::socket>> sockets;
+    for (int i = 0; i < 16; ++i) {
+        auto &socket = sockets.emplace_back(std::make_unique<asio::ip::tcp::socket>(io));
+        socket->connect(endpoint);
+        // Answered, so the connection is known to be accepted and kept open
+        const std::string request = "GET /1/0 HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n";
+        asio::write(*socket, asio::buffer(request));
+        std::string status(12, '\0');
+        asio::read(*socket, asio::buffer(status));
+        CHECK_EQ(status, "HTTP/1.1 404");
+    }
+
+    asio::ip::tcp::socket rejected(io);
+    rejected.connect(endpoint);
+    const std::string response = read_response(rejected);
+    CHECK_EQ(response.rfind("HTTP/1.1 503 Service Unavailable\r\n", 0), 0u);
+    CHECK(response.find("Connection: close\r\n") != std::string::npos);
+    server.stop();
+}
@@ -0,0 +1,96 @@
+#include <array>
+#include <cstdint>
+
+#include "latency_tracker.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+using counts_t = std::array<uint64_t, latency_histogram_t::kBuckets>;
+
+// Bucket `micros` falls into, through the public interface
+static int bucket_of(const int64_t micros) {
+    latency_histogram_t histogram;
+    histogram.record(micros);
+    counts_t counts{};
+    int64_t sum = 0, max = 0;
+    histogram.merge_into(counts, sum, max);
+    for (int i = 0; i < latency_histogram_t::kBuckets; ++i) {
+        if (counts[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+TEST_CASE(small_values_have_exact_buckets) {
+    for (int micros = 0; micros < 8; ++micros) {
+        CHECK_EQ(bucket_of(micros), micros);
+    }
+    CHECK_EQ(bucket_of(-5), 0);
+}
+
+TEST_CASE(each_power_of_two_has_sub_buckets) {
+    // [8, 16) is split into [8, 10), [10, 12), [12, 14), [14, 16)
+    CHECK_EQ(bucket_of(8), 8);
+    CHECK_EQ(bucket_of(9), 8);
+    CHECK_EQ(bucket_of(10), 9);
+    CHECK_EQ(bucket_of(15), 11);
+    CHECK_EQ(bucket_of(16), 12);
+    CHECK_EQ(bucket_of(1000), 35);
+    CHECK_EQ(bucket_of(1024), 36);
+
+    int previous = 0;
+    for (int64_t micros = 1; micros < (int64_t{1} << 20); micros += micros / 7 + 1) {
+        const int bucket = bucket_of(micros);
+        CHECK(bucket >= previous);
+        previous = bucket;
+    }
+}
+
+TEST_CASE(large_values_go_to_the_last_bucket) {
+    CHECK_EQ(bucket_of((int64_t{1} << 35) - 1), latency_histogram_t::kBuckets - 1);
+    CHECK_EQ(bucket_of(int64_t{1} << 35), latency_histogram_t::kBuckets - 1);
+    CHECK_EQ(bucket_of(INT64_MAX), latency_histogram_t::kBuckets - 1);
+    CHECK(bucket_of(int64_t{1} << 34) < latency_histogram_t::kBuckets - 1);
+}
+
+TEST_CASE(percentiles_are_within_a_sub_bucket) {
+    for (int64_t micros = 1; micros < 10'000'000; micros += micros / 3 + 1) {
+        latency_histogram_t histogram;
+        histogram.record(micros);
+        histogram.record(INT32_MAX);
+        counts_t counts{};
+        int64_t sum = 0, max = 0;
+        histogram.merge_into(counts, sum, max);
+        // The upper bound of the bucket of the smaller value
+        const auto p50 = latency_histogram_t::summarize(counts, sum, max).p50_us;
+        CHECK(p50 >= micros);
+        CHECK(p50 - micros <= micros / latency_histogram_t::kSubBuckets);
+    }
+}
+
+TEST_CASE(summary) {
+    latency_histogram_t histogram;
+    counts_t counts{};
+    int64_t sum = 0, max = 0;
+    histogram.merge_into(counts, sum, max);
+    CHECK_EQ(latency_histogram_t::summarize(counts, sum, max).count, 0);
+
+    for (int i = 1; i <= 100; ++i) {
+        histogram.record(i * 10);
+    }
+    histogram.merge_into(counts, sum, max);
+    const auto summary = latency_histogram_t::summarize(counts, sum, max);
+    CHECK_EQ(summary.count, 100);
+    CHECK_EQ(summary.mean_us, 505);
+    CHECK_EQ(summary.max_us, 1000);
+    CHECK(summary.p50_us >= 500 && summary.p50_us < 640);
+    CHECK(summary.p99_us >= 990 && summary.p99_us <= 1000);
+
+    histogram.reset();
+    counts = {};
+    sum = max = 0;
+    histogram.merge_into(counts, sum, max);
+    CHECK_EQ(latency_histogram_t::summarize(counts, sum, max).count, 0);
+}
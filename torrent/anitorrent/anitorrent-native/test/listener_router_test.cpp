@@ -0,0 +1,126 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "alert_dispatcher.hpp"
+#include "listener_router.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+namespace {
+struct recording_listener_t final : event_listener_t {
+    void on_checked(const handle_id_t handle_id) override { checked.push_back(handle_id); }
+    void on_piece_finished(const handle_id_t handle_id, const int32_t piece_index) override {
+        finished.push_back(piece_index);
+    }
+    void on_session_stats(handle_id_t, session_stats_t &) override { ++session_stats; }
+
+    std::vector<handle_id_t> checked;
+    std::vector<int32_t> finished;
+    int session_stats = 0;
+};
+
+// Destroys `victim` from its first callback, like a Kotlin listener closed from an event
+struct destroying_listener_t final : event_listener_t {
+    void on_checked(handle_id_t) override { victim.reset(); }
+
+    std::unique_ptr<recording_listener_t> victim;
+};
+} // namespace
+
+TEST_CASE(torrent_events_follow_routes) {
+    const auto table = std::make_shared<torrent_listener_table_t>();
+    recording_listener_t fallback, routed;
+    table->set(1, &routed);
+    {
+        listener_router_t router(table, fallback, false);
+        router.on_checked(1);
+        router.on_checked(2);
+        session_stats_t stats;
+        router.on_session_stats(1, stats);
+    }
+    CHECK_EQ(routed.checked.size(), 1u);
+    CHECK_EQ(fallback.checked.size(), 1u);
+    CHECK_EQ(fallback.checked[0], 2u);
+    // Session-wide events always go to the fallback
+    CHECK_EQ(fallback.session_stats, 1);
+    CHECK_EQ(routed.session_stats, 0);
+
+    table->set(1, nullptr);
+    listener_router_t router(table, fallback, false);
+    router.on_checked(1);
+    CHECK_EQ(fallback.checked.size(), 2u);
+}
+
+TEST_CASE(unrouted_and_unsubscribed_events_are_dropped) {
+    const auto table = std::make_shared<torrent_listener_table_t>();
+    recording_listener_t fallback, routed;
+    routed.subscribed_events = event_bit(kEventChecked);
+    table->set(1, &routed);
+    CHECK_EQ(table->subscribed_events(), event_bit(kEventChecked));
+
+    listener_router_t router(table, fallback, true);
+    router.on_checked(2);
+    router.on_piece_finished(1, 3);
+    router.on_checked(1);
+    CHECK(fallback.checked.empty());
+    CHECK(routed.finished.empty());
+    CHECK_EQ(routed.checked.size(), 1u);
+}
+
+TEST_CASE(destroyed_listener_removes_its_routes) {
+    const auto table = std::make_shared<torrent_listener_table_t>();
+    recording_listener_t fallback;
+    {
+        recording_listener_t routed;
+        table->set(1, &routed);
+        table->set(2, &routed);
+    }
+    uint64_t version;
+    CHECK(table->snapshot(version) == nullptr);
+
+    listener_router_t router(table, fallback, false);
+    router.on_checked(1);
+    CHECK_EQ(fallback.checked.size(), 1u);
+}
+
+TEST_CASE(listener_destroyed_during_dispatch) {
+    const auto table = std::make_shared<torrent_listener_table_t>();
+    recording_listener_t fallback;
+    destroying_listener_t destroyer;
+    destroyer.victim = std::make_unique<recording_listener_t>();
+    table->set(1, &destroyer);
+    table->set(2, destroyer.victim.get());
+
+    listener_router_t router(table, fallback, false);
+    router.on_checked(1);
+    CHECK(destroyer.victim == nullptr);
+    // The router refreshes its routes instead of calling the destroyed listener
+    router.on_checked(2);
+    CHECK_EQ(fallback.checked.size(), 1u);
+}
+
+TEST_CASE(destruction_waits_for_dispatch_on_other_threads) {
+    const auto table = std::make_shared<torrent_listener_table_t>();
+    recording_listener_t fallback;
+    auto routed = std::make_unique<recording_listener_t>();
+    table->set(1, routed.get());
+
+    std::atomic<bool> destroyed{false};
+    std::thread thread;
+    {
+        listener_router_t router(table, fallback, false);
+        thread = std::thread([&] {
+            routed.reset();
+            destroyed.store(true);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        // The batch still holds the dispatch lock
+        CHECK(!destroyed.load());
+    }
+    thread.join();
+    CHECK(destroyed.load());
+}
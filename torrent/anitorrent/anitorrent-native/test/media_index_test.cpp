@@ -0,0 +1,224 @@
+#include <cstring>
+#include <string>
+
+#include "media_index.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+using bytes_t = std::string;
+
+static bytes_t be(const uint64_t value, const size_t size) {
+    bytes_t out(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        out[size - 1 - i] = static_cast<char>(value >> (8 * i) & 0xFF);
+    }
+    return out;
+}
+
+static media_index_t::reader_t reader_of(const bytes_t &file) {
+    return [&file](const int64_t offset, const int64_t size, std::vector<char> &out) {
+        out.assign(file.begin() + offset, file.begin() + offset + size);
+        return true;
+    };
+}
+
+static std::shared_ptr<const media_index_t> parse(const bytes_t &file) {
+    return media_index_t::parse(static_cast<int64_t>(file.size()), reader_of(file));
+}
+
+// MP4
+
+static bytes_t box(const char (&type)[5], const bytes_t &body) { return be(8 + body.size(), 4) + type + body; }
+
+// version 0 and no flags
+static bytes_t full_box(const char (&type)[5], const bytes_t &body) { return box(type, be(0, 4) + body); }
+
+// Four video samples of 100 bytes and 1 s each in two chunks at `chunk_offset` and `chunk_offset + 1000`.
+// Samples 1 and 3 are sync samples.
+static bytes_t moov(const uint64_t chunk_offset) {
+    const bytes_t time_header = be(0, 4) + be(0, 4) + be(1000, 4) + be(4000, 4);
+    const bytes_t stbl = box("stbl", full_box("stts", be(1, 4) + be(4, 4) + be(1000, 4)) +
+                                         full_box("stss", be(2, 4) + be(1, 4) + be(3, 4)) +
+                                         full_box("stsc", be(1, 4) + be(1, 4) + be(2, 4) + be(1, 4)) +
+                                         full_box("stsz", be(100, 4) + be(4, 4)) +
+                                         full_box("stco", be(2, 4) + be(chunk_offset, 4) + be(chunk_offset + 1000, 4)));
+    const bytes_t mdia = box("mdia", full_box("mdhd", time_header) + full_box("hdlr", be(0, 4) + "vide") +
+                                         box("minf", stbl));
+    return box("moov", full_box("mvhd", time_header) + box("trak", mdia));
+}
+
+static bytes_t mp4_file() {
+    const bytes_t ftyp = box("ftyp", bytes_t("isom") + be(0, 4));
+    const bytes_t mdat = box("mdat", bytes_t(2000, '\0'));
+    return ftyp + mdat + moov(ftyp.size() + 8);
+}
+
+TEST_CASE(mp4_keyframes_and_metadata_ranges) {
+    const bytes_t file = mp4_file();
+    const auto index = parse(file);
+    CHECK(index != nullptr);
+    if (!index) {
+        return;
+    }
+    CHECK_EQ(index->container(), kMediaContainerMp4);
+    CHECK_EQ(index->duration_millis(), 4000);
+    const int64_t mdat_body = 16 + 8;
+    CHECK_EQ(index->keyframes().size(), 2u);
+    if (index->keyframes().size() == 2) {
+        CHECK_EQ(index->keyframes()[0].time_millis, 0);
+        CHECK_EQ(index->keyframes()[0].offset, mdat_body);
+        CHECK_EQ(index->keyframes()[1].time_millis, 2000);
+        CHECK_EQ(index->keyframes()[1].offset, mdat_body + 1000);
+    }
+    CHECK_EQ(index->offset_for_time(2500), mdat_body + 1000);
+    const int64_t moov_offset = 16 + 8 + 2000;
+    CHECK_EQ(index->index_range().offset, moov_offset);
+    CHECK_EQ(index->index_range().size, static_cast<int64_t>(file.size()) - moov_offset);
+    CHECK_EQ(index->metadata_ranges().size(), 2u);
+}
+
+// Each case corrupts a valid file. `parsed` is whether an index is still returned, `keyframes` how many it has.
+struct malformed_case_t {
+    const char *name;
+    bytes_t file;
+    bool parsed;
+    size_t keyframes;
+};
+
+static void check_cases(const std::vector<malformed_case_t> &cases) {
+    for (const auto &c: cases) {
+        const auto index = parse(c.file);
+        if ((index != nullptr) != c.parsed || (index && index->keyframes().size() != c.keyframes)) {
+            std::fprintf(stderr, "case %s: parsed %d with %zu keyframes\n", c.name, index != nullptr,
+                         index ? index->keyframes().size() : 0);
+            ++test::failures();
+        }
+    }
+}
+
+static bytes_t replace_at(bytes_t file, const size_t offset, const bytes_t &bytes) {
+    file.replace(offset, bytes.size(), bytes);
+    return file;
+}
+
+static size_t find(const bytes_t &file, const char *type) { return file.find(type) - 4; }
+
+TEST_CASE(mp4_truncated_and_malformed_headers) {
+    const bytes_t file = mp4_file();
+    check_cases({
+        {"empty", bytes_t(), false, 0},
+        {"shorter than a box header", file.substr(0, 6), false, 0},
+        {"ftyp only", file.substr(0, 16), false, 0},
+        {"truncated in mdat", file.substr(0, 100), false, 0},
+        {"truncated in moov", file.substr(0, file.size() - 10), false, 0},
+        {"box smaller than its header", replace_at(file, find(file, "mdat"), be(4, 4)), false, 0},
+        {"box larger than the file", replace_at(file, find(file, "mdat"), be(1u << 30, 4)), false, 0},
+        {"truncated 64-bit size", file.substr(0, 16) + be(1, 4) + "mdat" + be(0, 4), false, 0},
+        {"stco count past its box", replace_at(file, find(file, "stco") + 12, be(1000, 4)), true, 0},
+        {"stsz without its sample sizes", replace_at(file, find(file, "stsz") + 12, be(0, 4)), true, 0},
+        {"mdhd without timescale", replace_at(file, find(file, "mdhd") + 20, be(0, 4)), true, 0},
+        {"child box larger than moov", replace_at(file, find(file, "trak"), be(1u << 20, 4)), true, 0},
+    });
+}
+
+TEST_CASE(mp4_failed_read_aborts) {
+    const bytes_t file = mp4_file();
+    const auto index = media_index_t::parse(
+        static_cast<int64_t>(file.size()), [&file](const int64_t offset, const int64_t size, std::vector<char> &out) {
+            // moov is not downloaded yet
+            if (offset + size > 16 + 8 + 2000) {
+                return false;
+            }
+            out.assign(file.begin() + offset, file.begin() + offset + size);
+            return true;
+        });
+    CHECK(index == nullptr);
+}
+
+// Matroska
+
+// IDs keep their length marker. Sizes are always written on 8 bytes so that offsets do not depend on values.
+static bytes_t element(const uint32_t id, const bytes_t &body) {
+    const size_t id_size = id > 0xFFFFFF ? 4 : id > 0xFFFF ? 3 : id > 0xFF ? 2 : 1;
+    return be(id, id_size) + be(0x0100000000000000 | body.size(), 8) + body;
+}
+
+static bytes_t uint_element(const uint32_t id, const uint64_t value) { return element(id, be(value, 8)); }
+
+static bytes_t float_element(const uint32_t id, const double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof bits);
+    return element(id, be(bits, 8));
+}
+
+static bytes_t cue_point(const uint64_t time, const uint64_t cluster) {
+    return element(0xBB, uint_element(0xB3, time) + element(0xB7, uint_element(0xF7, 1) + uint_element(0xF1, cluster)));
+}
+
+// Two clusters of 1000 bytes, with Cues after them found through the SeekHead. `segment_start` is set to the offset
+// cluster positions are relative to.
+static bytes_t mkv_file(int64_t &segment_start) {
+    const bytes_t ebml = element(0x1A45DFA3, element(0x4282, "matroska"));
+    const bytes_t info = element(0x1549A966, uint_element(0x2AD7B1, 1000000) + float_element(0x4489, 10000));
+    const bytes_t tracks = element(0x1654AE6B, element(0xAE, uint_element(0xD7, 1) + uint_element(0x83, 1)));
+    const bytes_t cluster = element(0x1F43B675, element(0xA3, bytes_t(1000, '\0')));
+    const auto seek_head = [](const uint64_t cues) {
+        return element(0x114D9B74, element(0x4DBB, uint_element(0x53AB, 0x1C53BB6B) + uint_element(0x53AC, cues)));
+    };
+    const uint64_t first_cluster = seek_head(0).size() + info.size() + tracks.size();
+    const uint64_t cues_position = first_cluster + 2 * cluster.size();
+    const bytes_t cues =
+        element(0x1C53BB6B, cue_point(0, first_cluster) + cue_point(5000, first_cluster + cluster.size()));
+    const bytes_t segment = element(0x18538067, seek_head(cues_position) + info + tracks + cluster + cluster + cues);
+    segment_start = static_cast<int64_t>(ebml.size()) + 4 + 8;
+    return ebml + segment;
+}
+
+TEST_CASE(mkv_cues_and_metadata_ranges) {
+    int64_t segment_start = 0;
+    const bytes_t file = mkv_file(segment_start);
+    CHECK_EQ(segment_start, static_cast<int64_t>(file.find(be(0x114D9B74, 4))));
+    const auto index = parse(file);
+    CHECK(index != nullptr);
+    if (!index) {
+        return;
+    }
+    CHECK_EQ(index->container(), kMediaContainerMkv);
+    CHECK_EQ(index->duration_millis(), 10000);
+    const auto first_cluster = static_cast<int64_t>(file.find(be(0x1F43B675, 4)));
+    CHECK_EQ(index->keyframes().size(), 2u);
+    if (index->keyframes().size() == 2) {
+        CHECK_EQ(index->keyframes()[0].time_millis, 0);
+        CHECK_EQ(index->keyframes()[0].offset, first_cluster);
+        CHECK_EQ(index->keyframes()[1].time_millis, 5000);
+        CHECK_EQ(index->keyframes()[1].offset, first_cluster + 4 + 8 + 1 + 8 + 1000);
+    }
+    // EBML header with the Segment header, SeekHead, Info, Tracks and Cues
+    CHECK_EQ(index->metadata_ranges().size(), 5u);
+    CHECK_EQ(index->index_range().offset, static_cast<int64_t>(file.find(be(0x1C53BB6B, 4) + be(0x01, 1))));
+}
+
+TEST_CASE(mkv_truncated_and_malformed_headers) {
+    int64_t segment_start = 0;
+    const bytes_t file = mkv_file(segment_start);
+    const size_t cues = file.find(be(0x1C53BB6B, 4) + be(0x01, 1));
+    const size_t second_cue_point = file.find(be(0xBB, 1) + be(0x01, 1), cues + 13);
+    const size_t seek_position = file.find(be(0x53AC, 2));
+    check_cases({
+        {"shorter than the EBML magic", file.substr(0, 4), false, 0},
+        {"truncated in the EBML header", file.substr(0, 16), false, 0},
+        {"truncated before the Segment", file.substr(0, static_cast<size_t>(segment_start) - 12), false, 0},
+        {"EBML header of unknown size", replace_at(file, 4, be(0x01FFFFFFFFFFFFFF, 8)), false, 0},
+        {"invalid Segment size", replace_at(file, static_cast<size_t>(segment_start) - 8, be(0, 1)), false, 0},
+        {"truncated in Cues", file.substr(0, file.size() - 10), true, 0},
+        {"SeekPosition past the Segment", replace_at(file, seek_position + 2 + 8, be(1u << 30, 8)), true, 0},
+        {"CuePoint larger than Cues", replace_at(file, second_cue_point + 1, be(0x01000000FFFFFFFF, 8)), true, 1},
+        {"Cues of unknown size", replace_at(file, cues + 4, be(0x01FFFFFFFFFFFFFF, 8)), true, 0},
+    });
+}
+
+TEST_CASE(unknown_container_is_rejected) {
+    CHECK(parse(bytes_t(64, '\0')) == nullptr);
+    CHECK(parse(bytes_t("RIFF") + be(56, 4) + bytes_t(56, '\0')) == nullptr);
+}
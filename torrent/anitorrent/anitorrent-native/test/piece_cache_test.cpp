@@ -0,0 +1,113 @@
+#include "piece_cache.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+static constexpr int kPieceSize = 100;
+
+static void insert(piece_cache_t &cache, const int piece, const int size = kPieceSize) {
+    cache.insert(piece, boost::shared_array<char>(new char[size]), size);
+}
+
+static bool contains(piece_cache_t &cache, const int piece) {
+    boost::shared_array<char> buffer;
+    int size = 0;
+    return cache.find(piece, buffer, size);
+}
+
+TEST_CASE(find_returns_inserted_piece) {
+    piece_cache_t cache(10 * kPieceSize);
+    const boost::shared_array<char> data(new char[kPieceSize]);
+    cache.insert(3, data, kPieceSize);
+
+    boost::shared_array<char> buffer;
+    int size = 0;
+    CHECK(cache.find(3, buffer, size));
+    CHECK(buffer == data);
+    CHECK_EQ(size, kPieceSize);
+    CHECK(!cache.find(4, buffer, size));
+
+    const auto stats = cache.stats();
+    CHECK_EQ(stats.hits, 1);
+    CHECK_EQ(stats.misses, 1);
+    CHECK_EQ(stats.num_pieces, 1);
+    CHECK_EQ(stats.size_bytes, kPieceSize);
+}
+
+TEST_CASE(evicts_least_recently_used_without_playhead) {
+    piece_cache_t cache(3 * kPieceSize);
+    insert(cache, 1);
+    insert(cache, 2);
+    insert(cache, 3);
+    // 1 becomes the most recently used, so 2 goes first
+    CHECK(contains(cache, 1));
+    insert(cache, 4);
+    CHECK(!contains(cache, 2));
+    CHECK(contains(cache, 1));
+    CHECK(contains(cache, 3));
+    CHECK(contains(cache, 4));
+    CHECK_EQ(cache.stats().evictions, 1);
+}
+
+TEST_CASE(evicts_farthest_from_playhead) {
+    piece_cache_t cache(3 * kPieceSize);
+    cache.set_playhead(10);
+    insert(cache, 9);
+    insert(cache, 30);
+    insert(cache, 11);
+    // 30 is the most recently used but the farthest
+    CHECK(contains(cache, 30));
+    insert(cache, 12);
+    CHECK(!contains(cache, 30));
+    CHECK(contains(cache, 9));
+    CHECK(contains(cache, 11));
+    CHECK(contains(cache, 12));
+}
+
+TEST_CASE(equal_distance_evicts_least_recently_used) {
+    piece_cache_t cache(2 * kPieceSize);
+    cache.set_playhead(10);
+    insert(cache, 8);
+    insert(cache, 12);
+    insert(cache, 10);
+    CHECK(!contains(cache, 8));
+    CHECK(contains(cache, 12));
+}
+
+TEST_CASE(reinsert_replaces_previous_copy) {
+    piece_cache_t cache(3 * kPieceSize);
+    insert(cache, 1);
+    insert(cache, 1, 2 * kPieceSize);
+    const auto stats = cache.stats();
+    CHECK_EQ(stats.num_pieces, 1);
+    CHECK_EQ(stats.size_bytes, 2 * kPieceSize);
+    CHECK_EQ(stats.evictions, 0);
+}
+
+TEST_CASE(rejects_pieces_larger_than_capacity) {
+    piece_cache_t cache(kPieceSize);
+    insert(cache, 1, kPieceSize + 1);
+    insert(cache, 2, 0);
+    cache.insert(3, nullptr, kPieceSize);
+    CHECK_EQ(cache.stats().num_pieces, 0);
+
+    piece_cache_t disabled(0);
+    insert(disabled, 1);
+    CHECK(!contains(disabled, 1));
+}
+
+TEST_CASE(shrinking_capacity_evicts) {
+    piece_cache_t cache(4 * kPieceSize);
+    cache.set_playhead(0);
+    for (int piece = 0; piece < 4; ++piece) {
+        insert(cache, piece);
+    }
+    cache.set_capacity(2 * kPieceSize);
+    CHECK_EQ(cache.stats().num_pieces, 2);
+    CHECK(contains(cache, 0));
+    CHECK(contains(cache, 1));
+
+    cache.clear();
+    CHECK_EQ(cache.stats().num_pieces, 0);
+    CHECK_EQ(cache.stats().size_bytes, 0);
+}
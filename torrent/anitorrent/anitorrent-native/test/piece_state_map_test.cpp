@@ -0,0 +1,113 @@
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include "piece_state_map.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+static uint32_t header(const piece_state_map_t &map, const size_t word) {
+    uint32_t value;
+    std::memcpy(&value, map.data() + word * sizeof(uint32_t), sizeof(value));
+    return value;
+}
+
+static uint8_t byte(const piece_state_map_t &map, const int piece) {
+    return static_cast<uint8_t>(map.data()[piece_state_map_t::kHeaderSize + piece]);
+}
+
+TEST_CASE(layout) {
+    piece_state_map_t map;
+    CHECK(map.data() == nullptr);
+    CHECK(map.init({piece_state_map_t::kPieceFinished, piece_state_map_t::kPieceNone, 0xFF, 0, 0}));
+    CHECK(!map.init({0}));
+
+    CHECK_EQ(map.size(), piece_state_map_t::kHeaderSize + 5);
+    CHECK_EQ(header(map, 0), 0u);
+    CHECK_EQ(header(map, 1), 5u);
+    CHECK_EQ(header(map, 2), piece_state_map_t::kVersion);
+    CHECK_EQ(byte(map, 0), piece_state_map_t::kPieceFinished);
+    CHECK_EQ(byte(map, 1), piece_state_map_t::kPieceNone);
+    // Bits outside the state are not taken from the initial states
+    CHECK_EQ(byte(map, 2), piece_state_map_t::kPieceStateMask);
+}
+
+TEST_CASE(deadline_flag) {
+    piece_state_map_t map;
+    map.init({0, 0, 0});
+    map.set_deadline(0, true);
+    map.set_downloading(0);
+    CHECK_EQ(map.state(0), piece_state_map_t::kPieceDownloading);
+    CHECK_EQ(byte(map, 0), piece_state_map_t::kPieceDownloading | piece_state_map_t::kPieceDeadline);
+
+    map.sync({piece_state_map_t::kPieceNone, 0, 0});
+    CHECK_EQ(byte(map, 0), piece_state_map_t::kPieceDeadline);
+
+    map.set_finished(0);
+    CHECK_EQ(byte(map, 0), piece_state_map_t::kPieceFinished);
+    map.set_deadline(0, true);
+    CHECK_EQ(byte(map, 0), piece_state_map_t::kPieceFinished);
+
+    map.set_deadline(1, true);
+    map.set_deadline(2, true);
+    map.clear_deadlines();
+    CHECK_EQ(byte(map, 1), 0);
+    CHECK_EQ(byte(map, 2), 0);
+}
+
+TEST_CASE(sync_downloading_keeps_finished) {
+    piece_state_map_t map;
+    map.init({piece_state_map_t::kPieceFinished, piece_state_map_t::kPieceDownloading, 0});
+    map.sync_downloading({0, 2, 7, -1});
+    CHECK_EQ(map.state(0), piece_state_map_t::kPieceFinished);
+    CHECK_EQ(map.state(1), piece_state_map_t::kPieceNone);
+    CHECK_EQ(map.state(2), piece_state_map_t::kPieceDownloading);
+    CHECK_EQ(map.state(7), piece_state_map_t::kPieceNone);
+}
+
+TEST_CASE(sequence_is_even_after_writes) {
+    piece_state_map_t map;
+    map.init({0, 0});
+    map.sync({1, 1});
+    map.sync_downloading({});
+    map.clear_deadlines();
+    CHECK_EQ(header(map, 0) % 2, 0u);
+    CHECK(header(map, 0) > 0);
+}
+
+/// A reader that sees the same even sequence before and after reading sees no half-applied resync
+TEST_CASE(snapshots_are_consistent) {
+    constexpr int kPieces = 64;
+    piece_state_map_t map;
+    map.init(std::vector<uint8_t>(kPieces));
+    const auto *sequence = reinterpret_cast<const std::atomic<uint32_t> *>(map.data());
+
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        for (int i = 0; i < 20000; ++i) {
+            map.sync(std::vector<uint8_t>(kPieces, i % 2 ? piece_state_map_t::kPieceDownloading
+                                                         : piece_state_map_t::kPieceNone));
+        }
+        stop.store(true);
+    });
+
+    int torn = 0;
+    while (!stop.load()) {
+        const uint32_t before = sequence->load(std::memory_order_acquire);
+        if (before % 2) {
+            continue;
+        }
+        const auto first = map.state(0);
+        bool same = true;
+        for (int piece = 1; piece < kPieces; ++piece) {
+            same &= map.state(piece) == first;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence->load(std::memory_order_relaxed) == before && !same) {
+            ++torn;
+        }
+    }
+    writer.join();
+    CHECK_EQ(torn, 0);
+}
@@ -0,0 +1,61 @@
+#include "range_estimator.hpp"
+#include "test_harness.hpp"
+#include "test_torrent.hpp"
+
+using namespace anilt;
+
+static constexpr int kPieceSize = 16 * 1024;
+static constexpr int kPieces = 16;
+static constexpr int kLastPieceSize = 1000;
+
+static const range_estimator_t::clock::time_point kNow = range_estimator_t::clock::now();
+
+TEST_CASE(invalid_ranges_are_unknown) {
+    test::test_torrent_t torrent("anitorrent_estimator_test", kPieces, kPieceSize, kLastPieceSize);
+    const range_estimator_t estimator;
+    const int64_t file_size = int64_t{kPieceSize} * (kPieces - 1) + kLastPieceSize;
+    struct range_t {
+        int file;
+        int64_t offset;
+        int64_t length;
+    };
+    for (const range_t range: {range_t{1, 0, 1}, range_t{-1, 0, 1}, range_t{0, -1, 1}, range_t{0, 0, 0},
+                               range_t{0, file_size, 1}}) {
+        const range_eta_t eta = estimator.estimate(torrent.handle, range.file, range.offset, range.length, kNow);
+        CHECK_EQ(eta.eta_millis, -1);
+        CHECK_EQ(eta.missing_pieces, 0);
+        CHECK_EQ(eta.remaining_bytes, 0);
+    }
+}
+
+TEST_CASE(missing_pieces_of_range) {
+    test::test_torrent_t torrent("anitorrent_estimator_test", kPieces, kPieceSize, kLastPieceSize);
+    const range_estimator_t estimator;
+    // From the middle of piece 2 to the middle of piece 4
+    const range_eta_t eta =
+        estimator.estimate(torrent.handle, 0, kPieceSize * 2 + kPieceSize / 2, kPieceSize * 2, kNow);
+    CHECK_EQ(eta.missing_pieces, 3);
+    CHECK_EQ(eta.remaining_bytes, 3 * kPieceSize);
+    CHECK_EQ(eta.in_flight_pieces, 0);
+}
+
+TEST_CASE(range_is_clamped_to_file) {
+    test::test_torrent_t torrent("anitorrent_estimator_test", kPieces, kPieceSize, kLastPieceSize);
+    const range_estimator_t estimator;
+    const range_eta_t eta =
+        estimator.estimate(torrent.handle, 0, int64_t{kPieceSize} * (kPieces - 2), int64_t{1} << 40, kNow);
+    CHECK_EQ(eta.missing_pieces, 2);
+    CHECK_EQ(eta.remaining_bytes, kPieceSize + kLastPieceSize);
+}
+
+TEST_CASE(no_peers_and_no_completions_is_unknown) {
+    test::test_torrent_t torrent("anitorrent_estimator_test", kPieces, kPieceSize, kLastPieceSize);
+    range_estimator_t estimator;
+    // Completions older than the window do not count
+    estimator.on_piece_finished(kNow - range_estimator_t::kWindow - std::chrono::seconds(10));
+    estimator.on_piece_finished(kNow - range_estimator_t::kWindow - std::chrono::seconds(5));
+    const range_eta_t eta = estimator.estimate(torrent.handle, 0, 0, kPieceSize, kNow);
+    CHECK_EQ(eta.eta_millis, -1);
+    CHECK_EQ(eta.rate_bytes_per_second, 0);
+    CHECK(eta.confidence == 0);
+}
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "resume_data_writer.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+namespace {
+// Fresh directory under the system temp directory, removed with its content at the end of the test
+struct temp_dir_t final {
+    temp_dir_t() {
+        path = std::filesystem::temp_directory_path() / ("resume_data_writer_test_" + std::to_string(::rand()));
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directories(path);
+    }
+    ~temp_dir_t() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    [[nodiscard]] std::string file(const std::string &name) const { return (path / name).string(); }
+
+    std::filesystem::path path;
+};
+
+struct saved_listener_t final : event_listener_t {
+    void on_resume_data_saved(const handle_id_t handle_id, const bool success) override {
+        saved.emplace_back(handle_id, success);
+    }
+
+    std::vector<std::pair<handle_id_t, bool>> saved;
+};
+} // namespace
+
+static std::string read_file(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+static std::vector<char> bytes(const std::string &text) { return {text.begin(), text.end()}; }
+
+TEST_CASE(write_atomically_replaces_the_file) {
+    const temp_dir_t dir;
+    const auto path = dir.file("a.fastresume");
+    CHECK(resume_data_writer_t::write_atomically(bytes("old data"), path, true));
+    CHECK_EQ(read_file(path), "old data");
+
+    CHECK(resume_data_writer_t::write_atomically(bytes("new"), path, false));
+    CHECK_EQ(read_file(path), "new");
+    CHECK(!std::filesystem::exists(path + ".tmp"));
+}
+
+TEST_CASE(failed_write_keeps_the_previous_file) {
+    const temp_dir_t dir;
+    const auto path = dir.file("a.fastresume");
+    CHECK(resume_data_writer_t::write_atomically(bytes("old data"), path, false));
+
+    // A directory is in the way of the temporary file
+    std::filesystem::create_directory(path + ".tmp");
+    CHECK(!resume_data_writer_t::write_atomically(bytes("new"), path, false));
+    CHECK_EQ(read_file(path), "old data");
+
+    CHECK(!resume_data_writer_t::write_atomically(bytes("new"), dir.file("missing/b.fastresume"), false));
+}
+
+TEST_CASE(saves_complete_in_the_background) {
+    const temp_dir_t dir;
+    std::atomic<int> notified{0};
+    resume_data_writer_t writer([&] { ++notified; });
+    writer.enqueue(1, bytes("one"), dir.file("1.fastresume"));
+    writer.enqueue(2, bytes("two"), dir.file("missing/2.fastresume"));
+    CHECK(writer.flush(std::chrono::seconds(10)));
+    CHECK(notified.load() > 0);
+    CHECK_EQ(read_file(dir.file("1.fastresume")), "one");
+
+    saved_listener_t listener;
+    writer.deliver_completions(listener);
+    CHECK_EQ(listener.saved.size(), 2u);
+    for (const auto &[handle_id, success]: listener.saved) {
+        CHECK_EQ(success, handle_id == 1);
+    }
+    writer.deliver_completions(listener);
+    CHECK_EQ(listener.saved.size(), 2u);
+}
+
+TEST_CASE(pending_saves_to_the_same_path_are_coalesced) {
+    const temp_dir_t dir;
+    const auto path = dir.file("a.fastresume");
+    resume_data_writer_t writer([] {});
+    writer.set_fsync(false);
+    for (int i = 0; i < 100; ++i) {
+        writer.enqueue(1, bytes("data " + std::to_string(i)), path);
+    }
+    CHECK(writer.flush(std::chrono::seconds(10)));
+    CHECK_EQ(read_file(path), "data 99");
+
+    // Coalesced saves complete together, once per file actually written
+    saved_listener_t listener;
+    writer.deliver_completions(listener);
+    CHECK(!listener.saved.empty());
+    CHECK(listener.saved.size() <= 100u);
+    for (const auto &[handle_id, success]: listener.saved) {
+        CHECK(success);
+    }
+}
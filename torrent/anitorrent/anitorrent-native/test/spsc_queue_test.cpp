@@ -0,0 +1,64 @@
+#include <string>
+#include <thread>
+
+#include "spsc_queue.hpp"
+#include "test_harness.hpp"
+
+using namespace anilt;
+
+TEST_CASE(capacity_is_rounded_up_to_power_of_two) {
+    CHECK_EQ(spsc_queue_t<int>(1).capacity(), 1u);
+    CHECK_EQ(spsc_queue_t<int>(5).capacity(), 8u);
+    CHECK_EQ(spsc_queue_t<int>(64).capacity(), 64u);
+}
+
+TEST_CASE(full_and_empty_queue) {
+    spsc_queue_t<std::string> queue(2);
+    std::string out;
+    CHECK(!queue.try_pop(out));
+    CHECK(queue.try_push("a"));
+    CHECK(queue.try_push("b"));
+
+    // A failed push leaves the value to the caller
+    std::string rejected = "c";
+    CHECK(!queue.try_push(std::move(rejected)));
+    CHECK_EQ(rejected, "c");
+    CHECK_EQ(queue.size(), 2u);
+
+    CHECK(queue.try_pop(out));
+    CHECK_EQ(out, "a");
+    CHECK(queue.try_push(std::move(rejected)));
+    CHECK(queue.try_pop(out));
+    CHECK_EQ(out, "b");
+    CHECK(queue.try_pop(out));
+    CHECK_EQ(out, "c");
+    CHECK(!queue.try_pop(out));
+    CHECK_EQ(queue.size(), 0u);
+}
+
+TEST_CASE(producer_and_consumer_threads_keep_order) {
+    constexpr int kCount = 200000;
+    spsc_queue_t<int> queue(16);
+    std::thread producer([&queue] {
+        for (int i = 0; i < kCount; ++i) {
+            int value = i;
+            while (!queue.try_push(std::move(value))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int expected = 0;
+    bool ordered = true;
+    while (expected < kCount) {
+        int value;
+        if (queue.try_pop(value)) {
+            ordered = ordered && value == expected;
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    CHECK(ordered);
+    CHECK_EQ(queue.size(), 0u);
+}
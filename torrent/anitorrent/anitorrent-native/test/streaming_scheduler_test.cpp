@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <limits>
+
+#include "piece_deadlines.hpp"
+#include "streaming_scheduler.hpp"
+#include "test_harness.hpp"
+#include "test_torrent.hpp"
+
+using namespace anilt;
+
+static constexpr int kPieceSize = 16 * 1024;
+static constexpr int kPieces = 64;
+
+struct fixture_t : test::test_torrent_t {
+    std::shared_ptr<plugin::endgame_state_t> endgame = std::make_shared<plugin::endgame_state_t>();
+
+    fixture_t() : test_torrent_t("anitorrent_scheduler_test", kPieces, kPieceSize) {}
+
+    // Only one piece of header, footer and possible footer, so that the expected windows stay readable
+    static streaming_config_t config() {
+        streaming_config_t config;
+        config.window_size = 8;
+        config.header_size = kPieceSize;
+        config.footer_size = kPieceSize;
+        config.possible_footer_size = kPieceSize;
+        return config;
+    }
+
+    [[nodiscard]] std::vector<int> deadline_pieces() const {
+        auto pieces = endgame->deadline_pieces();
+        std::sort(pieces.begin(), pieces.end());
+        return pieces;
+    }
+};
+
+static std::vector<int> range(const int first, const int last) {
+    std::vector<int> pieces;
+    for (int piece = first; piece <= last; ++piece) {
+        pieces.push_back(piece);
+    }
+    return pieces;
+}
+
+TEST_CASE(first_seek_requests_window_header_and_footer) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    CHECK(scheduler.valid());
+    scheduler.seek(0);
+
+    auto expected = range(0, 7);
+    expected.push_back(kPieces - 1);
+    CHECK(fixture.deadline_pieces() == expected);
+}
+
+TEST_CASE(seek_resets_deadlines_outside_new_window) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(0);
+    scheduler.seek(30);
+    CHECK(fixture.deadline_pieces() == range(30, 37));
+
+    // Overlapping windows keep the shared pieces
+    scheduler.seek(34);
+    CHECK(fixture.deadline_pieces() == range(34, 41));
+}
+
+TEST_CASE(seek_keeps_deadlines_set_by_others) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(0);
+    // e.g. torrent_handle_t::read_range
+    fixture.endgame->set_deadline(50, 1000);
+    scheduler.seek(20);
+
+    auto expected = range(20, 27);
+    expected.push_back(50);
+    CHECK(fixture.deadline_pieces() == expected);
+}
+
+TEST_CASE(seek_into_footer_keeps_window) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(10);
+    scheduler.seek(kPieces - 1);
+
+    auto expected = range(10, 17);
+    expected.push_back(kPieces - 1);
+    CHECK(fixture.deadline_pieces() == expected);
+}
+
+TEST_CASE(stop_resets_window_deadlines) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(10);
+    fixture.endgame->set_deadline(50, 1000);
+    scheduler.stop();
+    CHECK(fixture.deadline_pieces() == std::vector<int>{50});
+    CHECK(!scheduler.is_downloading(10));
+}
+
+TEST_CASE(window_advances_when_first_piece_finishes) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(10);
+    fixture.endgame->on_piece_passed(10);
+    scheduler.on_piece_finished(10);
+    CHECK(!scheduler.is_downloading(10));
+    CHECK(scheduler.is_downloading(18));
+}
+
+TEST_CASE(metadata_pieces_do_not_extend_window) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(0);
+    fixture.endgame->on_piece_passed(kPieces - 1);
+    scheduler.on_piece_finished(kPieces - 1);
+    CHECK(fixture.deadline_pieces() == range(0, 7));
+    CHECK(!scheduler.is_downloading(8));
+}
+
+TEST_CASE(window_stops_before_footer) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(0);
+    scheduler.seek(kPieces - 6);
+    CHECK(fixture.deadline_pieces() == range(kPieces - 6, kPieces - 2));
+}
+
+TEST_CASE(sync_finished_refills_window) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    scheduler.seek(10);
+    // Pieces 10 and 11 finished while their alerts were lost
+    std::vector<bool> finished(kPieces, false);
+    finished[10] = finished[11] = true;
+    scheduler.sync_finished(finished);
+    CHECK(fixture.deadline_pieces() == range(12, 19));
+    CHECK_EQ(scheduler.buffered_pieces(10), 2);
+
+    scheduler.stop();
+    finished[12] = true;
+    scheduler.sync_finished(finished);
+    CHECK(fixture.deadline_pieces().empty());
+    CHECK_EQ(scheduler.buffered_pieces(10), 3);
+}
+
+TEST_CASE(in_window_covers_finished_and_metadata_pieces) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    CHECK(!scheduler.in_window(0));
+    scheduler.seek(0);
+    CHECK(scheduler.in_window(7));
+    CHECK(scheduler.in_window(kPieces - 1));
+    CHECK(!scheduler.in_window(8));
+
+    scheduler.seek(20);
+    scheduler.on_piece_finished(20);
+    CHECK(scheduler.in_window(20));
+    CHECK(scheduler.in_window(28));
+    CHECK(!scheduler.in_window(19));
+    CHECK(!scheduler.in_window(kPieces - 1));
+
+    scheduler.stop();
+    CHECK(!scheduler.in_window(21));
+}
+
+TEST_CASE(piece_of_clamps_to_file) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    CHECK_EQ(scheduler.piece_of(0), 0);
+    CHECK_EQ(scheduler.piece_of(int64_t{kPieceSize} * 3 + 5), 3);
+    CHECK_EQ(scheduler.piece_of(-1), 0);
+    CHECK_EQ(scheduler.piece_of(int64_t{kPieceSize} * kPieces), kPieces - 1);
+}
+
+TEST_CASE(buffered_pieces_stop_at_first_unfinished) {
+    fixture_t fixture;
+    streaming_scheduler_t scheduler(fixture.handle, fixture_t::config(), fixture.endgame);
+    CHECK_EQ(scheduler.buffered_pieces(10), 0);
+    for (const int piece: {10, 11, 12, 14}) {
+        scheduler.on_piece_finished(piece);
+    }
+    CHECK_EQ(scheduler.buffered_pieces(10), 3);
+    CHECK_EQ(scheduler.buffered_pieces(12), 1);
+    CHECK_EQ(scheduler.buffered_pieces(-1), 0);
+    CHECK_EQ(scheduler.buffered_pieces(kPieces), 0);
+
+    for (int piece = 13; piece < kPieces; ++piece) {
+        scheduler.on_piece_finished(piece);
+    }
+    CHECK_EQ(scheduler.buffered_pieces(10), std::numeric_limits<int>::max());
+}
+
+TEST_CASE(pieces_not_in_keeps_order) {
+    CHECK(pieces_not_in({5, 1, 3, 2}, {2, 3}) == (std::vector<int>{5, 1}));
+    CHECK(pieces_not_in({}, {1}).empty());
+    CHECK(pieces_not_in({1, 2}, {}) == (std::vector<int>{1, 2}));
+}
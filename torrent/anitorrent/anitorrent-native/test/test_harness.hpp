@@ -0,0 +1,57 @@
+#ifndef TEST_HARNESS_H
+#define TEST_HARNESS_H
+
+#include <cstdio>
+#include <vector>
+
+/**
+ * Minimal harness for the native tests, so that they need nothing but libtorrent. Each test file is one executable
+ * registered with ctest: `TEST_CASE` defines a case, `CHECK` records a failure and continues, and `main` runs every
+ * case and fails if any check failed.
+ */
+namespace anilt::test {
+struct test_case_t {
+    const char *name;
+    void (*run)();
+};
+
+inline std::vector<test_case_t> &test_cases() {
+    static std::vector<test_case_t> cases;
+    return cases;
+}
+
+inline int &failures() {
+    static int count = 0;
+    return count;
+}
+
+struct registrar_t {
+    registrar_t(const char *name, void (*run)()) { test_cases().push_back({name, run}); }
+};
+} // namespace anilt::test
+
+#define TEST_CASE(name)                                                                                                \
+    static void name();                                                                                                \
+    static const anilt::test::registrar_t name##_registrar(#name, name);                                               \
+    static void name()
+
+#define CHECK(condition)                                                                                               \
+    do {                                                                                                               \
+        if (!(condition)) {                                                                                            \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                         \
+            ++anilt::test::failures();                                                                                 \
+        }                                                                                                              \
+    } while (0)
+
+#define CHECK_EQ(actual, expected) CHECK((actual) == (expected))
+
+int main() {
+    for (const auto &test: anilt::test::test_cases()) {
+        const int before = anilt::test::failures();
+        test.run();
+        std::printf("%s %s\n", anilt::test::failures() == before ? "PASS" : "FAIL", test.name);
+    }
+    return anilt::test::failures() == 0 ? 0 : 1;
+}
+
+#endif // TEST_HARNESS_H
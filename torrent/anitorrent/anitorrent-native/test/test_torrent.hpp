@@ -0,0 +1,55 @@
+#ifndef TEST_TORRENT_H
+#define TEST_TORRENT_H
+
+#include <filesystem>
+#include <iterator>
+#include <string>
+
+#include "libtorrent/bencode.hpp"
+#include "libtorrent/create_torrent.hpp"
+#include "libtorrent/hasher.hpp"
+#include "libtorrent/session.hpp"
+#include "libtorrent/torrent_info.hpp"
+
+namespace anilt::test {
+/**
+ * A paused torrent of one file in a session without network, none of its pieces downloaded. The last piece is
+ * `last_piece_size` bytes, a full piece if 0.
+ */
+struct test_torrent_t {
+    lt::session session{settings()};
+    lt::torrent_handle handle{};
+
+    test_torrent_t(const char *name, const int pieces, const int piece_size, const int last_piece_size = 0) {
+        lt::file_storage files;
+        const int64_t file_size =
+            int64_t{piece_size} * (pieces - 1) + (last_piece_size > 0 ? last_piece_size : piece_size);
+        files.add_file("video.mkv", file_size);
+        lt::create_torrent creator(files, piece_size, lt::create_torrent::v1_only);
+        for (int piece = 0; piece < pieces; ++piece) {
+            creator.set_hash(lt::piece_index_t(piece),
+                             lt::hasher(reinterpret_cast<const char *>(&piece), sizeof piece).final());
+        }
+        std::vector<char> buffer;
+        lt::bencode(std::back_inserter(buffer), creator.generate());
+
+        lt::add_torrent_params params;
+        params.ti = std::make_shared<lt::torrent_info>(buffer, lt::from_span);
+        params.save_path = (std::filesystem::temp_directory_path() / name).string();
+        params.flags = lt::torrent_flags::paused;
+        handle = session.add_torrent(std::move(params));
+    }
+
+    static lt::settings_pack settings() {
+        lt::settings_pack pack;
+        pack.set_str(lt::settings_pack::listen_interfaces, "127.0.0.1:0");
+        pack.set_bool(lt::settings_pack::enable_dht, false);
+        pack.set_bool(lt::settings_pack::enable_lsd, false);
+        pack.set_bool(lt::settings_pack::enable_upnp, false);
+        pack.set_bool(lt::settings_pack::enable_natpmp, false);
+        return pack;
+    }
+};
+} // namespace anilt::test
+
+#endif // TEST_TORRENT_H